@@ -1,8 +1,31 @@
+#define LIGHT_TYPE_DIRECTIONAL 0
+#define LIGHT_TYPE_POINT 1
+#define LIGHT_TYPE_SPOT 2
+
 cbuffer LightData : register(b1, space0)
 {
-    float4 LightDirection;
-	float4 LightColor;
     float4 CameraPosition;
+    float2 ClusterTileSize;
+    float DepthSliceScale;
+    float DepthSliceBias;
+    float NearPlane;
+    float FarPlane;
+    uint DirectionalLightCount;
+    uint LightDataPadding;
+    uint3 ClusterCount;
+};
+
+// Renderer::ShaderLight와 같은 배치. Directional Light가 앞쪽 DirectionalLightCount개를 차지함.
+struct Light
+{
+    float3 Position;
+    float Range;
+    float3 Color;
+    uint Type;
+    float3 Direction;
+    float CosOuterCone;
+    float CosInnerCone;
+    float3 Padding;
 };
 
 struct PS_INPUT
@@ -16,24 +39,68 @@ struct PS_INPUT
 Texture2D albedoTexture : register(t0, space0);
 SamplerState defaultSampler : register(s0, space0);
 
-float4 main(PS_INPUT input) : SV_TARGET
+StructuredBuffer<Light> Lights : register(t1, space0);
+// Cluster마다 LightIndices 안의 (Offset, Count).
+StructuredBuffer<uint2> Clusters : register(t2, space0);
+StructuredBuffer<uint> LightIndices : register(t3, space0);
+
+float3 ComputeDiffuseSpecular(float3 n, float3 l, float3 v, float3 lightColor)
+{
+    const float diffuseStrength = 0.5f;
+    const float nDotL = dot(n, l);
+    const float3 diffuse = max(nDotL, 0.0f) * lightColor * diffuseStrength;
+
+    const float3 h = normalize(l + v);
+    const float hDotN = dot(h, n);
+	const float specularPower = 32.0f * 4.0f;
+    const float3 specular = pow(max(hDotN, 0.0f), specularPower) * lightColor;
+    return diffuse + specular;
+}
+
+uint GetClusterIndex(float4 screenPosition)
 {
+    // SV_Position.z는 [0, 1]의 Depth이므로 View 공간의 거리로 되돌림.
+    const float viewDepth = NearPlane * FarPlane / (FarPlane - screenPosition.z * (FarPlane - NearPlane));
+    const uint3 cluster = uint3(
+        min(uint(screenPosition.x / ClusterTileSize.x), ClusterCount.x - 1),
+        min(uint(screenPosition.y / ClusterTileSize.y), ClusterCount.y - 1),
+        uint(clamp(floor(log(viewDepth) * DepthSliceScale - DepthSliceBias), 0.0f, float(ClusterCount.z - 1))));
+    return (cluster.z * ClusterCount.y + cluster.y) * ClusterCount.x + cluster.x;
+}
 
+float4 main(PS_INPUT input) : SV_TARGET
+{
     const float4 albedo = albedoTexture.Sample(defaultSampler, input.TexCoord);
     const float ambientStrength = 0.5f;
-    const float3 ambient = saturate(LightColor * ambientStrength).xyz;
-	
-   
-    const float diffuseStrength = 0.5f;
     const float3 n = normalize(input.WorldNormal);
-    const float3 l = -LightDirection.xyz; // FROMLIGHT to TOLIGHT
-    const float nDotL = dot(n, l);
-    const float3 diffuse = saturate(max(nDotL, 0.0f) * LightColor * diffuseStrength).rgb;
-    
     const float3 v = normalize(CameraPosition.xyz - input.WorldPosition);
-    const float3 h = normalize(l + v); 
-    const float hDotN = dot(h, n);
-	const float specularPower = 32.0f * 4.0f;
-    const float3 specular = saturate(pow(max(hDotN, 0.0f), specularPower) * LightColor).rgb;
-    return float4(albedo.rgb * saturate(ambient + diffuse + specular), 1.0f);
-}
\ No newline at end of file
+
+    float3 ambient = 0.0f;
+    float3 lighting = 0.0f;
+    for (uint i = 0; i < DirectionalLightCount; ++i)
+    {
+        const Light light = Lights[i];
+        ambient += light.Color * ambientStrength;
+        lighting += ComputeDiffuseSpecular(n, -light.Direction, v, light.Color); // FROMLIGHT to TOLIGHT
+    }
+
+    const uint2 cluster = Clusters[GetClusterIndex(input.Position)];
+    for (uint j = 0; j < cluster.y; ++j)
+    {
+        const Light light = Lights[LightIndices[cluster.x + j]];
+        const float3 toLight = light.Position - input.WorldPosition;
+        const float distanceSquared = dot(toLight, toLight);
+        const float3 l = toLight * rsqrt(max(distanceSquared, 1e-6f));
+
+        // Range에서 0이 되도록 거리 제곱 감쇠에 창 함수를 곱함.
+        const float distanceRatio = distanceSquared / (light.Range * light.Range);
+        const float window = saturate(1.0f - distanceRatio * distanceRatio);
+        float attenuation = window * window / (distanceSquared + 1.0f);
+        if (light.Type == LIGHT_TYPE_SPOT)
+        {
+            attenuation *= smoothstep(light.CosOuterCone, light.CosInnerCone, dot(-l, light.Direction));
+        }
+        lighting += ComputeDiffuseSpecular(n, l, v, light.Color * attenuation);
+    }
+    return float4(albedo.rgb * saturate(saturate(ambient) + lighting), 1.0f);
+}
@@ -1,10 +1,19 @@
 cbuffer PerFrame : register(b0, space0)
 {
-	float4x4 MatGeo;
-	float4x4 MatGeoInvert;
     float4x4 MatVP;
+    // 이번 Draw의 첫 Instance가 Instances 안에서 놓인 위치.
+    uint InstanceOffset;
 };
 
+// Renderer::InstanceData와 같은 배치.
+struct Instance
+{
+    float4x4 MatGeo;
+    float4x4 MatGeoInverseTranspose;
+};
+
+StructuredBuffer<Instance> Instances : register(t4, space0);
+
 struct VS_INPUT
 {
 	float3 Position : POSITION;
@@ -20,13 +29,14 @@ struct VS_OUTPUT
 	float2 TexCoord : TEXCOORD;
 };
 
-VS_OUTPUT main(VS_INPUT input)
+VS_OUTPUT main(VS_INPUT input, uint instanceID : SV_InstanceID)
 {
+	const Instance instance = Instances[InstanceOffset + instanceID];
+
 	VS_OUTPUT output;
-	output.WorldPosition = mul(float4(input.Position, 1.0f), MatGeo).xyz;
+	output.WorldPosition = mul(float4(input.Position, 1.0f), instance.MatGeo).xyz;
 	output.Position = mul(float4(output.WorldPosition, 1.0f), MatVP);
-	float3x3 InvTransposeGeo = (float3x3)transpose(MatGeoInvert);
-	output.WorldNormal = normalize(mul(input.Normal, (float3x3)InvTransposeGeo));
+	output.WorldNormal = normalize(mul(input.Normal, (float3x3)instance.MatGeoInverseTranspose));
 	output.TexCoord = input.TexCoord;
 	return output;
-}
\ No newline at end of file
+}
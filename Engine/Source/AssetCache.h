@@ -0,0 +1,160 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "AssetRegistry.h"
+
+namespace Engine
+{
+    // Asset Type 하나에 대한 Load와 Eviction 정책.
+    // Asset 자체는 AssetRegistry에 저장되며, Budget을 넘으면 더 이상 참조되지 않는 Asset을 LRU 순서로 해제함.
+    // 로드된 Asset은 내용의 Hash로 중복 여부를 확인하여, 같은 내용이라면 기존 Asset을 공유함.
+    // 해제된 Asset은 다음 Load 호출 시 Loader를 통해 다시 로드됨.
+    template <typename Type, typename Loader>
+    class AssetCache
+    {
+    public:
+        explicit AssetCache(AssetRegistry& registry, const uint64_t memoryBudget = std::numeric_limits<uint64_t>::max())
+            : m_Registry(registry),
+              m_MemoryBudget(memoryBudget)
+        {
+        }
+
+        template <typename... Args>
+        entt::resource<Type> Load(const entt::id_type id, Args&&... args)
+        {
+            if (auto handle = m_Registry.Find<Type>(id))
+            {
+                return handle;
+            }
+
+            // 같은 Asset을 여러 Thread가 동시에 요청하면 한 Thread만 로드하고 나머지는 그 결과를 기다림.
+            std::promise<entt::resource<Type>> loadPromise;
+            std::shared_future<entt::resource<Type>> pendingLoad;
+            {
+                std::lock_guard lock(m_LoadMutex);
+                if (auto handle = m_Registry.Find<Type>(id))
+                {
+                    return handle;
+                }
+
+                if (const auto it = m_PendingLoads.find(id); it != m_PendingLoads.end())
+                {
+                    pendingLoad = it->second;
+                }
+                else
+                {
+                    m_PendingLoads.emplace(id, loadPromise.get_future().share());
+                }
+            }
+
+            if (pendingLoad.valid())
+            {
+                return pendingLoad.get();
+            }
+
+            entt::resource<Type> handle{};
+            try
+            {
+                std::shared_ptr<Type> asset = Loader{}(std::forward<Args>(args)...);
+                if (asset)
+                {
+                    const uint64_t sizeInBytes = asset->GetSizeInBytes();
+                    const uint64_t contentHash = asset->GetContentHash();
+                    handle = m_Registry.Insert<Type>(id, std::move(asset), sizeInBytes, contentHash);
+                }
+            }
+            catch (...)
+            {
+                // 기다리던 Thread에도 실패를 전하고, 다음 Load는 Pending 목록에 남은 결과 대신 다시 로드하도록 함.
+                {
+                    std::lock_guard lock(m_LoadMutex);
+                    m_PendingLoads.erase(id);
+                }
+                loadPromise.set_exception(std::current_exception());
+                throw;
+            }
+
+            {
+                std::lock_guard lock(m_LoadMutex);
+                m_PendingLoads.erase(id);
+            }
+            loadPromise.set_value(handle);
+
+            // 방금 로드한 Asset은 handle이 참조하고 있으므로 해제 대상이 아님.
+            Evict(m_MemoryBudget.load(std::memory_order_relaxed));
+            return handle;
+        }
+
+        // Asset을 다시 로드하여 교체함. 이전에 반환된 Handle은 이전 Asset을 계속 가리킴.
+        template <typename... Args>
+        entt::resource<Type> Reload(const entt::id_type id, Args&&... args)
+        {
+            std::shared_ptr<Type> asset = Loader{}(std::forward<Args>(args)...);
+            if (!asset)
+            {
+                return {};
+            }
+
+            const uint64_t sizeInBytes = asset->GetSizeInBytes();
+            const uint64_t contentHash = asset->GetContentHash();
+            entt::resource<Type> handle = m_Registry.Replace<Type>(id, std::move(asset), sizeInBytes, contentHash);
+            Evict(m_MemoryBudget.load(std::memory_order_relaxed));
+            return handle;
+        }
+
+        // Cache 외부에서 참조하지 않는 Asset을 오래 사용되지 않은 순서로 해제하여 targetBytes 이하로 맞춤.
+        void Evict(const uint64_t targetBytes)
+        {
+            const entt::id_type type = entt::type_hash<Type>::value();
+
+            std::lock_guard lock(m_EvictMutex);
+            uint64_t residentBytes = m_Registry.GetResidentBytes(type);
+            if (residentBytes <= targetBytes)
+            {
+                return;
+            }
+
+            std::vector<AssetRegistry::AssetInfo> candidates = m_Registry.GetAssets(type);
+            std::erase_if(candidates, [](const AssetRegistry::AssetInfo& info) { return info.bIsReferenced; });
+            std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.LastAccess < rhs.LastAccess;
+            });
+
+            for (const AssetRegistry::AssetInfo& candidate : candidates)
+            {
+                if (residentBytes <= targetBytes)
+                {
+                    break;
+                }
+
+                residentBytes -= m_Registry.RemoveIfUnreferenced(type, candidate.Id);
+            }
+        }
+
+        void SetMemoryBudget(const uint64_t budgetInBytes)
+        {
+            m_MemoryBudget.store(budgetInBytes, std::memory_order_relaxed);
+            Evict(budgetInBytes);
+        }
+
+        uint64_t GetMemoryBudget() const { return m_MemoryBudget.load(std::memory_order_relaxed); }
+        uint64_t GetResidentBytes() const { return m_Registry.GetResidentBytes(entt::type_hash<Type>::value()); }
+
+    private:
+        AssetRegistry& m_Registry;
+        std::atomic<uint64_t> m_MemoryBudget = 0;
+
+        std::mutex m_LoadMutex;
+        std::unordered_map<entt::id_type, std::shared_future<entt::resource<Type>>> m_PendingLoads;
+        std::mutex m_EvictMutex;
+    };
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "Engine.h"
+
+namespace Engine
+{
+    // Pool 안의 Slot을 가리키는 32bit Handle. 하위 20bit는 Index, 상위 12bit는 Generation임.
+    // Slot이 재사용되면 Generation이 바뀌므로 해제된 Asset을 가리키는 Handle을 구별할 수 있음.
+    template <typename Type>
+    struct AssetHandle
+    {
+        static constexpr uint32_t IndexBits = 20;
+        static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+        static constexpr uint32_t GenerationMask = (1u << (32 - IndexBits)) - 1;
+        static constexpr uint32_t InvalidValue = 0;
+
+        uint32_t Value = InvalidValue;
+
+        static AssetHandle Make(uint32_t index, uint32_t generation) { return {(generation << IndexBits) | index}; }
+
+        uint32_t GetIndex() const { return Value & IndexMask; }
+        uint32_t GetGeneration() const { return Value >> IndexBits; }
+
+        explicit operator bool() const { return Value != InvalidValue; }
+        bool operator==(const AssetHandle&) const = default;
+    };
+
+    // Type별 Asset을 연속된 배열에 보관하고 AssetHandle로 접근하는 Pool.
+    // Get은 참조 횟수나 Atomic 연산 없이 배열 Index로만 접근하므로 매 Draw마다 호출해도 됨.
+    // 소유권은 Acquire/Retain/Release로만 바뀌며, 참조 횟수가 0이 되면 Slot을 비우고 Generation을 올림.
+    // Main Thread에서만 사용함.
+    template <typename Type>
+    class AssetPool
+    {
+    public:
+        AssetPool()
+        {
+            // Index 0, Generation 0은 InvalidValue이므로 첫 Slot은 사용하지 않음.
+            m_Assets.push_back(nullptr);
+            m_Generations.push_back(0);
+            m_Slots.emplace_back();
+        }
+
+        // 같은 Id가 이미 Pool에 있다면 그 Handle의 참조 횟수만 올림.
+        // sourcePath는 Scene 저장처럼 Handle로부터 Asset을 다시 불러와야 하는 곳에서 사용함.
+        AssetHandle<Type> Acquire(const entt::id_type id, entt::resource<Type> resource, std::string_view sourcePath = {})
+        {
+            if (const auto it = m_Handles.find(id); it != m_Handles.end())
+            {
+                Retain(it->second);
+                return it->second;
+            }
+
+            if (!resource)
+            {
+                return {};
+            }
+
+            uint32_t index = 0;
+            if (!m_FreeIndices.empty())
+            {
+                index = m_FreeIndices.back();
+                m_FreeIndices.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(m_Assets.size());
+                EG_CONFIRM(index <= AssetHandle<Type>::IndexMask);
+                m_Assets.push_back(nullptr);
+                m_Generations.push_back(1);
+                m_Slots.emplace_back();
+            }
+
+            m_Assets[index] = &*resource;
+            m_Slots[index] = {.Resource = std::move(resource), .Id = id, .RefCount = 1, .SourcePath = std::string(sourcePath)};
+
+            const AssetHandle<Type> handle = AssetHandle<Type>::Make(index, m_Generations[index]);
+            m_Handles.emplace(id, handle);
+            return handle;
+        }
+
+        void Retain(const AssetHandle<Type> handle, uint32_t count = 1)
+        {
+            EG_CONFIRM(IsValid(handle));
+            m_Slots[handle.GetIndex()].RefCount += count;
+        }
+
+        void Release(const AssetHandle<Type> handle)
+        {
+            EG_CONFIRM(IsValid(handle));
+            const uint32_t index = handle.GetIndex();
+            Slot& slot = m_Slots[index];
+            if (--slot.RefCount > 0)
+            {
+                return;
+            }
+
+            // Resource를 놓으면 AssetCache가 Budget에 따라 해제할 수 있게 됨.
+            m_Handles.erase(slot.Id);
+            slot = {};
+            m_Assets[index] = nullptr;
+            m_Generations[index] = (m_Generations[index] + 1) & AssetHandle<Type>::GenerationMask;
+            if (m_Generations[index] == 0)
+            {
+                m_Generations[index] = 1;
+            }
+            m_FreeIndices.push_back(index);
+        }
+
+        Type& Get(const AssetHandle<Type> handle) const
+        {
+#ifdef _DEBUG
+            EG_CONFIRM(IsValid(handle));
+#endif
+            return *m_Assets[handle.GetIndex()];
+        }
+
+        bool IsValid(const AssetHandle<Type> handle) const
+        {
+            const uint32_t index = handle.GetIndex();
+            return handle && index < m_Assets.size() && m_Generations[index] == handle.GetGeneration() && m_Assets[index];
+        }
+
+        // Hot-Reload로 교체된 Asset을 같은 Handle이 가리키도록 갱신함.
+        void Rebind(const entt::id_type id, entt::resource<Type> resource)
+        {
+            const auto it = m_Handles.find(id);
+            if (it == m_Handles.end() || !resource)
+            {
+                return;
+            }
+
+            const uint32_t index = it->second.GetIndex();
+            m_Assets[index] = &*resource;
+            m_Slots[index].Resource = std::move(resource);
+        }
+
+        size_t GetLiveCount() const { return m_Handles.size(); }
+
+        entt::id_type GetId(const AssetHandle<Type> handle) const
+        {
+            EG_CONFIRM(IsValid(handle));
+            return m_Slots[handle.GetIndex()].Id;
+        }
+
+        const std::string& GetSourcePath(const AssetHandle<Type> handle) const
+        {
+            EG_CONFIRM(IsValid(handle));
+            return m_Slots[handle.GetIndex()].SourcePath;
+        }
+
+    private:
+        struct Slot
+        {
+            entt::resource<Type> Resource{};
+            entt::id_type Id = 0;
+            uint32_t RefCount = 0;
+            std::string SourcePath;
+        };
+
+        // Get이 접근하는 배열과 소유권 관리용 배열을 분리하여 Draw Loop가 필요한 데이터만 읽도록 함.
+        std::vector<Type*> m_Assets;
+        std::vector<uint32_t> m_Generations;
+
+        std::vector<Slot> m_Slots;
+        std::vector<uint32_t> m_FreeIndices;
+        std::unordered_map<entt::id_type, AssetHandle<Type>> m_Handles;
+    };
+}
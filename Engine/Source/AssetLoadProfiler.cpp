@@ -0,0 +1,273 @@
+#include "EnginePCH.h"
+#include "AssetLoadProfiler.h"
+
+#include <format>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr size_t StageCount = static_cast<size_t>(AssetLoadStage::Count);
+        constexpr size_t InvalidAssetIndex = std::numeric_limits<size_t>::max();
+        constexpr std::array<std::string_view, StageCount> StageNames = {"FileRead", "Decode", "PostProcess", "Upload", "GPUWait"};
+
+        struct AssetLoadRecord
+        {
+            std::string Name;
+            std::array<std::chrono::nanoseconds, StageCount> StageDurations{};
+            uint64_t BytesRead = 0;
+            uint64_t BytesResident = 0;
+            uint64_t BytesUploaded = 0;
+            uint32_t ThreadIndex = 0;
+        };
+
+        struct StageEvent
+        {
+            size_t AssetIndex = InvalidAssetIndex;
+            AssetLoadStage Stage = AssetLoadStage::FileRead;
+            std::chrono::steady_clock::time_point StartTime;
+            std::chrono::nanoseconds Duration{};
+            uint32_t ThreadIndex = 0;
+        };
+
+        struct ProfilerState
+        {
+            std::mutex Mutex;
+            std::vector<AssetLoadRecord> Assets;
+            std::unordered_map<std::string, size_t> AssetIndices;
+            std::vector<StageEvent> Events;
+            std::unordered_map<std::thread::id, uint32_t> ThreadIndices;
+            const std::chrono::steady_clock::time_point StartTime = std::chrono::steady_clock::now();
+        };
+
+        thread_local size_t CurrentAssetIndex = InvalidAssetIndex;
+
+        ProfilerState& GetState()
+        {
+            static ProfilerState state;
+            return state;
+        }
+
+        uint32_t GetThreadIndex(ProfilerState& state)
+        {
+            const auto [it, bInserted] = state.ThreadIndices.try_emplace(std::this_thread::get_id(), static_cast<uint32_t>(state.ThreadIndices.size()));
+            return it->second;
+        }
+
+        double ToMilliseconds(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+        double ToMicroseconds(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+
+        std::string EscapeJson(std::string_view text)
+        {
+            std::string escaped;
+            escaped.reserve(text.size());
+            for (const char character : text)
+            {
+                switch (character)
+                {
+                case '"': escaped += "\\\"";
+                    break;
+                case '\\': escaped += "\\\\";
+                    break;
+                case '\b': escaped += "\\b";
+                    break;
+                case '\f': escaped += "\\f";
+                    break;
+                case '\n': escaped += "\\n";
+                    break;
+                case '\r': escaped += "\\r";
+                    break;
+                case '\t': escaped += "\\t";
+                    break;
+                default:
+                    // JSON 문자열에는 0x20보다 작은 제어 문자를 그대로 넣을 수 없음.
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        escaped += std::format("\\u{:04x}", static_cast<unsigned char>(character));
+                    }
+                    else
+                    {
+                        escaped += character;
+                    }
+                }
+            }
+            return escaped;
+        }
+    }
+
+    AssetLoadProfiler::AssetScope::AssetScope(std::string_view assetName)
+        : m_PreviousAssetIndex(CurrentAssetIndex)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+        const auto [it, bInserted] = state.AssetIndices.try_emplace(std::string(assetName), state.Assets.size());
+        if (bInserted)
+        {
+            state.Assets.push_back({.Name = std::string(assetName), .ThreadIndex = GetThreadIndex(state)});
+        }
+        CurrentAssetIndex = it->second;
+    }
+
+    AssetLoadProfiler::AssetScope::~AssetScope()
+    {
+        CurrentAssetIndex = m_PreviousAssetIndex;
+    }
+
+    AssetLoadProfiler::StageScope::StageScope(AssetLoadStage stage)
+        : m_Stage(stage),
+          m_AssetIndex(CurrentAssetIndex),
+          m_StartTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    AssetLoadProfiler::StageScope::~StageScope()
+    {
+        if (m_AssetIndex == InvalidAssetIndex)
+        {
+            return;
+        }
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_StartTime);
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+        state.Assets[m_AssetIndex].StageDurations[static_cast<size_t>(m_Stage)] += duration;
+        state.Events.push_back({
+            .AssetIndex = m_AssetIndex,
+            .Stage = m_Stage,
+            .StartTime = m_StartTime,
+            .Duration = duration,
+            .ThreadIndex = GetThreadIndex(state)
+        });
+    }
+
+    void AssetLoadProfiler::AddBytesRead(uint64_t bytes)
+    {
+        if (CurrentAssetIndex == InvalidAssetIndex)
+        {
+            return;
+        }
+
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+        state.Assets[CurrentAssetIndex].BytesRead += bytes;
+    }
+
+    void AssetLoadProfiler::AddBytesResident(uint64_t bytes)
+    {
+        if (CurrentAssetIndex == InvalidAssetIndex)
+        {
+            return;
+        }
+
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+        state.Assets[CurrentAssetIndex].BytesResident += bytes;
+    }
+
+    void AssetLoadProfiler::AddBytesUploaded(uint64_t bytes)
+    {
+        if (CurrentAssetIndex == InvalidAssetIndex)
+        {
+            return;
+        }
+
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+        state.Assets[CurrentAssetIndex].BytesUploaded += bytes;
+    }
+
+    void AssetLoadProfiler::LogSummary()
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+
+        std::vector<const AssetLoadRecord*> records;
+        std::array<std::chrono::nanoseconds, StageCount> stageTotals{};
+        std::chrono::nanoseconds total{};
+        for (const AssetLoadRecord& record : state.Assets)
+        {
+            records.push_back(&record);
+            for (size_t i = 0; i < StageCount; ++i)
+            {
+                stageTotals[i] += record.StageDurations[i];
+                total += record.StageDurations[i];
+            }
+        }
+
+        const auto getTotal = [](const AssetLoadRecord* record)
+        {
+            std::chrono::nanoseconds sum{};
+            for (const auto& duration : record->StageDurations)
+            {
+                sum += duration;
+            }
+            return sum;
+        };
+        std::sort(records.begin(), records.end(), [&](const AssetLoadRecord* lhs, const AssetLoadRecord* rhs) { return getTotal(lhs) > getTotal(rhs); });
+
+        spdlog::info("Asset load summary: {} assets, {:.2f} ms", records.size(), ToMilliseconds(total));
+        spdlog::info("{:<40} {:>10} {:>10} {:>12} {:>10} {:>10} {:>10} {:>12} {:>12} {:>12} {:>6}",
+                     "Asset", "FileRead", "Decode", "PostProcess", "Upload", "GPUWait", "Total", "Read(KB)", "Resident(KB)", "Uploaded(KB)", "Thread");
+        for (const AssetLoadRecord* record : records)
+        {
+            const auto& durations = record->StageDurations;
+            spdlog::info("{:<40} {:>10.2f} {:>10.2f} {:>12.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>12.1f} {:>12.1f} {:>12.1f} {:>6}",
+                         record->Name,
+                         ToMilliseconds(durations[0]), ToMilliseconds(durations[1]), ToMilliseconds(durations[2]),
+                         ToMilliseconds(durations[3]), ToMilliseconds(durations[4]), ToMilliseconds(getTotal(record)),
+                         static_cast<double>(record->BytesRead) / 1024.0, static_cast<double>(record->BytesResident) / 1024.0,
+                         static_cast<double>(record->BytesUploaded) / 1024.0, record->ThreadIndex);
+        }
+        spdlog::info("{:<40} {:>10.2f} {:>10.2f} {:>12.2f} {:>10.2f} {:>10.2f} {:>10.2f}",
+                     "Total",
+                     ToMilliseconds(stageTotals[0]), ToMilliseconds(stageTotals[1]), ToMilliseconds(stageTotals[2]),
+                     ToMilliseconds(stageTotals[3]), ToMilliseconds(stageTotals[4]), ToMilliseconds(total));
+    }
+
+    bool AssetLoadProfiler::WriteChromeTrace(const std::filesystem::path& filePath)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard lock(state.Mutex);
+
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            spdlog::warn("Failed to open {} for writing", filePath.string());
+            return false;
+        }
+
+        file << "{\"traceEvents\":[\n";
+        bool bIsFirstEvent = true;
+        for (const auto& [threadId, threadIndex] : state.ThreadIndices)
+        {
+            file << (bIsFirstEvent ? "" : ",\n")
+                << std::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"Thread {}"}}}})", threadIndex, threadIndex);
+            bIsFirstEvent = false;
+        }
+
+        for (const StageEvent& event : state.Events)
+        {
+            const AssetLoadRecord& record = state.Assets[event.AssetIndex];
+            const std::string_view stageName = StageNames[static_cast<size_t>(event.Stage)];
+            file << (bIsFirstEvent ? "" : ",\n")
+                << std::format(R"({{"name":"{}: {}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"asset":"{}","bytesRead":{},"bytesResident":{},"bytesUploaded":{}}}}})",
+                               EscapeJson(record.Name), stageName, stageName,
+                               ToMicroseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(event.StartTime - state.StartTime)), ToMicroseconds(event.Duration),
+                               event.ThreadIndex, EscapeJson(record.Name), record.BytesRead, record.BytesResident, record.BytesUploaded);
+            bIsFirstEvent = false;
+        }
+        file << "\n]}\n";
+        return static_cast<bool>(file);
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <string_view>
+
+namespace Engine
+{
+    enum class AssetLoadStage
+    {
+        FileRead,
+        Decode,
+        PostProcess,
+        Upload,
+        GPUWait,
+        Count
+    };
+
+    // Asset 로딩을 단계별로 측정함.
+    // AssetScope로 현재 Thread가 로드 중인 Asset을 지정하면, 그 안의 StageScope가 해당 Asset에 기록됨.
+    class AssetLoadProfiler final
+    {
+    public:
+        class AssetScope
+        {
+        public:
+            explicit AssetScope(std::string_view assetName);
+            ~AssetScope();
+
+            AssetScope(const AssetScope&) = delete;
+            AssetScope& operator=(const AssetScope&) = delete;
+
+        private:
+            size_t m_PreviousAssetIndex;
+        };
+
+        class StageScope
+        {
+        public:
+            explicit StageScope(AssetLoadStage stage);
+            ~StageScope();
+
+            StageScope(const StageScope&) = delete;
+            StageScope& operator=(const StageScope&) = delete;
+
+        private:
+            AssetLoadStage m_Stage;
+            size_t m_AssetIndex;
+            std::chrono::steady_clock::time_point m_StartTime;
+        };
+
+    public:
+        AssetLoadProfiler() = delete;
+
+        static void AddBytesRead(uint64_t bytes);
+        // CPU에 남는 Asset의 크기.
+        static void AddBytesResident(uint64_t bytes);
+        // GPU로 올린 크기. Resident와 따로 셈.
+        static void AddBytesUploaded(uint64_t bytes);
+
+        static void LogSummary();
+        static bool WriteChromeTrace(const std::filesystem::path& filePath);
+    };
+}
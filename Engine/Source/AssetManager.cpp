@@ -1,25 +1,156 @@
 #include "EnginePCH.h"
 #include "AssetManager.h"
+#include "AssetCache.h"
+#include "Engine.h"
 #include "Graphics/Mesh.h"
 #include "Graphics/Texture.h"
 
 namespace Engine
 {
+    namespace
+    {
+        constexpr uint64_t DefaultShaderMemoryBudget = 16ull * 1024 * 1024;
+        constexpr uint64_t DefaultTextureMemoryBudget = 512ull * 1024 * 1024;
+        constexpr uint64_t DefaultMeshMemoryBudget = 256ull * 1024 * 1024;
+
+        AssetCache<Shader, ShaderLoader>& GetShaderCache()
+        {
+            static AssetCache<Shader, ShaderLoader> resourceCache{AssetManager::GetRegistry(), DefaultShaderMemoryBudget};
+            return resourceCache;
+        }
+
+        AssetCache<Texture, TextureLoader>& GetTextureCache()
+        {
+            static AssetCache<Texture, TextureLoader> resourceCache{AssetManager::GetRegistry(), DefaultTextureMemoryBudget};
+            return resourceCache;
+        }
+
+        AssetCache<Mesh, MeshLoader>& GetMeshCache()
+        {
+            static AssetCache<Mesh, MeshLoader> resourceCache{AssetManager::GetRegistry(), DefaultMeshMemoryBudget};
+            return resourceCache;
+        }
+    }
+
+    AssetRegistry& AssetManager::GetRegistry()
+    {
+        static AssetRegistry registry;
+        return registry;
+    }
+
     entt::resource<Shader> AssetManager::LoadShader(const entt::id_type id, std::wstring_view filePath, ShaderType shaderType)
     {
-        static entt::resource_cache<Shader, ShaderLoader> resourceCache{};
-        return resourceCache.load(id, filePath, shaderType).first->second;
+        return GetShaderCache().Load(id, filePath, shaderType);
     }
 
     entt::resource<Texture> AssetManager::LoadTexture(const entt::id_type id, std::string_view filePath)
     {
-        static entt::resource_cache<Texture, TextureLoader> resourceCache{};
-        return resourceCache.load(id, filePath).first->second;
+        return GetTextureCache().Load(id, filePath);
     }
 
     entt::resource<Mesh> AssetManager::LoadMesh(const entt::id_type id, std::string_view filePath)
     {
-        static entt::resource_cache<Mesh, MeshLoader> resourceCache{};
-        return resourceCache.load(id, filePath).first->second;
+        return GetMeshCache().Load(id, filePath);
+    }
+
+    AssetHandle<Texture> AssetManager::AcquireTexture(const entt::id_type id, std::string_view filePath)
+    {
+        return GetPool<Texture>().Acquire(id, LoadTexture(id, filePath), filePath);
+    }
+
+    AssetHandle<Mesh> AssetManager::AcquireMesh(const entt::id_type id, std::string_view filePath)
+    {
+        return GetPool<Mesh>().Acquire(id, LoadMesh(id, filePath), filePath);
+    }
+
+    entt::resource<Shader> AssetManager::ReloadShader(const entt::id_type id, std::wstring_view filePath, ShaderType shaderType)
+    {
+        return GetShaderCache().Reload(id, filePath, shaderType);
+    }
+
+    entt::resource<Texture> AssetManager::ReloadTexture(const entt::id_type id, std::string_view filePath)
+    {
+        return GetTextureCache().Reload(id, filePath);
+    }
+
+    entt::resource<Mesh> AssetManager::ReloadMesh(const entt::id_type id, std::string_view filePath)
+    {
+        return GetMeshCache().Reload(id, filePath);
+    }
+
+    void AssetManager::SetMemoryBudget(AssetType assetType, uint64_t budgetInBytes)
+    {
+        switch (assetType)
+        {
+        case AssetType::Shader: GetShaderCache().SetMemoryBudget(budgetInBytes);
+            break;
+        case AssetType::Texture: GetTextureCache().SetMemoryBudget(budgetInBytes);
+            break;
+        case AssetType::Mesh: GetMeshCache().SetMemoryBudget(budgetInBytes);
+            break;
+        default: EG_CONFIRM(false);
+        }
+    }
+
+    uint64_t AssetManager::GetMemoryBudget(AssetType assetType)
+    {
+        switch (assetType)
+        {
+        case AssetType::Shader: return GetShaderCache().GetMemoryBudget();
+        case AssetType::Texture: return GetTextureCache().GetMemoryBudget();
+        case AssetType::Mesh: return GetMeshCache().GetMemoryBudget();
+        default: EG_CONFIRM(false);
+        }
+        return 0;
+    }
+
+    uint64_t AssetManager::GetResidentBytes(AssetType assetType)
+    {
+        switch (assetType)
+        {
+        case AssetType::Shader: return GetShaderCache().GetResidentBytes();
+        case AssetType::Texture: return GetTextureCache().GetResidentBytes();
+        case AssetType::Mesh: return GetMeshCache().GetResidentBytes();
+        default: EG_CONFIRM(false);
+        }
+        return 0;
+    }
+
+    void AssetManager::EvictUnused()
+    {
+        GetShaderCache().Evict(0);
+        GetTextureCache().Evict(0);
+        GetMeshCache().Evict(0);
+        GetRegistry().Reclaim();
+    }
+
+    void AssetManager::LogDeduplicationReport(std::string_view sceneName)
+    {
+        constexpr std::array<std::pair<AssetType, std::string_view>, static_cast<size_t>(AssetType::Count)> assetTypes = {{
+            {AssetType::Shader, "Shader"},
+            {AssetType::Texture, "Texture"},
+            {AssetType::Mesh, "Mesh"}
+        }};
+
+        spdlog::info("Asset deduplication report: {}", sceneName);
+        spdlog::info("{:<10} {:>8} {:>10} {:>14} {:>12}", "Type", "Assets", "Duplicates", "Resident(KB)", "Saved(KB)");
+        for (const auto& [assetType, typeName] : assetTypes)
+        {
+            entt::id_type type = 0;
+            switch (assetType)
+            {
+            case AssetType::Shader: type = entt::type_hash<Shader>::value();
+                break;
+            case AssetType::Texture: type = entt::type_hash<Texture>::value();
+                break;
+            case AssetType::Mesh: type = entt::type_hash<Mesh>::value();
+                break;
+            default: EG_CONFIRM(false);
+            }
+
+            const AssetRegistry::DeduplicationStats stats = GetRegistry().GetDeduplicationStats(type);
+            spdlog::info("{:<10} {:>8} {:>10} {:>14.1f} {:>12.1f}", typeName, stats.AssetCount, stats.DuplicateCount,
+                         static_cast<double>(stats.ResidentBytes) / 1024.0, static_cast<double>(stats.SavedBytes) / 1024.0);
+        }
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <entt/entt.hpp>
 
+#include "AssetHandle.h"
+#include "AssetRegistry.h"
 #include "Graphics/Shader.h"
 
 
@@ -9,11 +11,72 @@ namespace Engine
     struct Mesh;
     struct Texture;
 
+    enum class AssetType
+    {
+        Shader,
+        Texture,
+        Mesh,
+        Count
+    };
+
     class AssetManager
     {
     public:
         static entt::resource<Shader> LoadShader(const entt::id_type id, std::wstring_view filePath, ShaderType shaderType);
         static entt::resource<Texture> LoadTexture(const entt::id_type id, std::string_view filePath);
         static entt::resource<Mesh> LoadMesh(const entt::id_type id, std::string_view filePath);
+
+        static entt::resource<Shader> ReloadShader(const entt::id_type id, std::wstring_view filePath, ShaderType shaderType);
+        // Pool의 Handle은 그대로 이전 Asset을 가리킴. GPU Resource가 필요한 Mesh와 Texture는 Renderer의 Reload를 통해 교체함.
+        static entt::resource<Texture> ReloadTexture(const entt::id_type id, std::string_view filePath);
+        static entt::resource<Mesh> ReloadMesh(const entt::id_type id, std::string_view filePath);
+
+        // 이미 로드된 Asset만 조회함. 어느 Thread에서든 Lock 없이 호출할 수 있음.
+        template <typename Type>
+        static entt::resource<Type> Find(const entt::id_type id)
+        {
+            return GetRegistry().Find<Type>(id);
+        }
+
+        static AssetRegistry& GetRegistry();
+
+        // Component처럼 Asset을 오래 소유하는 곳에서 사용함. 소유가 끝나면 Release를 호출해야 함.
+        static AssetHandle<Texture> AcquireTexture(const entt::id_type id, std::string_view filePath);
+        static AssetHandle<Mesh> AcquireMesh(const entt::id_type id, std::string_view filePath);
+
+        template <typename Type>
+        static AssetPool<Type>& GetPool()
+        {
+            static AssetPool<Type> pool;
+            return pool;
+        }
+
+        template <typename Type>
+        static Type& Get(const AssetHandle<Type> handle)
+        {
+            return GetPool<Type>().Get(handle);
+        }
+
+        // Component를 여러 개 한 번에 넣을 때는 count만큼 한 번에 올림.
+        template <typename Type>
+        static void Retain(const AssetHandle<Type> handle, uint32_t count = 1)
+        {
+            GetPool<Type>().Retain(handle, count);
+        }
+
+        template <typename Type>
+        static void Release(const AssetHandle<Type> handle)
+        {
+            GetPool<Type>().Release(handle);
+        }
+
+        static void SetMemoryBudget(AssetType assetType, uint64_t budgetInBytes);
+        static uint64_t GetMemoryBudget(AssetType assetType);
+        static uint64_t GetResidentBytes(AssetType assetType);
+        // Level 전환처럼 Budget과 관계없이 참조되지 않는 Asset을 모두 해제할 때 사용.
+        static void EvictUnused();
+
+        // Type별로 중복되어 공유된 Asset 수와 절약된 메모리를 출력함.
+        static void LogDeduplicationReport(std::string_view sceneName);
     };
 }
@@ -0,0 +1,301 @@
+#include "EnginePCH.h"
+#include "AssetRegistry.h"
+
+#include <thread>
+
+#include "Engine.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // Record가 가리키는 Asset이 이 Content의 것인지 확인함.
+        bool IsSameOwner(const std::weak_ptr<void>& asset, const std::shared_ptr<void>& owner)
+        {
+            return !asset.owner_before(owner) && !owner.owner_before(asset);
+        }
+    }
+
+    AssetRegistry::ReadScope::ReadScope(ReaderCounter& counter)
+        : m_Counter(counter)
+    {
+        m_Counter.Count.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    AssetRegistry::ReadScope::~ReadScope()
+    {
+        m_Counter.Count.fetch_sub(1, std::memory_order_release);
+    }
+
+    AssetRegistry::AssetRegistry()
+    {
+        PublishTable();
+    }
+
+    AssetRegistry::~AssetRegistry()
+    {
+        m_Table.store(nullptr);
+    }
+
+    uint64_t AssetRegistry::RemoveIfUnreferenced(entt::id_type type, entt::id_type id)
+    {
+        std::lock_guard lock(m_WriteMutex);
+        const auto it = m_Records.find(MakeKey(type, id));
+        if (it == m_Records.end() || IsReferencedLocked(*it->second))
+        {
+            return 0;
+        }
+
+        const uint64_t releasedBytes = ReleaseRecordLocked(*it->second);
+        m_RetiredRecords.push_back(std::move(it->second));
+        m_Records.erase(it);
+        PublishTable();
+        ReclaimLocked();
+        return releasedBytes;
+    }
+
+    std::vector<AssetRegistry::AssetInfo> AssetRegistry::GetAssets(entt::id_type type) const
+    {
+        std::lock_guard lock(m_WriteMutex);
+        std::vector<AssetInfo> assets;
+        for (const auto& [key, record] : m_Records)
+        {
+            if (record->Type == type)
+            {
+                assets.push_back({
+                    .Id = record->Id,
+                    .SizeInBytes = record->SizeInBytes,
+                    .LastAccess = record->LastAccess.load(std::memory_order_relaxed),
+                    .bIsReferenced = IsReferencedLocked(*record)
+                });
+            }
+        }
+        return assets;
+    }
+
+    uint64_t AssetRegistry::GetResidentBytes(entt::id_type type) const
+    {
+        std::lock_guard lock(m_WriteMutex);
+        const auto it = m_TypeStats.find(type);
+        return it != m_TypeStats.end() ? it->second.ResidentBytes : 0;
+    }
+
+    AssetRegistry::DeduplicationStats AssetRegistry::GetDeduplicationStats(entt::id_type type) const
+    {
+        std::lock_guard lock(m_WriteMutex);
+        const auto it = m_TypeStats.find(type);
+        if (it == m_TypeStats.end())
+        {
+            return {};
+        }
+
+        const TypeStats& stats = it->second;
+        return {
+            .AssetCount = stats.AssetCount,
+            .DuplicateCount = stats.DuplicateCount,
+            .ResidentBytes = stats.ResidentBytes,
+            .SavedBytes = stats.LogicalBytes - stats.ResidentBytes
+        };
+    }
+
+    void AssetRegistry::Reclaim()
+    {
+        std::lock_guard lock(m_WriteMutex);
+        ReclaimLocked();
+    }
+
+    std::shared_ptr<void> AssetRegistry::FindAsset(entt::id_type type, entt::id_type id) const
+    {
+        ReadScope readScope(GetReaderCounter());
+        const Table* table = m_Table.load(std::memory_order_seq_cst);
+        if (!table)
+        {
+            return nullptr;
+        }
+
+        // Table은 항상 절반 이상 비어 있으므로 탐색은 빈 Slot에서 반드시 끝남.
+        const size_t mask = table->Slots.size() - 1;
+        for (size_t index = HashKey(MakeKey(type, id)) & mask;; index = (index + 1) & mask)
+        {
+            const Record* record = table->Slots[index];
+            if (!record)
+            {
+                return nullptr;
+            }
+
+            if (record->Type == type && record->Id == id)
+            {
+                // 같은 Epoch에 이미 기록했다면 Record의 Cache Line에도 쓰지 않음.
+                const uint64_t accessEpoch = m_AccessEpoch.load(std::memory_order_relaxed);
+                if (record->LastAccess.load(std::memory_order_relaxed) != accessEpoch)
+                {
+                    record->LastAccess.store(accessEpoch, std::memory_order_relaxed);
+                }
+                return record->Asset.lock();
+            }
+        }
+    }
+
+    std::shared_ptr<void> AssetRegistry::InsertAsset(entt::id_type type, entt::id_type id, std::shared_ptr<void> asset, uint64_t sizeInBytes, uint64_t contentHash,
+                                                     ContentComparer isSameContent, bool bReplace)
+    {
+        std::lock_guard lock(m_WriteMutex);
+        const uint64_t key = MakeKey(type, id);
+        auto it = m_Records.find(key);
+        if (it != m_Records.end())
+        {
+            if (!bReplace)
+            {
+                return it->second->Asset.lock();
+            }
+
+            ReleaseRecordLocked(*it->second);
+            m_RetiredRecords.push_back(std::move(it->second));
+        }
+
+        // 같은 내용의 Asset이 이미 있다면 새로 로드한 Asset은 버리고 기존 Asset을 공유함.
+        // Hash만 같고 내용이 다르면 공유하지 않고 따로 둠.
+        TypeStats& stats = m_TypeStats[type];
+        std::vector<Content>& contents = m_Contents[type][contentHash];
+        auto contentIt = std::find_if(contents.begin(), contents.end(), [&](const Content& content)
+        {
+            return content.SizeInBytes == sizeInBytes && isSameContent(content.Asset.get(), asset.get());
+        });
+        if (contentIt == contents.end())
+        {
+            contentIt = contents.insert(contents.end(), Content{.Asset = std::move(asset), .SizeInBytes = sizeInBytes});
+            stats.ResidentBytes += sizeInBytes;
+        }
+        else
+        {
+            stats.DuplicateCount++;
+        }
+        Content& content = *contentIt;
+        content.AliasCount++;
+        stats.AssetCount++;
+        stats.LogicalBytes += sizeInBytes;
+
+        auto record = std::make_unique<Record>();
+        record->Type = type;
+        record->Id = id;
+        record->Asset = content.Asset;
+        record->SizeInBytes = sizeInBytes;
+        record->ContentHash = contentHash;
+        record->LastAccess.store(m_AccessEpoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        std::shared_ptr<void> insertedAsset = content.Asset;
+        m_Records[key] = std::move(record);
+        PublishTable();
+        ReclaimLocked();
+        return insertedAsset;
+    }
+
+    uint64_t AssetRegistry::ReleaseRecordLocked(const Record& record)
+    {
+        TypeStats& stats = m_TypeStats[record.Type];
+        auto& contentsByHash = m_Contents[record.Type];
+        const auto hashIt = contentsByHash.find(record.ContentHash);
+        std::vector<Content>& contents = hashIt->second;
+        const auto contentIt = std::find_if(contents.begin(), contents.end(), [&](const Content& content) { return IsSameOwner(record.Asset, content.Asset); });
+        stats.AssetCount--;
+        stats.LogicalBytes -= record.SizeInBytes;
+
+        if (--contentIt->AliasCount > 0)
+        {
+            stats.DuplicateCount--;
+            return 0;
+        }
+
+        const uint64_t releasedBytes = contentIt->SizeInBytes;
+        stats.ResidentBytes -= releasedBytes;
+        contents.erase(contentIt);
+        if (contents.empty())
+        {
+            contentsByHash.erase(hashIt);
+        }
+        return releasedBytes;
+    }
+
+    const AssetRegistry::Content& AssetRegistry::FindContentLocked(const Record& record) const
+    {
+        const std::vector<Content>& contents = m_Contents.at(record.Type).at(record.ContentHash);
+        const auto contentIt = std::find_if(contents.begin(), contents.end(), [&](const Content& content) { return IsSameOwner(record.Asset, content.Asset); });
+        EG_CONFIRM(contentIt != contents.end());
+        return *contentIt;
+    }
+
+    bool AssetRegistry::IsReferencedLocked(const Record& record) const
+    {
+        // Record는 weak_ptr만 가지므로 Content 외의 강한 참조는 모두 Registry 밖의 Handle임.
+        return FindContentLocked(record).Asset.use_count() > 1;
+    }
+
+    void AssetRegistry::PublishTable()
+    {
+        // 읽는 Thread가 보고 있을 수 있으므로 게시된 Table은 수정하지 않고 새로 만들어 교체함.
+        size_t capacity = 16;
+        while (capacity < m_Records.size() * 2)
+        {
+            capacity *= 2;
+        }
+
+        auto table = std::make_unique<Table>();
+        table->Slots.resize(capacity, nullptr);
+        const size_t mask = capacity - 1;
+        for (const auto& [key, record] : m_Records)
+        {
+            size_t index = HashKey(key) & mask;
+            while (table->Slots[index])
+            {
+                index = (index + 1) & mask;
+            }
+            table->Slots[index] = record.get();
+        }
+
+        m_Table.store(table.get(), std::memory_order_seq_cst);
+        if (m_PublishedTable)
+        {
+            m_RetiredTables.push_back(std::move(m_PublishedTable));
+        }
+        m_PublishedTable = std::move(table);
+    }
+
+    void AssetRegistry::ReclaimLocked()
+    {
+        if (m_RetiredTables.empty() && m_RetiredRecords.empty())
+        {
+            return;
+        }
+
+        // 모든 Counter가 0인 것을 확인했다면, 이후에 시작한 읽기는 이미 교체된 Table만 볼 수 있음.
+        for (const ReaderCounter& counter : m_ReaderCounters)
+        {
+            if (counter.Count.load(std::memory_order_seq_cst) != 0)
+            {
+                return;
+            }
+        }
+
+        m_RetiredTables.clear();
+        m_RetiredRecords.clear();
+    }
+
+    AssetRegistry::ReaderCounter& AssetRegistry::GetReaderCounter() const
+    {
+        static thread_local const size_t counterIndex = std::hash<std::thread::id>{}(std::this_thread::get_id()) % ReaderCounterCount;
+        return m_ReaderCounters[counterIndex];
+    }
+
+    uint64_t AssetRegistry::MakeKey(entt::id_type type, entt::id_type id)
+    {
+        return (static_cast<uint64_t>(type) << 32) | static_cast<uint64_t>(id);
+    }
+
+    uint64_t AssetRegistry::HashKey(uint64_t key)
+    {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return key;
+    }
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+namespace Engine
+{
+    // 모든 Asset을 (Type, Id)로 관리하는 중앙 Registry.
+    // 읽기는 RCU 방식으로 Mutex 없이 수행되고, 삽입/교체/삭제만 Mutex로 직렬화됨.
+    // 읽기는 Reader Counter를 올리고 내리므로 Lock-Free이지만 Wait-Free는 아님.
+    // 교체되거나 삭제된 Record는 읽고 있는 Thread가 없을 때만 해제되므로, 읽기가 계속 겹치면 해제가 다음 Reclaim으로 미뤄질 수 있음.
+    // 이미 반환된 Handle은 이전 Asset을 계속 소유하므로 Hot-Reload로 교체된 이후에도 유효함.
+    // 내용의 Hash가 같고 실제 Byte도 같은 Asset은 하나의 Asset을 공유하고, 각 Id는 그 Asset의 Alias가 됨.
+    // Asset Type은 GetContentHash와 함께 Byte를 비교하는 HasSameContent를 제공해야 함.
+    class AssetRegistry
+    {
+    public:
+        struct AssetInfo
+        {
+            entt::id_type Id = 0;
+            uint64_t SizeInBytes = 0;
+            // 마지막으로 조회된 Access Epoch. 같은 Epoch 안의 순서는 구분하지 않음.
+            uint64_t LastAccess = 0;
+            bool bIsReferenced = false;
+        };
+
+        struct DeduplicationStats
+        {
+            uint32_t AssetCount = 0;
+            uint32_t DuplicateCount = 0;
+            uint64_t ResidentBytes = 0;
+            uint64_t SavedBytes = 0;
+        };
+
+    public:
+        AssetRegistry();
+        ~AssetRegistry();
+
+        AssetRegistry(const AssetRegistry&) = delete;
+        AssetRegistry& operator=(const AssetRegistry&) = delete;
+
+        template <typename Type>
+        entt::resource<Type> Find(const entt::id_type id) const
+        {
+            return entt::resource<Type>{std::static_pointer_cast<Type>(FindAsset(entt::type_hash<Type>::value(), id))};
+        }
+
+        // 같은 Id의 Asset이 이미 있다면 기존 Asset을, 같은 내용의 Asset이 있다면 그 Asset을 반환함.
+        template <typename Type>
+        entt::resource<Type> Insert(const entt::id_type id, std::shared_ptr<Type> asset, const uint64_t sizeInBytes, const uint64_t contentHash)
+        {
+            return entt::resource<Type>{std::static_pointer_cast<Type>(InsertAsset(entt::type_hash<Type>::value(), id, std::move(asset), sizeInBytes, contentHash, &HasSameContent<Type>, false))};
+        }
+
+        template <typename Type>
+        entt::resource<Type> Replace(const entt::id_type id, std::shared_ptr<Type> asset, const uint64_t sizeInBytes, const uint64_t contentHash)
+        {
+            return entt::resource<Type>{std::static_pointer_cast<Type>(InsertAsset(entt::type_hash<Type>::value(), id, std::move(asset), sizeInBytes, contentHash, &HasSameContent<Type>, true))};
+        }
+
+        // 해제된 메모리 크기를 반환함. 다른 Alias가 남아 있다면 Id만 제거되고 0을 반환함.
+        uint64_t RemoveIfUnreferenced(entt::id_type type, entt::id_type id);
+        std::vector<AssetInfo> GetAssets(entt::id_type type) const;
+        uint64_t GetResidentBytes(entt::id_type type) const;
+        DeduplicationStats GetDeduplicationStats(entt::id_type type) const;
+
+        // 교체된 Record와 Table 중 더 이상 읽는 Thread가 없는 것을 해제함.
+        void Reclaim();
+        // LRU에 쓰는 시각을 한 칸 올림. Application이 Frame마다 호출함.
+        void AdvanceAccessEpoch() { m_AccessEpoch.fetch_add(1, std::memory_order_relaxed); }
+
+    private:
+        using ContentComparer = bool (*)(const void* lhs, const void* rhs);
+
+        struct Record
+        {
+            entt::id_type Type = 0;
+            entt::id_type Id = 0;
+            // 강한 참조는 Content만 가지므로, 교체된 Record가 남아 있어도 참조 수가 늘지 않음.
+            std::weak_ptr<void> Asset;
+            uint64_t SizeInBytes = 0;
+            uint64_t ContentHash = 0;
+            mutable std::atomic<uint64_t> LastAccess = 0;
+        };
+
+        // 같은 내용을 가진 Record들이 공유하는 Asset. Registry 안에서 Asset을 소유하는 유일한 곳임.
+        struct Content
+        {
+            std::shared_ptr<void> Asset = nullptr;
+            uint64_t SizeInBytes = 0;
+            uint32_t AliasCount = 0;
+        };
+
+        struct TypeStats
+        {
+            uint32_t AssetCount = 0;
+            uint32_t DuplicateCount = 0;
+            uint64_t ResidentBytes = 0;
+            uint64_t LogicalBytes = 0;
+        };
+
+        // Open Addressing Table. 한 번 게시된 Table은 변경되지 않음.
+        struct Table
+        {
+            std::vector<const Record*> Slots;
+        };
+
+        struct alignas(64) ReaderCounter
+        {
+            std::atomic<uint32_t> Count = 0;
+        };
+
+        class ReadScope
+        {
+        public:
+            explicit ReadScope(ReaderCounter& counter);
+            ~ReadScope();
+
+        private:
+            ReaderCounter& m_Counter;
+        };
+
+    private:
+        std::shared_ptr<void> FindAsset(entt::id_type type, entt::id_type id) const;
+        std::shared_ptr<void> InsertAsset(entt::id_type type, entt::id_type id, std::shared_ptr<void> asset, uint64_t sizeInBytes, uint64_t contentHash,
+                                          ContentComparer isSameContent, bool bReplace);
+        uint64_t ReleaseRecordLocked(const Record& record);
+        const Content& FindContentLocked(const Record& record) const;
+        bool IsReferencedLocked(const Record& record) const;
+        void PublishTable();
+        void ReclaimLocked();
+        ReaderCounter& GetReaderCounter() const;
+
+        template <typename Type>
+        static bool HasSameContent(const void* lhs, const void* rhs)
+        {
+            return static_cast<const Type*>(lhs)->HasSameContent(*static_cast<const Type*>(rhs));
+        }
+
+        static uint64_t MakeKey(entt::id_type type, entt::id_type id);
+        static uint64_t HashKey(uint64_t key);
+
+    private:
+        static constexpr size_t ReaderCounterCount = 16;
+
+        std::atomic<const Table*> m_Table = nullptr;
+        mutable std::array<ReaderCounter, ReaderCounterCount> m_ReaderCounters{};
+        // 읽기는 Load만 하므로 여러 Thread가 조회해도 이 Cache Line에 쓰지 않음.
+        std::atomic<uint64_t> m_AccessEpoch = 0;
+
+        // 아래는 m_WriteMutex로 보호됨.
+        mutable std::mutex m_WriteMutex;
+        std::unique_ptr<Table> m_PublishedTable = nullptr;
+        std::unordered_map<uint64_t, std::unique_ptr<Record>> m_Records;
+        // Hash가 충돌한 다른 내용은 같은 Hash 아래에 따로 둠.
+        std::unordered_map<entt::id_type, std::unordered_map<uint64_t, std::vector<Content>>> m_Contents;
+        std::unordered_map<entt::id_type, TypeStats> m_TypeStats;
+        std::vector<std::unique_ptr<Table>> m_RetiredTables;
+        std::vector<std::unique_ptr<Record>> m_RetiredRecords;
+    };
+}
@@ -3,6 +3,7 @@
 
 #include <spdlog/sinks/msvc_sink.h>
 
+#include "AssetManager.h"
 #include "Engine.h"
 #include "Timer.h"
 
@@ -40,8 +41,15 @@ namespace Engine
         {
             m_Timer.Tick();
             glfwPollEvents();
+            m_Renderer.UpdateWorldPartition();
+            m_Renderer.GetScene().Update(static_cast<float>(m_Timer.GetDeltaSeconds()));
             Update();
+            AssetManager::GetRegistry().Reclaim();
+            AssetManager::GetRegistry().AdvanceAccessEpoch();
         }
+
+        // 종료하며 Resource를 해제하기 전에 진행 중인 Frame이 모두 끝나야 함.
+        m_Renderer.WaitForGPU();
     }
 
     void Application::Initialize()
@@ -111,6 +119,10 @@ namespace Engine
         if (m_ApplicationSpec.Width != width || m_ApplicationSpec.Height != height)
         {
             m_Renderer.WaitForGPU();
+            for (const auto& buffer : m_Renderer.m_SwapChainBuffers)
+            {
+                m_Renderer.m_ResourceStates.Unregister(buffer.Get());
+            }
             m_Renderer.m_SwapChainBuffers.clear();
             DXGI_SWAP_CHAIN_DESC swapChainDesc{};
             m_Renderer.m_SwapChain->GetDesc(&swapChainDesc);
@@ -124,7 +136,6 @@ namespace Engine
             m_Renderer.m_Viewport = CD3DX12_VIEWPORT(0.0f, 0.0f, static_cast<float>(m_Renderer.m_Width), static_cast<float>(m_Renderer.m_Height));
             m_Renderer.m_ScissorRect = CD3DX12_RECT(0, 0, static_cast<int32_t>(m_Renderer.m_Width), static_cast<int32_t>(m_Renderer.m_Height));
             m_Renderer.CreateRenderTarget(m_Renderer.m_Width, m_Renderer.m_Height);
-            m_Renderer.CreateSceneTextures(m_Renderer.m_Width, m_Renderer.m_Height);
         }
     }
 
@@ -0,0 +1,19 @@
+#pragma once
+
+// Engine의 다른 Header 없이 쓸 수 있도록 EG_CONFIRM만 따로 둠. Windows가 아닌 곳에서도 Build되어야 하는 Source는 이것만 Include함.
+#if defined(_MSC_VER)
+#define EG_DEBUG_BREAK() __debugbreak()
+#else
+#define EG_DEBUG_BREAK() __builtin_trap()
+#endif
+
+// Release에서도 식은 실행함. SUCCEEDED(device->Create...)처럼 식 자체가 필요한 작업인 경우가 많음.
+#ifdef _DEBUG
+#define EG_CONFIRM(x) \
+if(!(x))\
+{\
+EG_DEBUG_BREAK();\
+}
+#else
+#define EG_CONFIRM(x) (void)(x)
+#endif
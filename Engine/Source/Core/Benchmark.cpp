@@ -0,0 +1,1023 @@
+#include "EnginePCH.h"
+#include "Benchmark.h"
+
+#include <chrono>
+#include <format>
+#include <random>
+
+#include "Core.h"
+#include "AssetManager.h"
+#include "ECS/Components.h"
+#include "ECS/Prefab.h"
+#include "ECS/Scene.h"
+#include "ECS/TransformBatch.h"
+#include "Graphics/DescriptorAllocator.h"
+#include "Graphics/FrustumCulling.h"
+#include "Graphics/LightClusterGrid.h"
+#include "Graphics/OcclusionBuffer.h"
+#include "Graphics/RenderQueue.h"
+#include "Graphics/StagingPageAllocator.h"
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr size_t BenchmarkEntityCounts[] = {10'000, 100'000, 1'000'000};
+
+        // 한 번 실행하는 데 걸린 가장 짧은 시간을 반환함. 처리하는 Entity 수가 같도록 반복 횟수를 정함.
+        template <typename Function>
+        std::chrono::nanoseconds MeasureBestTime(size_t entityCount, Function&& function)
+        {
+            const size_t iterationCount = std::max<size_t>(3, 10'000'000 / entityCount);
+            std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+            for (size_t i = 0; i < iterationCount; ++i)
+            {
+                const auto startTime = std::chrono::steady_clock::now();
+                function();
+                bestTime = std::min(bestTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+            }
+            return bestTime;
+        }
+
+        double ToMilliseconds(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+        constexpr size_t ForestTreeCount = 50'000;
+        // Small String Optimization에 들어가지 않는 길이의 이름.
+        constexpr std::string_view TreeNodeNames[] = {"ForestTree_Trunk", "ForestTree_Branch_Left", "ForestTree_Branch_Right", "ForestTree_Canopy"};
+
+        // Component 배열과 이름 문자열이 차지하는 Byte 수. Sparse Set이나 Entity Storage는 포함하지 않음.
+        template <typename... Types>
+        size_t GetComponentBytes(const entt::registry& registry)
+        {
+            size_t bytes = ((registry.storage<Types>() ? registry.storage<Types>()->size() * sizeof(Types) : 0) + ...);
+            if (const auto* displayNames = registry.storage<DisplayNameComponent>())
+            {
+                const size_t inlineCapacity = std::string().capacity();
+                for (const auto [entity, displayName] : displayNames->each())
+                {
+                    bytes += displayName.Name.capacity() > inlineCapacity ? displayName.Name.capacity() + 1 : 0;
+                }
+            }
+            return bytes;
+        }
+
+        // Trunk 아래에 가지 두 개와 잎을 가진 나무. 가지와 잎은 Trunk의 자식임.
+        entt::entity CreateTree(Scene& scene, const TransformComponent& rootTransform)
+        {
+            entt::registry& registry = scene.GetRegistry();
+            const entt::entity trunk = registry.create();
+            registry.emplace<DisplayNameComponent>(trunk, std::string(TreeNodeNames[0]));
+            registry.emplace<TransformComponent>(trunk, rootTransform);
+            for (size_t i = 1; i < std::size(TreeNodeNames); ++i)
+            {
+                const entt::entity node = registry.create();
+                registry.emplace<DisplayNameComponent>(node, std::string(TreeNodeNames[i]));
+                registry.emplace<TransformComponent>(node, TransformComponent{.Position = {0.0f, static_cast<float>(i), 0.0f}});
+                scene.SetParent(node, trunk);
+            }
+            return trunk;
+        }
+
+        constexpr size_t BVHEntityCount = 100'000;
+        constexpr uint32_t BVHFrameCount = 60;
+        constexpr uint32_t BVHQueryCount = 1'000;
+        constexpr float BVHWorldSize = 2'000.0f;
+
+        // 한 변이 1인 Cube. Renderer 없이 Bounds와 Occlusion Buffer에서만 사용함.
+        AssetHandle<Mesh> AcquireBenchmarkCube()
+        {
+            using namespace entt::literals;
+            auto mesh = std::make_shared<Mesh>();
+            for (const float x : {-0.5f, 0.5f})
+            {
+                for (const float y : {-0.5f, 0.5f})
+                {
+                    for (const float z : {-0.5f, 0.5f})
+                    {
+                        mesh->Vertices.push_back({.Position = {x, y, z}});
+                    }
+                }
+            }
+            // Vertex Index는 x * 4 + y * 2 + z이며, 각 면의 네 Vertex를 둘레 순서로 나열함.
+            constexpr uint32_t faces[6][4] = {{0, 1, 3, 2}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 3, 7, 5}};
+            for (const auto& face : faces)
+            {
+                mesh->Indices.insert(mesh->Indices.end(), {face[0], face[1], face[2], face[0], face[2], face[3]});
+            }
+            DirectX::BoundingBox::CreateFromPoints(mesh->Bounds, mesh->Vertices.size(), &mesh->Vertices[0].Position, sizeof(Vertex));
+            return AssetManager::GetPool<Mesh>().Acquire("BenchmarkCube"_hs, entt::resource<Mesh>(mesh));
+        }
+
+        constexpr size_t CullingEntityCounts[] = {100'000, 1'000'000};
+        constexpr float CullingWorldSize = 2'000.0f;
+
+        constexpr uint32_t OcclusionOccluderCount = 2'000;
+        constexpr size_t OcclusionOccludeeCount = 100'000;
+
+        constexpr uint32_t ClusteredLightCounts[] = {8, 64, 256, 1024};
+        constexpr uint32_t ClusteredLightBuildCount = 100;
+
+        constexpr uint32_t RenderQueuePipelineCount = 4;
+        constexpr uint32_t RenderQueueMaterialCount = 64;
+        constexpr uint32_t RenderQueueMeshCount = 256;
+
+        // 앞의 Packet과 Pipeline 또는 Mesh가 다른 횟수. Renderer가 State를 바꿔야 하는 횟수와 같음.
+        std::pair<size_t, size_t> CountStateChanges(std::span<const DrawPacket> packets)
+        {
+            size_t pipelineChangeCount = 0;
+            size_t meshChangeCount = 0;
+            for (size_t i = 0; i < packets.size(); ++i)
+            {
+                pipelineChangeCount += i == 0 || RenderQueue::GetPipeline(packets[i].Key) != RenderQueue::GetPipeline(packets[i - 1].Key);
+                meshChangeCount += i == 0 || RenderQueue::GetMesh(packets[i].Key) != RenderQueue::GetMesh(packets[i - 1].Key);
+            }
+            return {pipelineChangeCount, meshChangeCount};
+        }
+
+        // Renderer처럼 State Key가 같은 연속된 Packet을 Instancing으로 묶었을 때의 Draw 수.
+        size_t CountInstancedDraws(std::span<const DrawPacket> packets)
+        {
+            size_t drawCount = 0;
+            for (size_t i = 0; i < packets.size(); ++i)
+            {
+                drawCount += i == 0 || RenderQueue::GetStateKey(packets[i].Key) != RenderQueue::GetStateKey(packets[i - 1].Key);
+            }
+            return drawCount;
+        }
+
+        // Renderer의 UploadManager와 같은 Page와 Batch 크기.
+        constexpr uint64_t StagingPageSize = 4 * 1024 * 1024;
+        constexpr uint64_t StagingMaxBatchSize = 32 * 1024 * 1024;
+        constexpr uint64_t StagingMaxInFlightBatchCount = 4;
+        constexpr uint32_t StagingLevelCount = 20;
+        constexpr uint32_t StagingMeshesPerLevel = 1'000;
+        constexpr uint32_t StagingGPULatency = 2;
+
+        constexpr uint32_t DescriptorBenchmarkCapacity = 16 * 1024;
+        constexpr size_t DescriptorChurnCount = 200'000;
+        constexpr size_t DescriptorSingleCount = 1'000'000;
+
+        constexpr size_t SpawnRepeatCount = 3;
+
+        struct SpawnTimes
+        {
+            std::chrono::nanoseconds Spawn = std::chrono::nanoseconds::max();
+            std::chrono::nanoseconds Destroy = std::chrono::nanoseconds::max();
+        };
+
+        // 빈 Scene에 Entity를 만들어 TransformComponent와 LightComponent를 넣은 뒤 모두 삭제함.
+        // Storage가 늘어나는 비용까지 포함하도록 매번 새 Scene을 사용하고, 가장 짧은 시간을 반환함.
+        template <typename Spawn, typename Destroy>
+        SpawnTimes MeasureSpawnTimes(Spawn&& spawn, Destroy&& destroy)
+        {
+            SpawnTimes bestTimes;
+            for (size_t i = 0; i < SpawnRepeatCount; ++i)
+            {
+                Scene scene;
+                const auto spawnStartTime = std::chrono::steady_clock::now();
+                std::vector<entt::entity> entities = spawn(scene);
+                const auto destroyStartTime = std::chrono::steady_clock::now();
+                destroy(scene, entities);
+                const auto endTime = std::chrono::steady_clock::now();
+
+                bestTimes.Spawn = std::min(bestTimes.Spawn, std::chrono::duration_cast<std::chrono::nanoseconds>(destroyStartTime - spawnStartTime));
+                bestTimes.Destroy = std::min(bestTimes.Destroy, std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - destroyStartTime));
+            }
+            return bestTimes;
+        }
+    }
+
+    namespace Benchmark
+    {
+        void RunTransformBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> positionDistribution(-1000.0f, 1000.0f);
+            std::uniform_real_distribution<float> rotationDistribution(-180.0f, 180.0f);
+            std::uniform_real_distribution<float> scaleDistribution(0.5f, 2.0f);
+
+            spdlog::info("Transform benchmark (best path: {})", TransformBatch::GetPathName(TransformBatch::GetBestPath()));
+            spdlog::info("{:>10} {:>10} {:>12} {:>14} {:>10}", "Entities", "Path", "Time(ms)", "ns/Entity", "Speedup");
+            for (const size_t entityCount : BenchmarkEntityCounts)
+            {
+                std::vector<TransformComponent> transforms(entityCount);
+                TransformSoA transformSoA;
+                transformSoA.Resize(entityCount);
+                for (size_t i = 0; i < entityCount; ++i)
+                {
+                    TransformComponent& transform = transforms[i];
+                    transform.Position = {positionDistribution(random), positionDistribution(random), positionDistribution(random)};
+                    transform.Rotation = {rotationDistribution(random), rotationDistribution(random), rotationDistribution(random)};
+                    transform.Scale = {scaleDistribution(random), scaleDistribution(random), scaleDistribution(random)};
+                }
+
+                std::vector<DirectX::XMFLOAT4X4> matrices(entityCount);
+                const auto logResult = [entityCount](std::string_view pathName, std::chrono::nanoseconds time, std::chrono::nanoseconds baseTime)
+                {
+                    spdlog::info("{:>10} {:>10} {:>12.3f} {:>14.2f} {:>9.2f}x", entityCount, pathName, ToMilliseconds(time),
+                                 static_cast<double>(time.count()) / static_cast<double>(entityCount),
+                                 static_cast<double>(baseTime.count()) / static_cast<double>(time.count()));
+                };
+
+                const std::chrono::nanoseconds simpleMathTime = MeasureBestTime(entityCount, [&]
+                {
+                    for (size_t i = 0; i < entityCount; ++i)
+                    {
+                        matrices[i] = transforms[i].GetLocalMatrix();
+                    }
+                });
+                logResult("SimpleMath", simpleMathTime, simpleMathTime);
+
+                // Component는 AoS로 저장되므로 Scene::UpdateWorldTransformRange처럼 매번 성분별 배열로 모은 뒤 계산해야 함.
+                // 각 Path의 시간에는 이 Gather가 포함되며, Gather만의 시간도 따로 출력함.
+                const auto gather = [&]
+                {
+                    for (size_t i = 0; i < entityCount; ++i)
+                    {
+                        transformSoA.Set(i, transforms[i]);
+                    }
+                };
+                const std::chrono::nanoseconds gatherTime = MeasureBestTime(entityCount, gather);
+                logResult("Gather", gatherTime, simpleMathTime);
+
+                for (const TransformBatch::Path path : {TransformBatch::Path::Scalar, TransformBatch::Path::SSE, TransformBatch::Path::AVX2})
+                {
+                    if (path == TransformBatch::Path::AVX2 && TransformBatch::GetBestPath() != TransformBatch::Path::AVX2)
+                    {
+                        continue;
+                    }
+
+                    const std::chrono::nanoseconds batchTime = MeasureBestTime(entityCount, [&]
+                    {
+                        gather();
+                        TransformBatch::Compose(path, transformSoA, 0, entityCount, matrices.data());
+                    });
+                    logResult(TransformBatch::GetPathName(path), batchTime, simpleMathTime);
+                }
+            }
+        }
+
+        void RunEntitySpawnBenchmark()
+        {
+            const auto toEntitiesPerSecond = [](size_t entityCount, std::chrono::nanoseconds time)
+            {
+                return static_cast<double>(entityCount) / std::chrono::duration<double>(time).count() / 1'000'000.0;
+            };
+
+            spdlog::info("Entity spawn benchmark");
+            spdlog::info("{:>10} {:>10} {:>12} {:>14} {:>12} {:>14}", "Entities", "Path", "Spawn(ms)", "Spawn(M/s)", "Destroy(ms)", "Destroy(M/s)");
+            for (const size_t entityCount : BenchmarkEntityCounts)
+            {
+                const auto logResult = [&](std::string_view pathName, const SpawnTimes& times)
+                {
+                    spdlog::info("{:>10} {:>10} {:>12.3f} {:>14.2f} {:>12.3f} {:>14.2f}", entityCount, pathName,
+                                 ToMilliseconds(times.Spawn), toEntitiesPerSecond(entityCount, times.Spawn),
+                                 ToMilliseconds(times.Destroy), toEntitiesPerSecond(entityCount, times.Destroy));
+                };
+
+                const SpawnTimes singleTimes = MeasureSpawnTimes([entityCount](Scene& scene)
+                {
+                    entt::registry& registry = scene.GetRegistry();
+                    std::vector<entt::entity> entities;
+                    for (size_t i = 0; i < entityCount; ++i)
+                    {
+                        const entt::entity entity = registry.create();
+                        scene.AddComponentToEntity<TransformComponent>(entity);
+                        scene.AddComponentToEntity<LightComponent>(entity);
+                        entities.push_back(entity);
+                    }
+                    return entities;
+                }, [](Scene& scene, const std::vector<entt::entity>& entities)
+                {
+                    for (const entt::entity entity : entities)
+                    {
+                        scene.GetRegistry().destroy(entity);
+                    }
+                });
+                logResult("Single", singleTimes);
+
+                const SpawnTimes bulkTimes = MeasureSpawnTimes([entityCount](Scene& scene)
+                {
+                    std::vector<entt::entity> entities = scene.SpawnEntities(entityCount);
+                    scene.AddComponents<TransformComponent>(entities);
+                    scene.AddComponents<LightComponent>(entities);
+                    return entities;
+                }, [](Scene& scene, const std::vector<entt::entity>& entities)
+                {
+                    scene.DestroyEntities(entities);
+                });
+                logResult("Bulk", bulkTimes);
+            }
+        }
+
+        void RunPrefabBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> positionDistribution(-1000.0f, 1000.0f);
+            std::vector<TransformComponent> treeTransforms(ForestTreeCount);
+            for (TransformComponent& transform : treeTransforms)
+            {
+                transform.Position = {positionDistribution(random), 0.0f, positionDistribution(random)};
+            }
+
+            const auto logResult = [](std::string_view pathName, std::chrono::nanoseconds time, const Scene& scene)
+            {
+                const size_t bytes = GetComponentBytes<TransformComponent, WorldTransformComponent, RelationshipComponent, DisplayNameComponent, PrefabInstanceComponent>(scene.GetRegistry());
+                spdlog::info("{:>10} {:>10} {:>12.3f} {:>14.2f} {:>14.2f}", ForestTreeCount, pathName, ToMilliseconds(time),
+                             static_cast<double>(bytes) / (1024.0 * 1024.0), static_cast<double>(bytes) / static_cast<double>(ForestTreeCount));
+            };
+
+            spdlog::info("Prefab benchmark ({} nodes per tree)", std::size(TreeNodeNames));
+            spdlog::info("{:>10} {:>10} {:>12} {:>14} {:>14}", "Trees", "Path", "Time(ms)", "Memory(MB)", "Bytes/Tree");
+            {
+                Scene scene;
+                const auto startTime = std::chrono::steady_clock::now();
+                for (const TransformComponent& transform : treeTransforms)
+                {
+                    CreateTree(scene, transform);
+                }
+                logResult("Copy", std::chrono::steady_clock::now() - startTime, scene);
+            }
+            {
+                Scene scene;
+                const entt::entity templateTree = CreateTree(scene, {});
+                const uint32_t prefabIndex = scene.CreatePrefab(templateTree);
+                scene.DestroyEntities(std::vector<entt::entity>{templateTree});
+
+                const auto startTime = std::chrono::steady_clock::now();
+                const std::vector<entt::entity> trees = scene.InstantiatePrefab(prefabIndex, treeTransforms);
+                logResult("Prefab", std::chrono::steady_clock::now() - startTime, scene);
+
+                // 이름을 바꾼 Instance만 자신의 이름을 가짐.
+                scene.OverrideDisplayName(trees.front()).Name = "ForestTree_Overridden";
+                if (scene.GetDisplayName(trees.front()) != "ForestTree_Overridden" || scene.GetDisplayName(trees.back()) != TreeNodeNames[0])
+                {
+                    spdlog::error("Prefab benchmark: display name override is not isolated");
+                }
+            }
+        }
+
+        void RunSceneBVHBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> positionDistribution(-BVHWorldSize * 0.5f, BVHWorldSize * 0.5f);
+            std::uniform_real_distribution<float> velocityDistribution(-0.2f, 0.2f);
+            std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+
+            const AssetHandle<Mesh> cube = AcquireBenchmarkCube();
+            Scene scene;
+            const std::vector<entt::entity> entities = scene.SpawnEntities(BVHEntityCount);
+            std::vector<TransformComponent> transforms(BVHEntityCount);
+            std::vector<DirectX::SimpleMath::Vector3> velocities(BVHEntityCount);
+            for (size_t i = 0; i < BVHEntityCount; ++i)
+            {
+                transforms[i].Position = {positionDistribution(random), positionDistribution(random) * 0.05f, positionDistribution(random)};
+                velocities[i] = {velocityDistribution(random), velocityDistribution(random), velocityDistribution(random)};
+            }
+            scene.AddComponents<TransformComponent>(entities, transforms.begin());
+            // Benchmark Scene에는 Release하는 Signal이 없으므로 참조 횟수를 올리지 않음.
+            scene.AddComponents<MeshRenderComponent>(entities, MeshRenderComponent{.Mesh = cube});
+
+            const auto buildStartTime = std::chrono::steady_clock::now();
+            scene.UpdateWorldTransforms();
+            const std::chrono::nanoseconds buildTime = std::chrono::steady_clock::now() - buildStartTime;
+            const SceneBVH& bvh = scene.GetBVH();
+
+            spdlog::info("Scene BVH benchmark: {} entities, initial build {:.3f} ms, height {}, cost {:.2f}",
+                         BVHEntityCount, ToMilliseconds(buildTime), bvh.GetStats().Height, bvh.ComputeCost());
+
+            // 모든 Entity가 매 Frame 조금씩 움직임. TransformComponent 갱신과 World Matrix 계산도 포함됨.
+            double totalUpdateMilliseconds = 0.0;
+            double maxUpdateMilliseconds = 0.0;
+            uint64_t reinsertedCount = 0;
+            entt::registry& registry = scene.GetRegistry();
+            for (uint32_t frame = 0; frame < BVHFrameCount; ++frame)
+            {
+                for (size_t i = 0; i < BVHEntityCount; ++i)
+                {
+                    registry.patch<TransformComponent>(entities[i], [&](TransformComponent& transform) { transform.Position += velocities[i]; });
+                }
+
+                const auto startTime = std::chrono::steady_clock::now();
+                scene.UpdateWorldTransforms();
+                const double updateMilliseconds = ToMilliseconds(std::chrono::steady_clock::now() - startTime);
+                totalUpdateMilliseconds += updateMilliseconds;
+                maxUpdateMilliseconds = std::max(maxUpdateMilliseconds, updateMilliseconds);
+                reinsertedCount += bvh.GetStats().ReinsertedLeafCount;
+            }
+            spdlog::info("{:>10} {:>12} {:>12} {:>14} {:>10} {:>10}", "Frames", "Avg(ms)", "Max(ms)", "Reinserted/F", "Height", "Rebuilds");
+            spdlog::info("{:>10} {:>12.3f} {:>12.3f} {:>14} {:>10} {:>10}", BVHFrameCount, totalUpdateMilliseconds / BVHFrameCount, maxUpdateMilliseconds,
+                         reinsertedCount / BVHFrameCount, bvh.GetStats().Height, bvh.GetStats().RebuildCount);
+
+            const auto randomPoint = [&]
+            {
+                return DirectX::SimpleMath::Vector3{positionDistribution(random), 0.0f, positionDistribution(random)};
+            };
+            std::vector<entt::entity> results;
+            const auto measureQuery = [&](std::string_view queryName, auto&& query)
+            {
+                size_t resultCount = 0;
+                const auto startTime = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < BVHQueryCount; ++i)
+                {
+                    results.clear();
+                    query();
+                    resultCount += results.size();
+                }
+                const double microseconds = ToMilliseconds(std::chrono::steady_clock::now() - startTime) * 1'000.0 / BVHQueryCount;
+                spdlog::info("{:>10} {:>14.2f} {:>14.1f}", queryName, microseconds, static_cast<double>(resultCount) / BVHQueryCount);
+            };
+
+            spdlog::info("{:>10} {:>14} {:>14}", "Query", "Time(us)", "Results");
+            measureQuery("Frustum", [&]
+            {
+                const DirectX::SimpleMath::Matrix view = DirectX::SimpleMath::Matrix::CreateLookAt(randomPoint() + DirectX::SimpleMath::Vector3(0.0f, 10.0f, 0.0f), randomPoint(), DirectX::SimpleMath::Vector3::UnitY);
+                DirectX::BoundingFrustum frustum(DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(DirectX::XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f), true);
+                frustum.Transform(frustum, view.Invert());
+                bvh.QueryFrustum(frustum, results);
+            });
+            measureQuery("Sphere", [&] { bvh.QuerySphere(DirectX::BoundingSphere(randomPoint(), 50.0f), results); });
+            measureQuery("Box", [&]
+            {
+                const DirectX::SimpleMath::Vector3 center = randomPoint();
+                bvh.QueryBox({center - DirectX::SimpleMath::Vector3(40.0f), center + DirectX::SimpleMath::Vector3(40.0f)}, results);
+            });
+            measureQuery("Ray", [&]
+            {
+                DirectX::SimpleMath::Vector3 direction = randomPoint() - DirectX::SimpleMath::Vector3(0.0f, 5.0f, 0.0f);
+                direction.Normalize();
+                entt::entity hitEntity = entt::null;
+                float hitDistance = 0.0f;
+                if (bvh.RayCast({0.0f, 5.0f, 0.0f}, direction, BVHWorldSize, hitEntity, hitDistance))
+                {
+                    results.push_back(hitEntity);
+                }
+            });
+
+            // Box Query 결과를 모든 Entity와 직접 비교하여 확인함.
+            bool bHasFailed = false;
+            for (uint32_t i = 0; i < 16 && !bHasFailed; ++i)
+            {
+                const DirectX::SimpleMath::Vector3 center = randomPoint();
+                const AABB box{center - DirectX::SimpleMath::Vector3(40.0f), center + DirectX::SimpleMath::Vector3(40.0f)};
+                results.clear();
+                bvh.QueryBox(box, results);
+                std::sort(results.begin(), results.end());
+
+                std::vector<entt::entity> expected;
+                for (const entt::entity entity : entities)
+                {
+                    if (box.Intersects(*bvh.GetBounds(entity)))
+                    {
+                        expected.push_back(entity);
+                    }
+                }
+                std::sort(expected.begin(), expected.end());
+                bHasFailed = results != expected;
+            }
+
+            AssetManager::Release(cube);
+            if (bHasFailed)
+            {
+                spdlog::error("Scene BVH benchmark: box query does not match brute force");
+            }
+            else
+            {
+                spdlog::info("Scene BVH benchmark: passed");
+            }
+        }
+
+        void RunFrustumCullingBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> positionDistribution(-CullingWorldSize * 0.5f, CullingWorldSize * 0.5f);
+            std::uniform_real_distribution<float> extentDistribution(0.5f, 4.0f);
+
+            // Renderer와 같은 방식으로 원점 근처에서 -Z를 바라보는 Camera의 View-Projection을 만듦.
+            const DirectX::SimpleMath::Matrix camera = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 10.0f, 0.0f);
+            const DirectX::SimpleMath::Matrix projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(DirectX::XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+            const FrustumCulling::Planes planes = FrustumCulling::ExtractPlanes(camera.Invert() * projection);
+
+            spdlog::info("Frustum culling benchmark (best path: {}, workers: {})", TransformBatch::GetPathName(TransformBatch::GetBestPath()),
+                         Core::GetJobSystem().GetWorkerCount());
+            spdlog::info("{:>10} {:>10} {:>12} {:>14} {:>10} {:>10}", "Entities", "Path", "Time(ms)", "ns/Entity", "Speedup", "Visible");
+            bool bHasFailed = false;
+            for (const size_t entityCount : CullingEntityCounts)
+            {
+                CullingBoundsSoA bounds;
+                bounds.Resize(entityCount);
+                for (size_t i = 0; i < entityCount; ++i)
+                {
+                    const DirectX::SimpleMath::Vector3 center{positionDistribution(random), positionDistribution(random) * 0.05f, positionDistribution(random)};
+                    const DirectX::SimpleMath::Vector3 extents{extentDistribution(random), extentDistribution(random), extentDistribution(random)};
+                    bounds.Set(i, DirectX::BoundingBox(center, extents));
+                }
+
+                std::vector<uint32_t> visibleIndices(entityCount);
+                const auto logResult = [entityCount](std::string_view pathName, std::chrono::nanoseconds time, std::chrono::nanoseconds baseTime, size_t visibleCount)
+                {
+                    spdlog::info("{:>10} {:>10} {:>12.3f} {:>14.2f} {:>9.2f}x {:>10}", entityCount, pathName, ToMilliseconds(time),
+                                 static_cast<double>(time.count()) / static_cast<double>(entityCount),
+                                 static_cast<double>(baseTime.count()) / static_cast<double>(time.count()), visibleCount);
+                };
+
+                // 모든 Path가 Scalar와 같은 Index를 같은 순서로 내놓아야 함.
+                size_t expectedCount = 0;
+                const std::chrono::nanoseconds scalarTime = MeasureBestTime(entityCount, [&]
+                {
+                    expectedCount = FrustumCulling::Cull(TransformBatch::Path::Scalar, planes, bounds, 0, entityCount, visibleIndices.data());
+                });
+                const std::vector<uint32_t> expectedIndices(visibleIndices.begin(), visibleIndices.begin() + expectedCount);
+                logResult("Scalar", scalarTime, scalarTime, expectedCount);
+
+                for (const TransformBatch::Path path : {TransformBatch::Path::SSE, TransformBatch::Path::AVX2})
+                {
+                    if (path == TransformBatch::Path::AVX2 && TransformBatch::GetBestPath() != TransformBatch::Path::AVX2)
+                    {
+                        continue;
+                    }
+
+                    size_t visibleCount = 0;
+                    const std::chrono::nanoseconds time = MeasureBestTime(entityCount, [&]
+                    {
+                        visibleCount = FrustumCulling::Cull(path, planes, bounds, 0, entityCount, visibleIndices.data());
+                    });
+                    bHasFailed |= !std::equal(expectedIndices.begin(), expectedIndices.end(), visibleIndices.begin(), visibleIndices.begin() + visibleCount);
+                    logResult(TransformBatch::GetPathName(path), time, scalarTime, visibleCount);
+                }
+
+                std::vector<uint32_t> parallelIndices;
+                const std::chrono::nanoseconds parallelTime = MeasureBestTime(entityCount, [&]
+                {
+                    FrustumCulling::CullParallel(Core::GetJobSystem(), planes, bounds, parallelIndices);
+                });
+                bHasFailed |= parallelIndices != expectedIndices;
+                logResult("Parallel", parallelTime, scalarTime, parallelIndices.size());
+            }
+
+            if (bHasFailed)
+            {
+                spdlog::error("Frustum culling benchmark: visible indices do not match scalar path");
+            }
+            else
+            {
+                spdlog::info("Frustum culling benchmark: passed");
+            }
+        }
+
+        void RunOcclusionCullingBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+            const auto randomRange = [&](float min, float max) { return min + (max - min) * unitDistribution(random); };
+
+            const AssetHandle<Mesh> cube = AcquireBenchmarkCube();
+            const Mesh& cubeMesh = AssetManager::GetPool<Mesh>().Get(cube);
+            const DirectX::SimpleMath::Matrix camera = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 2.0f, 0.0f);
+            const DirectX::SimpleMath::Matrix projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(DirectX::XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+            const DirectX::SimpleMath::Matrix viewProjection = camera.Invert() * projection;
+
+            // SimpleMath의 Projection은 오른손 좌표계이므로 Camera는 -Z를 바라봄. Camera 앞에 벽을 흩어 놓고, Occludee는 그 앞뒤로 넓게 놓음.
+            std::vector<DirectX::SimpleMath::Matrix> occluderWorlds(OcclusionOccluderCount);
+            for (DirectX::SimpleMath::Matrix& world : occluderWorlds)
+            {
+                world = DirectX::SimpleMath::Matrix::CreateScale(randomRange(8.0f, 20.0f), randomRange(4.0f, 12.0f), 1.0f)
+                    * DirectX::SimpleMath::Matrix::CreateRotationY(randomRange(-0.5f, 0.5f))
+                    * DirectX::SimpleMath::Matrix::CreateTranslation(randomRange(-300.0f, 300.0f), randomRange(0.0f, 4.0f), randomRange(-400.0f, -30.0f));
+            }
+            CullingBoundsSoA occludeeBounds;
+            occludeeBounds.Resize(OcclusionOccludeeCount);
+            for (size_t i = 0; i < OcclusionOccludeeCount; ++i)
+            {
+                occludeeBounds.Set(i, DirectX::BoundingBox({randomRange(-600.0f, 600.0f), randomRange(0.0f, 5.0f), randomRange(-800.0f, -5.0f)},
+                                                           {randomRange(0.5f, 2.0f), randomRange(0.5f, 2.0f), randomRange(0.5f, 2.0f)}));
+            }
+
+            JobSystem& jobSystem = Core::GetJobSystem();
+            std::vector<uint32_t> candidateIndices;
+            FrustumCulling::CullParallel(jobSystem, FrustumCulling::ExtractPlanes(viewProjection), occludeeBounds, candidateIndices);
+
+            const auto rasterize = [&](OcclusionBuffer& buffer, JobSystem& rasterizeJobSystem)
+            {
+                buffer.Begin(viewProjection);
+                for (const DirectX::SimpleMath::Matrix& world : occluderWorlds)
+                {
+                    buffer.AddOccluder(world, cubeMesh.Vertices, cubeMesh.Indices);
+                }
+                buffer.Rasterize(rasterizeJobSystem);
+            };
+
+            OcclusionBuffer buffer;
+            const size_t triangleCount = OcclusionOccluderCount * cubeMesh.Indices.size() / 3;
+            const std::chrono::nanoseconds rasterizeTime = MeasureBestTime(triangleCount, [&] { rasterize(buffer, jobSystem); });
+            std::vector<uint32_t> visibleIndices;
+            const std::chrono::nanoseconds testTime = MeasureBestTime(candidateIndices.size(), [&]
+            {
+                buffer.FilterVisible(jobSystem, occludeeBounds, candidateIndices, visibleIndices);
+            });
+
+            const OcclusionBuffer::Stats& stats = buffer.GetStats();
+            spdlog::info("Occlusion culling benchmark: {}x{} depth, {} occluders ({} triangles, {} binned), {} workers",
+                         buffer.GetWidth(), buffer.GetHeight(), stats.OccluderCount, stats.TriangleCount, stats.BinnedTriangleCount, jobSystem.GetWorkerCount());
+            spdlog::info("{:>12} {:>12} {:>12}", "Stage", "Time(ms)", "Count");
+            spdlog::info("{:>12} {:>12.3f} {:>12}", "Rasterize", ToMilliseconds(rasterizeTime), stats.TriangleCount);
+            spdlog::info("{:>12} {:>12.3f} {:>12}", "HiZ Test", ToMilliseconds(testTime), candidateIndices.size());
+            spdlog::info("{:>12} {:>12} {:>12}", "Visible", "", visibleIndices.size());
+
+            // Worker 수가 달라도 Depth와 결과가 Bit 단위로 같아야 함.
+            JobSystem singleWorkerJobSystem(1);
+            OcclusionBuffer referenceBuffer;
+            rasterize(referenceBuffer, singleWorkerJobSystem);
+            std::vector<uint32_t> referenceIndices;
+            referenceBuffer.FilterVisible(singleWorkerJobSystem, occludeeBounds, candidateIndices, referenceIndices);
+            const bool bIsDeterministic = referenceBuffer.GetDepth() == buffer.GetDepth() && referenceIndices == visibleIndices;
+
+            // 벽 바로 뒤의 상자는 가려지고, 벽 앞이나 옆의 상자는 보여야 함.
+            OcclusionBuffer wallBuffer;
+            wallBuffer.Begin(viewProjection);
+            wallBuffer.AddOccluder(DirectX::SimpleMath::Matrix::CreateScale(10.0f, 10.0f, 1.0f) * DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 2.0f, -20.0f),
+                                   cubeMesh.Vertices, cubeMesh.Indices);
+            wallBuffer.Rasterize(jobSystem);
+            const DirectX::SimpleMath::Vector3 boxExtents(1.0f);
+            const bool bIsCorrect = !wallBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -40.0f}, boxExtents))
+                && wallBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -10.0f}, boxExtents))
+                && wallBuffer.IsVisible(DirectX::BoundingBox({30.0f, 2.0f, -40.0f}, boxExtents));
+
+            AssetManager::Release(cube);
+            if (!bIsDeterministic)
+            {
+                spdlog::error("Occlusion culling benchmark: result depends on worker count");
+            }
+            else if (!bIsCorrect)
+            {
+                spdlog::error("Occlusion culling benchmark: wall test failed");
+            }
+            else
+            {
+                spdlog::info("Occlusion culling benchmark: passed");
+            }
+        }
+
+        void RunClusteredLightingBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+            const auto randomRange = [&](float min, float max) { return min + (max - min) * unitDistribution(random); };
+
+            // Renderer와 같은 Projection으로 -Z를 바라보는 Camera 앞에 Light를 흩어 놓음.
+            constexpr float nearPlane = 0.1f;
+            constexpr float farPlane = 1000.0f;
+            const DirectX::SimpleMath::Matrix view = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, -2.0f, 0.0f);
+            const DirectX::SimpleMath::Matrix projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(DirectX::XMConvertToRadians(60.0f), 16.0f / 9.0f, nearPlane, farPlane);
+
+            LightClusterGrid grid;
+            JobSystem& jobSystem = Core::GetJobSystem();
+            spdlog::info("Clustered lighting benchmark: {}x{}x{} clusters, {} workers", grid.GetSettings().ClusterCountX, grid.GetSettings().ClusterCountY,
+                         grid.GetSettings().ClusterCountZ, jobSystem.GetWorkerCount());
+            spdlog::info("{:>8} {:>12} {:>12} {:>14} {:>14}", "Lights", "Build(ms)", "Indices", "Avg/Cluster", "Max/Cluster");
+            bool bHasFailed = false;
+            for (const uint32_t lightCount : ClusteredLightCounts)
+            {
+                std::vector<ShaderLight> lights(lightCount);
+                for (ShaderLight& light : lights)
+                {
+                    light.Type = unitDistribution(random) < 0.7f ? LightType::Point : LightType::Spot;
+                    light.Position = {randomRange(-150.0f, 150.0f), randomRange(0.0f, 10.0f), randomRange(-300.0f, 0.0f)};
+                    light.Range = randomRange(2.0f, 15.0f);
+                    light.Color = {1.0f, 1.0f, 1.0f};
+                    light.Direction = DirectX::SimpleMath::Vector3(randomRange(-1.0f, 1.0f), -1.0f, randomRange(-1.0f, 1.0f));
+                    light.Direction.Normalize();
+                    light.CosOuterCone = std::cos(DirectX::XMConvertToRadians(randomRange(10.0f, 70.0f)));
+                    light.CosInnerCone = light.CosOuterCone;
+                }
+
+                std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+                for (uint32_t i = 0; i < ClusteredLightBuildCount; ++i)
+                {
+                    const auto startTime = std::chrono::steady_clock::now();
+                    grid.Build(jobSystem, view, projection, nearPlane, farPlane, lights);
+                    bestTime = std::min<std::chrono::nanoseconds>(bestTime, std::chrono::steady_clock::now() - startTime);
+                }
+
+                const LightClusterGrid::Stats& stats = grid.GetStats();
+                spdlog::info("{:>8} {:>12.3f} {:>12} {:>14.2f} {:>14}", lightCount, ToMilliseconds(bestTime), stats.IndexCount,
+                             stats.OccupiedClusterCount > 0 ? static_cast<double>(stats.IndexCount) / stats.OccupiedClusterCount : 0.0, stats.MaxLightsPerCluster);
+
+                // 모든 Cluster의 목록을 모든 Light와 직접 검사한 결과와 비교함.
+                std::vector<uint32_t> expected;
+                for (uint32_t cluster = 0; cluster < grid.GetClusterCount() && !bHasFailed; ++cluster)
+                {
+                    expected.clear();
+                    for (uint32_t i = 0; i < lightCount; ++i)
+                    {
+                        DirectX::SimpleMath::Vector3 center;
+                        float radius = 0.0f;
+                        if (LightClusterGrid::ComputeViewBoundingSphere(lights[i], view, center, radius) && grid.IntersectsCluster(cluster, center, radius))
+                        {
+                            expected.push_back(i);
+                        }
+                    }
+
+                    const LightClusterGrid::ClusterRange& range = grid.GetClusters()[cluster];
+                    const auto first = grid.GetLightIndices().begin() + range.Offset;
+                    bHasFailed = !std::equal(expected.begin(), expected.end(), first, first + range.Count);
+                }
+            }
+
+            if (bHasFailed)
+            {
+                spdlog::error("Clustered lighting benchmark: cluster light lists do not match brute force");
+            }
+            else
+            {
+                spdlog::info("Clustered lighting benchmark: passed");
+            }
+        }
+
+        void RunRenderQueueBenchmark()
+        {
+            std::mt19937 random(42);
+            std::uniform_int_distribution<uint32_t> pipelineDistribution(0, RenderQueuePipelineCount - 1);
+            std::uniform_int_distribution<uint32_t> materialDistribution(0, RenderQueueMaterialCount - 1);
+            std::uniform_int_distribution<uint32_t> meshDistribution(1, RenderQueueMeshCount);
+            std::uniform_real_distribution<float> depthDistribution(0.1f, 1'000.0f);
+
+            JobSystem& jobSystem = Core::GetJobSystem();
+            spdlog::info("Render queue benchmark: {} pipelines, {} materials, {} meshes, {} workers", RenderQueuePipelineCount, RenderQueueMaterialCount,
+                         RenderQueueMeshCount, jobSystem.GetWorkerCount());
+            spdlog::info("{:>10} {:>14} {:>14} {:>9} {:>8} {:>22} {:>22} {:>16}", "Packets", "Radix(ms)", "StableSort(ms)", "Speedup", "Passes", "Pipeline Changes",
+                         "Mesh Changes", "Instanced Draws");
+            bool bHasFailed = false;
+            for (const size_t packetCount : BenchmarkEntityCounts)
+            {
+                // Scene을 돌며 모은 것처럼 Draw 순서는 State와 관계가 없음.
+                std::vector<DrawPacket> packets(packetCount);
+                for (size_t i = 0; i < packetCount; ++i)
+                {
+                    packets[i].Key = RenderQueue::MakeKey(RenderQueue::Pass::Opaque, pipelineDistribution(random), materialDistribution(random), meshDistribution(random),
+                                                          RenderQueue::QuantizeDepth(depthDistribution(random), 0.1f, 1'000.0f));
+                    packets[i].Payload = static_cast<uint32_t>(i);
+                }
+
+                RenderQueue queue;
+                const std::chrono::nanoseconds radixTime = MeasureBestTime(packetCount, [&]
+                {
+                    queue.Clear();
+                    for (const DrawPacket& packet : packets)
+                    {
+                        queue.Push(packet.Key, packet.Payload);
+                    }
+                    queue.Sort(jobSystem);
+                });
+
+                std::vector<DrawPacket> expected;
+                const std::chrono::nanoseconds stableSortTime = MeasureBestTime(packetCount, [&]
+                {
+                    expected = packets;
+                    std::stable_sort(expected.begin(), expected.end(), [](const DrawPacket& a, const DrawPacket& b) { return a.Key < b.Key; });
+                });
+
+                // 안정 정렬이므로 Payload 순서까지 std::stable_sort와 같아야 함.
+                const std::span<const DrawPacket> sorted = queue.GetPackets();
+                bHasFailed |= !std::equal(sorted.begin(), sorted.end(), expected.begin(), expected.end(),
+                                          [](const DrawPacket& a, const DrawPacket& b) { return a.Key == b.Key && a.Payload == b.Payload; });
+
+                const auto [unsortedPipelineChanges, unsortedMeshChanges] = CountStateChanges(packets);
+                const auto [sortedPipelineChanges, sortedMeshChanges] = CountStateChanges(sorted);
+                spdlog::info("{:>10} {:>14.3f} {:>14.3f} {:>8.2f}x {:>8} {:>22} {:>22} {:>16}", packetCount, ToMilliseconds(radixTime), ToMilliseconds(stableSortTime),
+                             ToMilliseconds(stableSortTime) / ToMilliseconds(radixTime), queue.GetStats().RadixPassCount,
+                             std::format("{} -> {}", unsortedPipelineChanges, sortedPipelineChanges), std::format("{} -> {}", unsortedMeshChanges, sortedMeshChanges),
+                             CountInstancedDraws(sorted));
+            }
+
+            if (bHasFailed)
+            {
+                spdlog::error("Render queue benchmark: radix sort result differs from std::stable_sort");
+            }
+            else
+            {
+                spdlog::info("Render queue benchmark: passed");
+            }
+        }
+
+        void RunStagingUploadBenchmark()
+        {
+            // UploadManager처럼 Mesh마다 Vertex와 Index Buffer를 Page에 할당하고, Batch가 StagingMaxBatchSize를 넘거나 Level을 다 불러오면 Submit함.
+            // 가짜 GPU는 Batch를 StagingGPULatency번의 Submit 뒤에 완료하며, 진행 중인 Batch가 너무 많으면 가장 오래된 Batch를 기다린 것으로 침.
+            struct LiveAllocation
+            {
+                uint64_t FenceValue = 0;
+                uint32_t Page = 0;
+                uint64_t Offset = 0;
+                uint64_t Size = 0;
+            };
+
+            std::mt19937 random(42);
+            std::uniform_int_distribution<uint64_t> vertexCountDistribution(64, 32 * 1024);
+            std::uniform_int_distribution<uint32_t> percentDistribution(0, 99);
+            constexpr uint64_t vertexSize = 32;
+
+            StagingPageAllocator pages(StagingPageSize);
+            std::vector<LiveAllocation> liveAllocations;
+            std::deque<std::pair<uint64_t, uint64_t>> inFlightBatches;
+            uint64_t inFlightSize = 0;
+            uint64_t completedFenceValue = 0;
+            uint64_t nextFenceValue = 1;
+            uint64_t batchSize = 0;
+            uint64_t uploadedSize = 0;
+            uint64_t peakStagingSize = 0;
+            size_t uploadCount = 0;
+            size_t waitCount = 0;
+            bool bHasFailed = false;
+
+            const auto completeFence = [&](uint64_t fenceValue)
+            {
+                completedFenceValue = std::max(completedFenceValue, fenceValue);
+                pages.Reclaim(completedFenceValue);
+                std::erase_if(liveAllocations, [&](const LiveAllocation& live) { return live.FenceValue <= completedFenceValue; });
+                while (!inFlightBatches.empty() && inFlightBatches.front().first <= completedFenceValue)
+                {
+                    inFlightSize -= inFlightBatches.front().second;
+                    inFlightBatches.pop_front();
+                }
+            };
+            const auto submit = [&]
+            {
+                if (batchSize == 0)
+                {
+                    return;
+                }
+                pages.Retire(nextFenceValue);
+                inFlightBatches.emplace_back(nextFenceValue, batchSize);
+                inFlightSize += batchSize;
+                batchSize = 0;
+                if (nextFenceValue > StagingGPULatency)
+                {
+                    completeFence(nextFenceValue - StagingGPULatency);
+                }
+                ++nextFenceValue;
+                while (inFlightSize > StagingMaxInFlightBatchCount * StagingMaxBatchSize)
+                {
+                    ++waitCount;
+                    completeFence(inFlightBatches.front().first);
+                }
+            };
+            const auto upload = [&](uint64_t size, uint64_t alignment)
+            {
+                const StagingPageAllocator::Allocation allocation = pages.Allocate(size, alignment);
+                const uint64_t pageSize = pages.GetPageSize(allocation.Page);
+                bHasFailed |= allocation.Offset % alignment != 0 || allocation.Offset + size > pageSize;
+                // 아직 GPU가 읽을 수 있는 구간과 겹치면 안 됨.
+                for (const LiveAllocation& live : liveAllocations)
+                {
+                    bHasFailed |= live.Page == allocation.Page && allocation.Offset < live.Offset + live.Size && live.Offset < allocation.Offset + size;
+                }
+                liveAllocations.push_back({nextFenceValue, allocation.Page, allocation.Offset, size});
+
+                uint64_t stagingSize = 0;
+                for (uint32_t i = 0; i < pages.GetPageCount(); ++i)
+                {
+                    stagingSize += pages.GetPageSize(i);
+                }
+                peakStagingSize = std::max(peakStagingSize, stagingSize);
+                ++uploadCount;
+                uploadedSize += size;
+                batchSize += size;
+                if (batchSize >= StagingMaxBatchSize)
+                {
+                    submit();
+                }
+            };
+
+            const auto startTime = std::chrono::steady_clock::now();
+            for (uint32_t level = 0; level < StagingLevelCount && !bHasFailed; ++level)
+            {
+                for (uint32_t i = 0; i < StagingMeshesPerLevel; ++i)
+                {
+                    // 가끔 Page보다 큰 Mesh가 섞여 있음.
+                    const uint64_t vertexCount = percentDistribution(random) < 2 ? vertexCountDistribution(random) * 8 : vertexCountDistribution(random);
+                    upload(vertexCount * vertexSize, 16);
+                    upload(vertexCount * 3 * sizeof(uint32_t) / 2, 16);
+                }
+                // UploadMissingMeshes처럼 Level을 다 불러오면 바로 Submit함.
+                submit();
+            }
+            const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - startTime;
+            completeFence(nextFenceValue);
+
+            // 모두 끝나면 기본 크기 Page는 모두 비어 있고, 큰 Page는 모두 없어져야 함.
+            uint32_t defaultPageCount = 0;
+            for (uint32_t i = 0; i < pages.GetPageCount(); ++i)
+            {
+                const uint64_t pageSize = pages.GetPageSize(i);
+                bHasFailed |= pageSize != 0 && pageSize != StagingPageSize;
+                defaultPageCount += pageSize == StagingPageSize;
+            }
+            bHasFailed |= pages.HasRetiredPages() || pages.GetFreePageCount() != defaultPageCount;
+
+            const size_t meshCount = static_cast<size_t>(StagingLevelCount) * StagingMeshesPerLevel;
+            spdlog::info("Staging upload benchmark: {} levels x {} meshes, {} MB pages, {} MB batches, GPU latency {} batches", StagingLevelCount, StagingMeshesPerLevel,
+                         StagingPageSize / (1024 * 1024), StagingMaxBatchSize / (1024 * 1024), StagingGPULatency);
+            spdlog::info("{:>10} {:>12} {:>10} {:>12} {:>10} {:>16} {:>14}", "Uploads", "Uploaded(MB)", "Batches", "Old Stalls", "CPU Waits", "Peak Staging(MB)", "Alloc+Check(ms)");
+            spdlog::info("{:>10} {:>12.1f} {:>10} {:>12} {:>10} {:>16.1f} {:>14.3f}", uploadCount, static_cast<double>(uploadedSize) / (1024.0 * 1024.0), nextFenceValue - 1, meshCount,
+                         waitCount, static_cast<double>(peakStagingSize) / (1024.0 * 1024.0), ToMilliseconds(duration));
+            if (bHasFailed)
+            {
+                spdlog::error("Staging upload benchmark: allocation overlapped a page still in flight, was misaligned, or a page was not reclaimed");
+            }
+            else
+            {
+                spdlog::info("Staging upload benchmark: passed");
+            }
+        }
+
+        void RunDescriptorAllocatorBenchmark()
+        {
+            // Texture와 Material이 만들어지고 사라지는 것처럼 임의의 구간을 할당하고 Free하며, 사용 중인 구간끼리 겹치지 않는지 확인함.
+            // 대부분 SRV 하나이고 가끔 Material Table처럼 여러 개를 한 번에 할당함.
+            struct LiveAllocation
+            {
+                uint32_t Index = 0;
+                uint32_t Count = 0;
+            };
+
+            std::mt19937 random(42);
+            std::uniform_int_distribution<uint32_t> percentDistribution(0, 99);
+            std::uniform_int_distribution<uint32_t> tableCountDistribution(2, 16);
+
+            DescriptorAllocator allocator(DescriptorBenchmarkCapacity);
+            std::vector<LiveAllocation> liveAllocations;
+            std::vector<bool> bIsUsed(DescriptorBenchmarkCapacity, false);
+            size_t failedAllocationCount = 0;
+            size_t maximumFreeRangeCount = 0;
+            bool bHasFailed = false;
+            for (size_t i = 0; i < DescriptorChurnCount && !bHasFailed; ++i)
+            {
+                // 절반 정도 찬 상태를 유지하도록 사용량이 많을수록 Free를 자주 함.
+                const bool bShouldFree = !liveAllocations.empty() &&
+                                         percentDistribution(random) < allocator.GetAllocatedCount() * 100 / DescriptorBenchmarkCapacity;
+                if (bShouldFree)
+                {
+                    const size_t liveIndex = std::uniform_int_distribution<size_t>(0, liveAllocations.size() - 1)(random);
+                    const LiveAllocation live = liveAllocations[liveIndex];
+                    liveAllocations[liveIndex] = liveAllocations.back();
+                    liveAllocations.pop_back();
+                    allocator.Free(live.Index, live.Count);
+                    std::fill_n(bIsUsed.begin() + live.Index, live.Count, false);
+                    continue;
+                }
+
+                const uint32_t count = percentDistribution(random) < 90 ? 1 : tableCountDistribution(random);
+                const std::optional<uint32_t> index = allocator.Allocate(count);
+                if (!index)
+                {
+                    ++failedAllocationCount;
+                    continue;
+                }
+                bHasFailed |= *index + count > DescriptorBenchmarkCapacity;
+                for (uint32_t j = 0; j < count && !bHasFailed; ++j)
+                {
+                    bHasFailed |= bIsUsed[*index + j];
+                    bIsUsed[*index + j] = true;
+                }
+                liveAllocations.push_back({*index, count});
+                maximumFreeRangeCount = std::max(maximumFreeRangeCount, allocator.GetFreeRangeCount());
+            }
+
+            // 모두 돌려주면 처음처럼 빈 구간 하나로 합쳐져야 함.
+            for (const LiveAllocation& live : liveAllocations)
+            {
+                allocator.Free(live.Index, live.Count);
+            }
+            bHasFailed |= allocator.GetAllocatedCount() != 0 || allocator.GetFreeRangeCount() != 1;
+
+            // 같은 자리를 계속 할당하고 돌려주는 가장 흔한 경우의 비용.
+            DescriptorAllocator singleAllocator(DescriptorBenchmarkCapacity);
+            const std::chrono::nanoseconds singleTime = MeasureBestTime(DescriptorSingleCount, [&]
+            {
+                for (size_t i = 0; i < DescriptorSingleCount; ++i)
+                {
+                    const std::optional<uint32_t> index = singleAllocator.Allocate(1);
+                    bHasFailed |= !index;
+                    singleAllocator.Free(*index, 1);
+                }
+            });
+
+            spdlog::info("Descriptor allocator benchmark: {} descriptors, {} operations", DescriptorBenchmarkCapacity, DescriptorChurnCount);
+            spdlog::info("{:>16} {:>18} {:>24}", "Failed Allocs", "Max Free Ranges", "Allocate+Free(ns)");
+            spdlog::info("{:>16} {:>18} {:>24.2f}", failedAllocationCount, maximumFreeRangeCount,
+                         ToMilliseconds(singleTime) * 1'000'000.0 / DescriptorSingleCount);
+            if (bHasFailed)
+            {
+                spdlog::error("Descriptor allocator benchmark: allocations overlapped or free ranges were not merged");
+            }
+            else
+            {
+                spdlog::info("Descriptor allocator benchmark: passed");
+            }
+        }
+    }
+}
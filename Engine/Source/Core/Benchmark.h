@@ -0,0 +1,35 @@
+#pragma once
+
+namespace Engine
+{
+    // 엔진 내부 Kernel의 성능을 측정하여 Log로 출력함. Editor의 Tools 메뉴에서 실행함.
+    namespace Benchmark
+    {
+        // 10k/100k/1M개의 Transform을 SimpleMath로 하나씩 계산하는 경우와 TransformBatch의 각 Path를 비교함.
+        // 각 Path의 시간에는 Component를 성분별 배열로 모으는 시간이 포함됨.
+        void RunTransformBenchmark();
+        // 10k/100k/1M개의 Entity를 하나씩 만들고 삭제하는 경우와 Scene의 Bulk API를 쓰는 경우를 비교함.
+        void RunEntitySpawnBenchmark();
+        // 50k그루의 나무를 Entity마다 Component를 복사하여 만드는 경우와 Prefab Instance로 만드는 경우의 시간과 Memory를 비교함.
+        void RunPrefabBenchmark();
+        // 100k개의 움직이는 Entity로 SceneBVH의 Update 시간과 Frustum/Sphere/Box/Ray Query 시간을 측정하고 Box Query를 전수 검사와 비교함.
+        void RunSceneBVHBenchmark();
+        // 100k/1M개의 AABB를 FrustumCulling의 각 Path와 JobSystem 병렬 실행으로 검사하고, 모든 결과가 Scalar Path와 같은지 확인함.
+        void RunFrustumCullingBenchmark();
+        // 2k개의 벽을 Occlusion Buffer에 그리고 100k개 AABB의 가려짐을 검사함.
+        // Worker 하나로 실행한 결과와 Depth Buffer까지 같은지, 벽 뒤의 상자만 가려지는지 확인함.
+        void RunOcclusionCullingBenchmark();
+        // 8/64/256/1024개의 Point/Spot Light로 LightClusterGrid를 만드는 시간과 Cluster당 Light 수를 측정하고,
+        // 모든 Cluster의 목록을 전수 검사와 비교함.
+        void RunClusteredLightingBenchmark();
+        // 10k/100k/1M개의 Draw Packet을 RenderQueue로 정렬한 시간을 std::stable_sort와 비교하고, 정렬 전후의 Pipeline/Mesh 변경 횟수와
+        // Instancing으로 묶은 Draw 수를 출력함.
+        void RunRenderQueueBenchmark();
+        // 1000개의 Mesh로 이루어진 Level을 20번 불러오며 StagingPageAllocator에 Batch 단위로 할당하고, 아직 GPU가 읽을 수 있는 구간과 겹치지 않는지,
+        // 모두 끝나면 Page를 모두 돌려받는지 확인함. Mesh마다 기다리던 횟수와 Batch 수, CPU가 기다린 횟수를 비교함.
+        void RunStagingUploadBenchmark();
+        // 16k개짜리 DescriptorAllocator에서 임의의 크기로 할당과 Free를 반복하며 사용 중인 구간끼리 겹치지 않는지, 모두 Free하면
+        // 빈 구간이 하나로 합쳐지는지 확인함. Descriptor 하나를 할당하고 돌려주는 시간도 측정함.
+        void RunDescriptorAllocatorBenchmark();
+    }
+}
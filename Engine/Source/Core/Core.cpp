@@ -4,4 +4,5 @@
 namespace Engine
 {
     RenderContext Core::m_RenderContext;
+    JobSystem Core::m_JobSystem;
 }
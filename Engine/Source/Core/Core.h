@@ -1,4 +1,5 @@
 #pragma once
+#include "JobSystem.h"
 #include "RenderContext.h"
 
 
@@ -9,8 +10,10 @@ namespace Engine
     public:
         Core() = delete;
         static const RenderContext& GetRenderContext() { return m_RenderContext; }
+        static JobSystem& GetJobSystem() { return m_JobSystem; }
 
     private:
         static RenderContext m_RenderContext;
+        static JobSystem m_JobSystem;
     };
 }
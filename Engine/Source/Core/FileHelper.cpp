@@ -0,0 +1,24 @@
+#include "EnginePCH.h"
+#include "FileHelper.h"
+
+#include <fstream>
+
+namespace Engine
+{
+    namespace FileHelper
+    {
+        bool ReadFile(const std::filesystem::path& filePath, std::vector<uint8_t>& outData)
+        {
+            std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+            if (!file)
+            {
+                return false;
+            }
+
+            const std::streamsize fileSize = file.tellg();
+            outData.resize(static_cast<size_t>(fileSize));
+            file.seekg(0, std::ios::beg);
+            return static_cast<bool>(file.read(reinterpret_cast<char*>(outData.data()), fileSize));
+        }
+    }
+}
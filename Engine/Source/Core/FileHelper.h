@@ -0,0 +1,11 @@
+#pragma once
+#include <filesystem>
+#include <vector>
+
+namespace Engine
+{
+    namespace FileHelper
+    {
+        bool ReadFile(const std::filesystem::path& filePath, std::vector<uint8_t>& outData);
+    }
+}
@@ -0,0 +1,47 @@
+#include "EnginePCH.h"
+#include "HashHelper.h"
+
+#include <cstring>
+
+namespace Engine
+{
+    namespace HashHelper
+    {
+        namespace
+        {
+            constexpr uint64_t Prime = 0x9e3779b97f4a7c15ull;
+
+            uint64_t Mix(uint64_t value)
+            {
+                value ^= value >> 33;
+                value *= 0xff51afd7ed558ccdull;
+                value ^= value >> 33;
+                value *= 0xc4ceb9fe1a85ec53ull;
+                value ^= value >> 33;
+                return value;
+            }
+        }
+
+        uint64_t HashBytes(const void* data, size_t sizeInBytes, uint64_t seed)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            uint64_t hash = Mix(seed ^ (sizeInBytes * Prime));
+
+            size_t offset = 0;
+            for (; offset + sizeof(uint64_t) <= sizeInBytes; offset += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + offset, sizeof(uint64_t));
+                hash = (hash ^ Mix(word)) * Prime;
+            }
+
+            if (offset < sizeInBytes)
+            {
+                uint64_t tail = 0;
+                std::memcpy(&tail, bytes + offset, sizeInBytes - offset);
+                hash = (hash ^ Mix(tail)) * Prime;
+            }
+            return Mix(hash);
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace Engine
+{
+    namespace HashHelper
+    {
+        // Asset 내용의 지문을 만들기 위한 64bit Hash. 암호학적으로 안전하지 않음.
+        uint64_t HashBytes(const void* data, size_t sizeInBytes, uint64_t seed = 0);
+    }
+}
@@ -0,0 +1,125 @@
+// OcclusionBuffer의 Test처럼 Engine 없이 Build하는 곳에서도 쓰므로 Precompiled Header를 쓰지 않음.
+#include "JobSystem.h"
+
+namespace Engine
+{
+    namespace
+    {
+        thread_local uint32_t CurrentThreadIndex = 0;
+    }
+
+    JobSystem::JobSystem(uint32_t workerCount)
+    {
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_bIsStopping = true;
+        }
+        m_JobAvailable.notify_all();
+
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+    }
+
+    void JobSystem::Submit(Job job, Counter* counter)
+    {
+        if (counter)
+        {
+            counter->Value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Jobs.push_back({.Function = std::move(job), .JobCounter = counter});
+        }
+        m_JobAvailable.notify_one();
+    }
+
+    void JobSystem::SubmitBackground(Job job, Counter* counter)
+    {
+        if (counter)
+        {
+            counter->Value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard lock(m_Mutex);
+            m_BackgroundJobs.push_back({.Function = std::move(job), .JobCounter = counter});
+        }
+        m_JobAvailable.notify_one();
+    }
+
+    void JobSystem::Wait(const Counter& counter)
+    {
+        while (counter.Value.load(std::memory_order_acquire) > 0)
+        {
+            if (!TryRunJob())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    uint32_t JobSystem::GetCurrentThreadIndex()
+    {
+        return CurrentThreadIndex;
+    }
+
+    void JobSystem::WorkerLoop(uint32_t threadIndex)
+    {
+        CurrentThreadIndex = threadIndex;
+        while (true)
+        {
+            QueuedJob job;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_JobAvailable.wait(lock, [this] { return m_bIsStopping || !m_Jobs.empty() || !m_BackgroundJobs.empty(); });
+                std::deque<QueuedJob>& jobs = !m_Jobs.empty() ? m_Jobs : m_BackgroundJobs;
+                if (jobs.empty())
+                {
+                    return;
+                }
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            RunJob(job);
+        }
+    }
+
+    bool JobSystem::TryRunJob()
+    {
+        QueuedJob job;
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Jobs.empty())
+            {
+                return false;
+            }
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+        RunJob(job);
+        return true;
+    }
+
+    void JobSystem::RunJob(QueuedJob& job)
+    {
+        job.Function();
+        if (job.JobCounter)
+        {
+            job.JobCounter->Value.fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+    // 고정된 수의 Worker Thread가 하나의 Queue에서 Job을 꺼내 실행함.
+    // Wait하는 Thread도 Queue의 Job을 같이 실행하므로 Job 안에서 다른 Job을 Submit하고 기다려도 Deadlock이 생기지 않음.
+    class JobSystem
+    {
+    public:
+        using Job = std::function<void()>;
+
+        // 여러 Job의 완료를 기다리기 위한 Counter. Submit할 때 증가하고 Job이 끝나면 감소함.
+        struct Counter
+        {
+            std::atomic<uint32_t> Value = 0;
+        };
+
+    public:
+        explicit JobSystem(uint32_t workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        void Submit(Job job, Counter* counter = nullptr);
+        // Worker만 실행하고 Wait하는 Thread는 가져가지 않는 Job. 파일 읽기처럼 오래 걸리지만 이번 Frame 안에 끝날 필요가 없는 작업에 사용함.
+        // Submit된 Job이 있다면 그것을 먼저 실행함.
+        void SubmitBackground(Job job, Counter* counter = nullptr);
+        void Wait(const Counter& counter);
+
+        // Worker와 Wait 중인 Thread를 구별하기 위한 Index. Worker가 아니면 0임.
+        static uint32_t GetCurrentThreadIndex();
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    private:
+        struct QueuedJob
+        {
+            Job Function;
+            Counter* JobCounter = nullptr;
+        };
+
+        void WorkerLoop(uint32_t threadIndex);
+        bool TryRunJob();
+        void RunJob(QueuedJob& job);
+
+    private:
+        std::vector<std::thread> m_Workers;
+        std::mutex m_Mutex;
+        std::condition_variable m_JobAvailable;
+        std::deque<QueuedJob> m_Jobs;
+        std::deque<QueuedJob> m_BackgroundJobs;
+        bool m_bIsStopping = false;
+    };
+}
@@ -0,0 +1,65 @@
+#include "EnginePCH.h"
+#include "MappedFile.h"
+
+namespace Engine
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& filePath)
+    {
+        Close();
+
+        m_FileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_FileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(m_FileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            Close();
+            return false;
+        }
+
+        m_MappingHandle = CreateFileMappingW(m_FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_MappingHandle)
+        {
+            Close();
+            return false;
+        }
+
+        m_Data = static_cast<const uint8_t*>(MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!m_Data)
+        {
+            Close();
+            return false;
+        }
+
+        m_Size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+        {
+            UnmapViewOfFile(m_Data);
+            m_Data = nullptr;
+        }
+        if (m_MappingHandle)
+        {
+            CloseHandle(m_MappingHandle);
+            m_MappingHandle = nullptr;
+        }
+        if (m_FileHandle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_FileHandle);
+            m_FileHandle = INVALID_HANDLE_VALUE;
+        }
+        m_Size = 0;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <filesystem>
+
+namespace Engine
+{
+    // 파일 전체를 읽기 전용으로 Memory에 Mapping함. 실제로 읽는 Page만 OS가 불러옴.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::filesystem::path& filePath);
+        void Close();
+
+        const uint8_t* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+
+    private:
+        HANDLE m_FileHandle = INVALID_HANDLE_VALUE;
+        HANDLE m_MappingHandle = nullptr;
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+    };
+}
@@ -1,2 +1,13 @@
 #include "EnginePCH.h"
 #include "Components.h"
+
+namespace Engine
+{
+    DirectX::SimpleMath::Matrix TransformComponent::GetLocalMatrix() const
+    {
+        const DirectX::SimpleMath::Matrix scale = DirectX::SimpleMath::Matrix::CreateScale(Scale);
+        const DirectX::SimpleMath::Matrix rotation = DirectX::SimpleMath::Matrix::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(Rotation.y), DirectX::XMConvertToRadians(Rotation.x), DirectX::XMConvertToRadians(Rotation.z));
+        const DirectX::SimpleMath::Matrix translation = DirectX::SimpleMath::Matrix::CreateTranslation(Position);
+        return scale * rotation * translation;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <SimpleMath.h>
 
+#include "AssetHandle.h"
 #include "Graphics/Mesh.h"
 
 namespace Engine
@@ -15,11 +16,50 @@ namespace Engine
         DirectX::SimpleMath::Vector3 Position{0.0f, 0.0f, 0.0f};
         DirectX::SimpleMath::Vector3 Rotation{0.0f, 0.0f, 0.0f};
         DirectX::SimpleMath::Vector3 Scale{1.0f, 1.0f, 1.0f};
+
+        DirectX::SimpleMath::Matrix GetLocalMatrix() const;
+    };
+
+    // 부모/자식 관계. 자식들은 FirstChild부터 NextSibling으로 이어짐.
+    // 관계는 Scene::SetParent로만 변경함.
+    struct RelationshipComponent
+    {
+        entt::entity Parent = entt::null;
+        entt::entity FirstChild = entt::null;
+        entt::entity PreviousSibling = entt::null;
+        entt::entity NextSibling = entt::null;
+    };
+
+    // TransformComponent와 부모의 World Matrix로 계산된 Cache. Scene이 관리하므로 직접 수정하지 않음.
+    // Storage는 깊이 우선 순서로 정렬되며, 한 Entity의 Subtree는 [Order, Order + SubtreeSize) 구간에 연속으로 놓임.
+    struct WorldTransformComponent
+    {
+        DirectX::SimpleMath::Matrix World = DirectX::SimpleMath::Matrix::Identity;
+        uint32_t Order = 0;
+        uint32_t SubtreeSize = 1;
     };
 
+    // Prefab에서 만들어진 Entity. 이름처럼 Instance마다 같은 값은 복사하지 않고 Prefab의 Node를 참조함.
+    // 공유하는 값을 바꾸려면 Scene::OverrideDisplayName처럼 Instance에 값을 복사한 뒤 수정해야 함.
+    struct PrefabInstanceComponent
+    {
+        uint32_t PrefabIndex = 0;
+        uint32_t NodeIndex = 0;
+    };
+
+    // Point와 Spot Light의 위치는 WorldTransformComponent에서 가져옴.
     struct LightComponent
     {
         DirectX::SimpleMath::Color LightColor{1.0f, 1.0f, 1.0f};
+        // LightSystem이 TransformComponent의 Rotation으로부터 계산함.
+        DirectX::SimpleMath::Vector3 Direction{0.0f, 0.0f, 1.0f};
+        LightType Type = LightType::Directional;
+        float Intensity = 1.0f;
+        // Point와 Spot Light가 닿는 거리. 이 거리에서 밝기가 0이 됨.
+        float Range = 10.0f;
+        // Spot Light 원뿔의 반각(Degree). Inner 안쪽은 밝기가 같고 Outer까지 줄어듦.
+        float InnerConeAngle = 20.0f;
+        float OuterConeAngle = 30.0f;
     };
     
     struct MeshRenderComponent
@@ -32,8 +72,15 @@ namespace Engine
         // 오히려 Renderer는 IASetVertexBuffer를 통해 VertexBuffer를 Set하는것 보다는
         // Lighting, Shadow, Color와 같은 Material. Instancing할 때, 루프를 돌면서 버퍼에 업로드해야하는
         // 정보에 관심이 많음.
-        entt::resource<Mesh> Mesh;
+        // 소유권은 Component가 생성/삭제될 때만 바뀌므로, Draw Loop에서는 참조 횟수를 건드리지 않음.
+        AssetHandle<Mesh> Mesh;
         
     };
+
+    // 이 Entity의 Mesh를 Occlusion Buffer에 그려 뒤에 있는 Mesh를 가림. 벽이나 건물처럼 크고 속이 찬 Mesh에만 붙여야 함.
+    // Occluder 자신은 Occlusion 검사를 하지 않음.
+    struct OccluderComponent
+    {
+    };
     
 }
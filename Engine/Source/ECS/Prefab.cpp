@@ -0,0 +1,130 @@
+#include "EnginePCH.h"
+#include "Prefab.h"
+
+#include "AssetManager.h"
+#include "Scene.h"
+
+namespace Engine
+{
+    Prefab::Prefab(const entt::registry& registry, entt::entity root)
+    {
+        // 너비 우선으로 복사하므로 부모가 항상 자식보다 앞에 오고, 형제 순서도 그대로 유지됨.
+        std::vector<entt::entity> sourceEntities{root};
+        m_Nodes.emplace_back();
+        for (uint32_t nodeIndex = 0; nodeIndex < sourceEntities.size(); ++nodeIndex)
+        {
+            const entt::entity entity = sourceEntities[nodeIndex];
+            if (const auto* displayName = registry.try_get<DisplayNameComponent>(entity))
+            {
+                m_Nodes[nodeIndex].Name = displayName->Name;
+            }
+            if (const auto* transform = registry.try_get<TransformComponent>(entity))
+            {
+                m_Nodes[nodeIndex].Transform = *transform;
+            }
+            if (const auto* light = registry.try_get<LightComponent>(entity))
+            {
+                m_Nodes[nodeIndex].Light = *light;
+            }
+            if (const auto* meshRender = registry.try_get<MeshRenderComponent>(entity); meshRender && meshRender->Mesh)
+            {
+                AssetManager::Retain(meshRender->Mesh);
+                m_Nodes[nodeIndex].Mesh = meshRender->Mesh;
+            }
+
+            const auto* relationship = registry.try_get<RelationshipComponent>(entity);
+            uint32_t previousChild = InvalidNode;
+            for (entt::entity child = relationship ? relationship->FirstChild : entt::null; child != entt::null; child = registry.get<RelationshipComponent>(child).NextSibling)
+            {
+                const auto childIndex = static_cast<uint32_t>(m_Nodes.size());
+                Node& childNode = m_Nodes.emplace_back();
+                childNode.Parent = nodeIndex;
+                childNode.PreviousSibling = previousChild;
+                if (previousChild != InvalidNode)
+                {
+                    m_Nodes[previousChild].NextSibling = childIndex;
+                }
+                else
+                {
+                    m_Nodes[nodeIndex].FirstChild = childIndex;
+                }
+                previousChild = childIndex;
+                sourceEntities.push_back(child);
+            }
+        }
+    }
+
+    Prefab::~Prefab()
+    {
+        for (const Node& node : m_Nodes)
+        {
+            if (node.Mesh)
+            {
+                AssetManager::Release(node.Mesh);
+            }
+        }
+    }
+
+    std::vector<entt::entity> Prefab::Instantiate(Scene& scene, uint32_t prefabIndex, std::span<const TransformComponent> rootTransforms) const
+    {
+        const size_t instanceCount = rootTransforms.size();
+        if (instanceCount == 0)
+        {
+            return {};
+        }
+
+        // Node마다 모든 Instance의 Entity가 연속으로 놓이도록 Node 순서로 나눔.
+        std::vector<entt::entity> entities = scene.SpawnEntities(instanceCount * m_Nodes.size());
+        const auto getEntity = [&](uint32_t nodeIndex, size_t instanceIndex)
+        {
+            return nodeIndex != InvalidNode ? entities[nodeIndex * instanceCount + instanceIndex] : entt::null;
+        };
+
+        std::vector<RelationshipComponent> relationships;
+        for (uint32_t nodeIndex = 0; nodeIndex < m_Nodes.size(); ++nodeIndex)
+        {
+            const Node& node = m_Nodes[nodeIndex];
+            const std::span<const entt::entity> nodeEntities(entities.data() + nodeIndex * instanceCount, instanceCount);
+
+            scene.AddComponents<PrefabInstanceComponent>(nodeEntities, PrefabInstanceComponent{.PrefabIndex = prefabIndex, .NodeIndex = nodeIndex});
+            if (nodeIndex == 0)
+            {
+                scene.AddComponents<TransformComponent>(nodeEntities, rootTransforms.begin());
+            }
+            else
+            {
+                scene.AddComponents<TransformComponent>(nodeEntities, node.Transform);
+            }
+
+            if (node.Light)
+            {
+                scene.AddComponents<LightComponent>(nodeEntities, *node.Light);
+            }
+            if (node.Mesh)
+            {
+                // Component 하나가 참조 하나를 가지므로 Instance 수만큼 한 번에 올림.
+                AssetManager::Retain(node.Mesh, static_cast<uint32_t>(instanceCount));
+                scene.AddComponents<MeshRenderComponent>(nodeEntities, MeshRenderComponent{.Mesh = node.Mesh});
+            }
+
+            if (m_Nodes.size() > 1)
+            {
+                relationships.resize(instanceCount);
+                for (size_t i = 0; i < instanceCount; ++i)
+                {
+                    relationships[i] = {
+                        .Parent = getEntity(node.Parent, i),
+                        .FirstChild = getEntity(node.FirstChild, i),
+                        .PreviousSibling = getEntity(node.PreviousSibling, i),
+                        .NextSibling = getEntity(node.NextSibling, i),
+                    };
+                }
+                scene.AddComponents<RelationshipComponent>(nodeEntities, relationships.begin());
+            }
+        }
+
+        // Root Node의 Entity가 맨 앞에 있음.
+        entities.resize(instanceCount);
+        return entities;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "Components.h"
+
+namespace Engine
+{
+    class Scene;
+
+    // 한 번 저장해 두고 여러 번 만드는 Entity Graph. 만든 뒤에는 수정하지 않음.
+    // Instance는 Transform처럼 Entity마다 달라지는 Component만 Node 단위로 한 번에 복사하고, 이름은 Node의 것을 같이 씀.
+    class Prefab
+    {
+    public:
+        static constexpr uint32_t InvalidNode = UINT32_MAX;
+
+        struct Node
+        {
+            std::string Name;
+            TransformComponent Transform;
+            // Nodes 안의 Index. 부모는 항상 자식보다 앞에 있음.
+            uint32_t Parent = InvalidNode;
+            uint32_t FirstChild = InvalidNode;
+            uint32_t PreviousSibling = InvalidNode;
+            uint32_t NextSibling = InvalidNode;
+            std::optional<LightComponent> Light;
+            AssetHandle<Mesh> Mesh;
+        };
+
+    public:
+        // root의 Subtree를 복사함. Mesh는 Prefab이 따로 참조를 가지므로 원본 Entity를 삭제해도 됨.
+        Prefab(const entt::registry& registry, entt::entity root);
+        ~Prefab();
+
+        Prefab(const Prefab&) = delete;
+        Prefab& operator=(const Prefab&) = delete;
+
+        // rootTransforms마다 Instance를 하나씩 만들고 각 Instance의 Root Entity를 반환함.
+        // Entity는 Node 순서로 한 번에 만들고, Component는 Node마다 모든 Instance에 한 번에 넣음.
+        std::vector<entt::entity> Instantiate(Scene& scene, uint32_t prefabIndex, std::span<const TransformComponent> rootTransforms) const;
+
+        const std::vector<Node>& GetNodes() const { return m_Nodes; }
+
+    private:
+        std::vector<Node> m_Nodes;
+    };
+}
@@ -1,11 +1,392 @@
 #include "EnginePCH.h"
 #include "Scene.h"
+#include "Components.h"
 #include "Entity.h"
+#include "Prefab.h"
+#include "Engine.h"
+#include "Core/Core.h"
 
 namespace Engine
 {
+    Scene::Scene()
+        : m_BVH(m_Registry)
+    {
+        m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformConstruct>(*this);
+        m_Registry.on_update<TransformComponent>().connect<&Scene::OnTransformUpdate>(*this);
+        m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroy>(*this);
+        m_Registry.on_destroy<RelationshipComponent>().connect<&Scene::OnRelationshipDestroy>(*this);
+    }
+
+    Scene::~Scene() = default;
+
     Entity Scene::SpawnEntity()
     {
         return Entity(m_Registry.create(), this);
     }
+
+    std::vector<entt::entity> Scene::SpawnEntities(size_t count)
+    {
+        // 삭제된 Entity 자리를 먼저 재사용하므로 살아 있는 Entity 수를 기준으로 늘림.
+        auto& entities = m_Registry.storage<entt::entity>();
+        entities.reserve(entities.in_use() + count);
+
+        std::vector<entt::entity> spawnedEntities(count);
+        m_Registry.create(spawnedEntities.begin(), spawnedEntities.end());
+        return spawnedEntities;
+    }
+
+    void Scene::DestroyEntities(std::span<const entt::entity> entities)
+    {
+        if (entities.empty())
+        {
+            return;
+        }
+
+        // WorldTransformComponent는 같은 호출에서 함께 삭제되므로 Entity마다 Signal을 받을 필요가 없음.
+        // RelationshipComponent의 Signal은 남은 Entity의 관계를 정리해야 하므로 그대로 둠.
+        m_Registry.on_destroy<TransformComponent>().disconnect<&Scene::OnTransformDestroy>(*this);
+        m_Registry.destroy(entities.begin(), entities.end());
+        m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroy>(*this);
+        m_bIsTransformOrderDirty = true;
+    }
+
+    uint32_t Scene::CreatePrefab(entt::entity root)
+    {
+        m_Prefabs.push_back(std::make_unique<Prefab>(m_Registry, root));
+        return static_cast<uint32_t>(m_Prefabs.size() - 1);
+    }
+
+    const Prefab& Scene::GetPrefab(uint32_t prefabIndex) const
+    {
+        return *m_Prefabs[prefabIndex];
+    }
+
+    std::vector<entt::entity> Scene::InstantiatePrefab(uint32_t prefabIndex, std::span<const TransformComponent> rootTransforms)
+    {
+        return m_Prefabs[prefabIndex]->Instantiate(*this, prefabIndex, rootTransforms);
+    }
+
+    const std::string& Scene::GetDisplayName(entt::entity entityHandle) const
+    {
+        static const std::string EmptyName;
+        if (const auto* displayName = m_Registry.try_get<DisplayNameComponent>(entityHandle))
+        {
+            return displayName->Name;
+        }
+        if (const auto* prefabInstance = m_Registry.try_get<PrefabInstanceComponent>(entityHandle))
+        {
+            return m_Prefabs[prefabInstance->PrefabIndex]->GetNodes()[prefabInstance->NodeIndex].Name;
+        }
+        return EmptyName;
+    }
+
+    DisplayNameComponent& Scene::OverrideDisplayName(entt::entity entityHandle)
+    {
+        if (auto* displayName = m_Registry.try_get<DisplayNameComponent>(entityHandle))
+        {
+            return *displayName;
+        }
+        return m_Registry.emplace<DisplayNameComponent>(entityHandle, GetDisplayName(entityHandle));
+    }
+
+    void Scene::SetParent(entt::entity child, entt::entity parent)
+    {
+        // parent가 child 자신이거나 자손이라면 순환이 생기므로 무시함.
+        for (entt::entity ancestor = parent; ancestor != entt::null;)
+        {
+            if (ancestor == child)
+            {
+                return;
+            }
+            const auto* relationship = m_Registry.try_get<RelationshipComponent>(ancestor);
+            ancestor = relationship ? relationship->Parent : entt::null;
+        }
+
+        m_Registry.get_or_emplace<RelationshipComponent>(child);
+        Detach(child);
+
+        if (parent != entt::null)
+        {
+            auto& parentRelationship = m_Registry.get_or_emplace<RelationshipComponent>(parent);
+            auto& childRelationship = m_Registry.get<RelationshipComponent>(child);
+            childRelationship.Parent = parent;
+            childRelationship.NextSibling = parentRelationship.FirstChild;
+            if (parentRelationship.FirstChild != entt::null)
+            {
+                m_Registry.get<RelationshipComponent>(parentRelationship.FirstChild).PreviousSibling = child;
+            }
+            parentRelationship.FirstChild = child;
+        }
+
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::MarkTransformDirty(entt::entity entityHandle)
+    {
+        m_DirtyTransforms.push_back(entityHandle);
+    }
+
+    void Scene::UpdateWorldTransforms()
+    {
+        UpdateDirtyWorldTransforms();
+        m_BVH.Update();
+    }
+
+    void Scene::UpdateDirtyWorldTransforms()
+    {
+        if (m_bIsTransformOrderDirty)
+        {
+            RebuildTransformOrder();
+            UpdateWorldTransformRange(0, m_TransformOrder.size());
+            m_DirtyTransforms.clear();
+            m_bIsTransformOrderDirty = false;
+            return;
+        }
+
+        if (m_DirtyTransforms.empty())
+        {
+            return;
+        }
+
+        const auto& worldTransforms = m_Registry.storage<WorldTransformComponent>();
+        std::vector<std::pair<size_t, size_t>> ranges;
+        ranges.reserve(m_DirtyTransforms.size());
+        for (const entt::entity entity : m_DirtyTransforms)
+        {
+            if (worldTransforms.contains(entity))
+            {
+                const auto& worldTransform = worldTransforms.get(entity);
+                ranges.emplace_back(worldTransform.Order, worldTransform.Order + worldTransform.SubtreeSize);
+            }
+        }
+        m_DirtyTransforms.clear();
+
+        // Subtree 구간은 서로 겹치지 않거나 완전히 포함되므로, 이미 갱신한 구간에 포함된 구간은 건너뜀.
+        std::sort(ranges.begin(), ranges.end());
+        size_t updatedEnd = 0;
+        for (const auto& [first, last] : ranges)
+        {
+            if (first < updatedEnd)
+            {
+                continue;
+            }
+            UpdateWorldTransformRange(first, last);
+            updatedEnd = last;
+        }
+    }
+
+    void Scene::RegisterSystem(std::string name, SystemAccess access, SystemScheduler::SystemFunction function)
+    {
+        m_SystemScheduler.Register(m_Registry, std::move(name), std::move(access), std::move(function));
+    }
+
+    void Scene::Update(float deltaSeconds)
+    {
+        UpdateWorldTransforms();
+        m_SystemScheduler.Run(m_Registry, Core::GetJobSystem(), deltaSeconds);
+    }
+
+    void Scene::AddWorldTransforms(std::span<const entt::entity> entities)
+    {
+        ReserveComponents<WorldTransformComponent>(entities.size());
+        m_Registry.insert<WorldTransformComponent>(entities.begin(), entities.end());
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::OnTransformConstruct(entt::registry& registry, entt::entity entityHandle)
+    {
+        registry.emplace_or_replace<WorldTransformComponent>(entityHandle);
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::OnTransformUpdate(entt::registry& registry, entt::entity entityHandle)
+    {
+        MarkTransformDirty(entityHandle);
+    }
+
+    void Scene::OnTransformDestroy(entt::registry& registry, entt::entity entityHandle)
+    {
+        registry.remove<WorldTransformComponent>(entityHandle);
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::OnRelationshipDestroy(entt::registry& registry, entt::entity entityHandle)
+    {
+        Detach(entityHandle);
+
+        // 남은 자식들은 Root가 됨.
+        auto& relationship = registry.get<RelationshipComponent>(entityHandle);
+        for (entt::entity child = relationship.FirstChild; child != entt::null;)
+        {
+            auto& childRelationship = registry.get<RelationshipComponent>(child);
+            const entt::entity nextSibling = childRelationship.NextSibling;
+            childRelationship.Parent = entt::null;
+            childRelationship.PreviousSibling = entt::null;
+            childRelationship.NextSibling = entt::null;
+            child = nextSibling;
+        }
+        relationship.FirstChild = entt::null;
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::Detach(entt::entity entityHandle)
+    {
+        auto& relationship = m_Registry.get<RelationshipComponent>(entityHandle);
+        if (relationship.Parent == entt::null)
+        {
+            return;
+        }
+
+        if (relationship.PreviousSibling != entt::null)
+        {
+            m_Registry.get<RelationshipComponent>(relationship.PreviousSibling).NextSibling = relationship.NextSibling;
+        }
+        else
+        {
+            m_Registry.get<RelationshipComponent>(relationship.Parent).FirstChild = relationship.NextSibling;
+        }
+
+        if (relationship.NextSibling != entt::null)
+        {
+            m_Registry.get<RelationshipComponent>(relationship.NextSibling).PreviousSibling = relationship.PreviousSibling;
+        }
+
+        relationship.Parent = entt::null;
+        relationship.PreviousSibling = entt::null;
+        relationship.NextSibling = entt::null;
+        m_bIsTransformOrderDirty = true;
+    }
+
+    void Scene::RebuildTransformOrder()
+    {
+        auto& worldTransforms = m_Registry.storage<WorldTransformComponent>();
+        const auto& transforms = m_Registry.storage<TransformComponent>();
+        const auto& relationships = m_Registry.storage<RelationshipComponent>();
+
+        const auto isRoot = [&](entt::entity entity)
+        {
+            return !relationships.contains(entity)
+                || relationships.get(entity).Parent == entt::null
+                || !worldTransforms.contains(relationships.get(entity).Parent);
+        };
+
+        m_TransformOrder.clear();
+        m_TransformOrder.reserve(worldTransforms.size());
+        std::vector<entt::entity> stack;
+        size_t relationshipCount = 0;
+        for (const entt::entity root : static_cast<const entt::sparse_set&>(worldTransforms))
+        {
+            if (!isRoot(root))
+            {
+                continue;
+            }
+
+            // 전위 순회이므로 한 Entity의 Subtree는 연속된 구간에 놓임.
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                const entt::entity entity = stack.back();
+                stack.pop_back();
+
+                auto& worldTransform = worldTransforms.get(entity);
+                worldTransform.Order = static_cast<uint32_t>(m_TransformOrder.size());
+                worldTransform.SubtreeSize = 1;
+                m_TransformOrder.push_back(entity);
+
+                if (!relationships.contains(entity))
+                {
+                    continue;
+                }
+
+                ++relationshipCount;
+                for (entt::entity child = relationships.get(entity).FirstChild; child != entt::null; child = relationships.get(child).NextSibling)
+                {
+                    if (worldTransforms.contains(child))
+                    {
+                        stack.push_back(child);
+                    }
+                }
+            }
+        }
+
+        // 자식은 항상 부모보다 뒤에 있으므로 거꾸로 돌면서 Subtree 크기를 부모에 더함.
+        for (auto it = m_TransformOrder.rbegin(); it != m_TransformOrder.rend(); ++it)
+        {
+            if (!isRoot(*it))
+            {
+                worldTransforms.get(relationships.get(*it).Parent).SubtreeSize += worldTransforms.get(*it).SubtreeSize;
+            }
+        }
+
+        // 갱신할 때 메모리를 순서대로 읽도록 Storage도 같은 순서로 정렬함.
+        // entt의 View는 Packed Array를 뒤에서부터 순회하므로, 메모리 순서가 Order와 같도록 역순으로 비교함.
+        m_Registry.sort<WorldTransformComponent>([](const WorldTransformComponent& lhs, const WorldTransformComponent& rhs)
+        {
+            return lhs.Order > rhs.Order;
+        });
+
+        // Transform과 Relationship도 같은 순서로 맞춤. sort_as는 겹치는 Entity를 Packed Array의 끝에 Order 순서로 모음.
+        // 그 사이에 추가된 Component는 그 뒤에 붙고, 빠지는 경우는 Order를 다시 만들므로 구간이 유지됨.
+        m_Registry.sort<TransformComponent, WorldTransformComponent>();
+        m_Registry.sort<RelationshipComponent, WorldTransformComponent>();
+        m_TransformBegin = transforms.size() - m_TransformOrder.size();
+        m_RelationshipEnd = relationships.size();
+        m_RelationshipBegin = m_RelationshipEnd - relationshipCount;
+    }
+
+    void Scene::UpdateWorldTransformRange(size_t first, size_t last)
+    {
+        const auto& transforms = m_Registry.storage<TransformComponent>();
+        const auto& relationships = m_Registry.storage<RelationshipComponent>();
+        auto& worldTransforms = m_Registry.storage<WorldTransformComponent>();
+        if (first == last)
+        {
+            return;
+        }
+        EG_CONFIRM(transforms.data()[m_TransformBegin + first] == m_TransformOrder[first]);
+
+        // Local 행렬은 성분별 배열로 모은 뒤 한 번에 계산함. Transform은 Order 순서로 놓여 있으므로 Packed Array를 그대로 읽음.
+        // Storage의 rbegin은 Packed Array의 앞에서부터 순회함.
+        const size_t count = last - first;
+        m_TransformScratch.Resize(count);
+        m_LocalMatrixScratch.resize(count);
+        const auto transformIt = transforms.rbegin() + static_cast<std::ptrdiff_t>(m_TransformBegin + first);
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_TransformScratch.Set(i, transformIt[i]);
+        }
+        TransformBatch::Compose(m_TransformScratch, 0, count, m_LocalMatrixScratch.data());
+
+        // Relationship도 Order 순서로 모여 있으므로, 구간에서 처음 나오는 것만 찾은 뒤에는 Entity가 같은지만 보며 따라감.
+        const entt::entity* relationshipEntities = relationships.data();
+        size_t relationshipIndex = std::lower_bound(relationshipEntities + m_RelationshipBegin, relationshipEntities + m_RelationshipEnd, first,
+                                                    [&](entt::entity entity, size_t order)
+                                                    {
+                                                        return worldTransforms.get(entity).Order < order;
+                                                    }) - relationshipEntities;
+        const auto relationshipIt = relationships.rbegin();
+
+        // patch로 수정하여 SceneBVH의 Observer가 World Matrix가 바뀐 Entity를 알 수 있게 함.
+        for (size_t i = first; i < last; ++i)
+        {
+            const entt::entity entity = m_TransformOrder[i];
+            entt::entity parent = entt::null;
+            if (relationshipIndex < m_RelationshipEnd && relationshipEntities[relationshipIndex] == entity)
+            {
+                parent = relationshipIt[static_cast<std::ptrdiff_t>(relationshipIndex)].Parent;
+                ++relationshipIndex;
+            }
+
+            worldTransforms.patch(entity, [&](WorldTransformComponent& worldTransform)
+            {
+                worldTransform.World = DirectX::SimpleMath::Matrix(m_LocalMatrixScratch[i - first]);
+
+                // 부모는 항상 먼저 갱신되어 있음.
+                if (parent != entt::null && worldTransforms.contains(parent))
+                {
+                    worldTransform.World *= worldTransforms.get(parent).World;
+                }
+            });
+        }
+    }
 }
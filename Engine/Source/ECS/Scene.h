@@ -1,12 +1,32 @@
 #pragma once
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "SceneBVH.h"
+#include "SystemScheduler.h"
+#include "TransformBatch.h"
 
 namespace Engine
 {
     class Entity;
+    class Prefab;
+    struct DisplayNameComponent;
+    struct TransformComponent;
 
     class Scene
     {
+        // 불러올 때 Entity마다 발생하는 Signal을 건너뛰기 위해 내부 상태에 접근함.
+        friend class SceneSnapshot;
+
     public:
+        Scene();
+        ~Scene();
+
+        Scene(const Scene&) = delete;
+        Scene& operator=(const Scene&) = delete;
+
         Entity SpawnEntity();
         template <typename T, typename... Args>
         T& AddComponentToEntity(entt::entity entityHandle, Args&& ...args)
@@ -14,7 +34,114 @@ namespace Engine
             return m_Registry.emplace<T>(entityHandle, std::forward<Args>(args)...);
         }
 
+        // count개의 Entity를 한 번에 만듦. 배열은 연속이지만 삭제된 Entity의 Index가 재사용되므로 값이 연속이라는 보장은 없음.
+        std::vector<entt::entity> SpawnEntities(size_t count);
+
+        // entities 순서대로 values의 Component를 넣음. Storage는 넣기 전에 한 번만 늘림.
+        template <typename T, std::input_iterator It>
+        void AddComponents(std::span<const entt::entity> entities, It values)
+        {
+            ReserveComponents<T>(entities.size());
+            InsertComponents<T>(entities, [&] { m_Registry.insert<T>(entities.begin(), entities.end(), values); });
+        }
+
+        // 모든 Entity에 value를 복사하여 넣음.
+        template <typename T>
+        void AddComponents(std::span<const entt::entity> entities, const T& value = {})
+        {
+            ReserveComponents<T>(entities.size());
+            InsertComponents<T>(entities, [&] { m_Registry.insert<T>(entities.begin(), entities.end(), value); });
+        }
+
+        // 유효한 Entity만 넘겨야 함. 부모와 자식을 함께 삭제해도 되며, 남은 자식은 Root가 됨.
+        void DestroyEntities(std::span<const entt::entity> entities);
+
+        // root의 Subtree로 Prefab을 만들고 Index를 반환함. Prefab은 Scene이 사라질 때까지 남음.
+        uint32_t CreatePrefab(entt::entity root);
+        const Prefab& GetPrefab(uint32_t prefabIndex) const;
+        // rootTransforms마다 Instance를 하나씩 만들고 각 Instance의 Root Entity를 반환함.
+        std::vector<entt::entity> InstantiatePrefab(uint32_t prefabIndex, std::span<const TransformComponent> rootTransforms);
+
+        // 자신의 DisplayNameComponent가 없다면 Prefab Node의 이름을 반환함. 둘 다 없다면 빈 문자열임.
+        const std::string& GetDisplayName(entt::entity entityHandle) const;
+        // 이름을 바꾸기 전에 호출함. Prefab Instance라면 처음 호출할 때 Prefab의 이름을 복사해 자신의 것으로 가짐.
+        DisplayNameComponent& OverrideDisplayName(entt::entity entityHandle);
+
+        // child를 parent의 자식으로 옮김. parent가 entt::null이면 Root가 됨.
+        void SetParent(entt::entity child, entt::entity parent);
+
+        // TransformComponent를 참조로 직접 수정했다면 호출해야 함. registry.patch로 수정하면 자동으로 호출됨.
+        void MarkTransformDirty(entt::entity entityHandle);
+
+        // 변경된 Entity의 Subtree만 World Matrix를 다시 계산하고, World Matrix가 바뀐 Entity를 BVH에 반영함.
+        // 변경이 없다면 아무 일도 하지 않음.
+        void UpdateWorldTransforms();
+        // Mesh를 가진 Entity의 World AABB Tree. UpdateWorldTransforms 이후의 위치를 가짐.
+        const SceneBVH& GetBVH() const { return m_BVH; }
+        SceneBVH& GetBVH() { return m_BVH; }
+
+        void RegisterSystem(std::string name, SystemAccess access, SystemScheduler::SystemFunction function);
+        // World Matrix를 갱신한 뒤 등록된 System을 실행함.
+        void Update(float deltaSeconds);
+        const std::vector<SystemScheduler::SystemStats>& GetSystemStats() const { return m_SystemScheduler.GetStats(); }
+
+        entt::registry& GetRegistry() { return m_Registry; }
+        const entt::registry& GetRegistry() const { return m_Registry; }
+
+    private:
+        template <typename T>
+        void ReserveComponents(size_t count)
+        {
+            auto& storage = m_Registry.storage<T>();
+            storage.reserve(storage.size() + count);
+        }
+
+        // TransformComponent라면 Entity마다 OnTransformConstruct가 불리지 않도록 WorldTransformComponent를 따로 한 번에 넣음.
+        template <typename T, typename Insert>
+        void InsertComponents(std::span<const entt::entity> entities, Insert&& insert)
+        {
+            if constexpr (std::is_same_v<T, TransformComponent>)
+            {
+                m_Registry.on_construct<T>().template disconnect<&Scene::OnTransformConstruct>(*this);
+                insert();
+                m_Registry.on_construct<T>().template connect<&Scene::OnTransformConstruct>(*this);
+                AddWorldTransforms(entities);
+            }
+            else
+            {
+                insert();
+            }
+        }
+
+        void AddWorldTransforms(std::span<const entt::entity> entities);
+
+        void OnTransformConstruct(entt::registry& registry, entt::entity entityHandle);
+        void OnTransformUpdate(entt::registry& registry, entt::entity entityHandle);
+        void OnTransformDestroy(entt::registry& registry, entt::entity entityHandle);
+        void OnRelationshipDestroy(entt::registry& registry, entt::entity entityHandle);
+
+        void UpdateDirtyWorldTransforms();
+        void Detach(entt::entity entityHandle);
+        void RebuildTransformOrder();
+        void UpdateWorldTransformRange(size_t first, size_t last);
+
     private:
         entt::registry m_Registry;
+
+        // 깊이 우선 순서. 부모는 항상 자식보다 앞에 있음.
+        std::vector<entt::entity> m_TransformOrder;
+        // Transform과 Relationship의 Packed Array에서 Order 순서로 모여 있는 구간. RebuildTransformOrder에서 정함.
+        size_t m_TransformBegin = 0;
+        size_t m_RelationshipBegin = 0;
+        size_t m_RelationshipEnd = 0;
+        std::vector<entt::entity> m_DirtyTransforms;
+        bool m_bIsTransformOrderDirty = false;
+        TransformSoA m_TransformScratch;
+        std::vector<DirectX::XMFLOAT4X4> m_LocalMatrixScratch;
+
+        SystemScheduler m_SystemScheduler;
+        std::vector<std::unique_ptr<Prefab>> m_Prefabs;
+        // Registry의 Signal에 연결되므로 Registry보다 먼저 사라져야 함.
+        SceneBVH m_BVH;
     };
 }
@@ -0,0 +1,698 @@
+#include "EnginePCH.h"
+#include "SceneBVH.h"
+
+#include <numeric>
+
+#include "AssetManager.h"
+#include "Components.h"
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr uint32_t SAHBinCount = 16;
+
+        // Slab 검사. 닿는다면 들어가는 거리를 outDistance에 넣음.
+        bool IntersectRay(const AABB& bounds, const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& inverseDirection,
+                          float maxDistance, float& outDistance)
+        {
+            const DirectX::SimpleMath::Vector3 t0 = (bounds.Min - origin) * inverseDirection;
+            const DirectX::SimpleMath::Vector3 t1 = (bounds.Max - origin) * inverseDirection;
+            const DirectX::SimpleMath::Vector3 tMin = DirectX::SimpleMath::Vector3::Min(t0, t1);
+            const DirectX::SimpleMath::Vector3 tMax = DirectX::SimpleMath::Vector3::Max(t0, t1);
+            const float enter = std::max({tMin.x, tMin.y, tMin.z, 0.0f});
+            const float exit = std::min({tMax.x, tMax.y, tMax.z, maxDistance});
+            outDistance = enter;
+            return enter <= exit;
+        }
+
+        float GetAxis(const DirectX::SimpleMath::Vector3& vector, uint32_t axis)
+        {
+            return axis == 0 ? vector.x : axis == 1 ? vector.y : vector.z;
+        }
+    }
+
+    SceneBVH::SceneBVH(entt::registry& registry, Settings settings)
+        : m_Registry(registry),
+          m_Settings(settings),
+          m_Observer(registry, entt::collector
+                     .group<WorldTransformComponent, MeshRenderComponent>()
+                     .update<WorldTransformComponent>().where<MeshRenderComponent>()
+                     .update<MeshRenderComponent>().where<WorldTransformComponent>())
+    {
+        m_Registry.on_destroy<WorldTransformComponent>().connect<&SceneBVH::OnDestroy>(*this);
+        m_Registry.on_destroy<MeshRenderComponent>().connect<&SceneBVH::OnDestroy>(*this);
+    }
+
+    SceneBVH::~SceneBVH()
+    {
+        m_Registry.on_destroy<WorldTransformComponent>().disconnect<&SceneBVH::OnDestroy>(*this);
+        m_Registry.on_destroy<MeshRenderComponent>().disconnect<&SceneBVH::OnDestroy>(*this);
+    }
+
+    void SceneBVH::Update()
+    {
+        m_Stats.UpdatedLeafCount = static_cast<uint32_t>(m_Observer.size());
+        m_Stats.ReinsertedLeafCount = 0;
+        if (m_Observer.empty())
+        {
+            return;
+        }
+
+        for (const entt::entity entity : m_Observer)
+        {
+            AABB bounds;
+            if (!ComputeWorldBounds(entity, bounds))
+            {
+                RemoveEntity(entity);
+                continue;
+            }
+
+            const auto index = static_cast<size_t>(entt::to_entity(entity));
+            if (index >= m_EntityLeaves.size())
+            {
+                m_EntityLeaves.resize(index + 1, NullNode);
+            }
+
+            int32_t leaf = m_EntityLeaves[index];
+            if (leaf == NullNode)
+            {
+                leaf = AllocateNode();
+                m_EntityLeaves[index] = leaf;
+                m_Nodes[leaf].Entity = entity;
+                m_Stats.LeafCount++;
+            }
+            else
+            {
+                m_Nodes[leaf].TightBounds = bounds;
+                if (m_Nodes[leaf].Bounds.Contains(bounds))
+                {
+                    continue;
+                }
+                RemoveLeaf(leaf);
+            }
+
+            const DirectX::SimpleMath::Vector3 margin(m_Settings.Margin);
+            m_Nodes[leaf].TightBounds = bounds;
+            m_Nodes[leaf].Bounds = {bounds.Min - margin, bounds.Max + margin};
+            InsertLeaf(leaf);
+            m_Stats.ReinsertedLeafCount++;
+        }
+        m_Observer.clear();
+
+        // Cost 계산은 전체 Node를 돌므로 충분히 많이 다시 넣었을 때만 확인함.
+        m_ReinsertedSinceCheck += m_Stats.ReinsertedLeafCount;
+        if (static_cast<float>(m_ReinsertedSinceCheck) > static_cast<float>(m_Stats.LeafCount) * m_Settings.RebuildCheckRatio)
+        {
+            m_ReinsertedSinceCheck = 0;
+            if (ComputeCost() > m_RebuiltCost * m_Settings.RebuildCostRatio)
+            {
+                Rebuild();
+            }
+        }
+        m_Stats.Height = m_Root != NullNode ? static_cast<uint32_t>(m_Nodes[m_Root].Height) : 0;
+    }
+
+    void SceneBVH::Rebuild()
+    {
+        // Leaf만 앞쪽으로 옮기고 내부 Node는 새로 만듦.
+        std::vector<Node> leaves;
+        leaves.reserve(m_Stats.LeafCount);
+        for (const Node& node : m_Nodes)
+        {
+            if (node.Height == 0)
+            {
+                leaves.push_back(node);
+            }
+        }
+
+        m_Nodes.clear();
+        m_Nodes.reserve(leaves.size() * 2);
+        m_FreeNode = NullNode;
+        m_Root = NullNode;
+        for (Node& leaf : leaves)
+        {
+            leaf.Parent = NullNode;
+            m_EntityLeaves[entt::to_entity(leaf.Entity)] = static_cast<int32_t>(m_Nodes.size());
+            m_Nodes.push_back(leaf);
+        }
+        m_Stats.RebuildCount++;
+        m_Stats.Height = 0;
+        if (leaves.empty())
+        {
+            m_RebuiltCost = 0.0f;
+            return;
+        }
+
+        struct BuildTask
+        {
+            uint32_t First = 0;
+            uint32_t Last = 0;
+            int32_t Parent = NullNode;
+            bool bIsLeft = false;
+        };
+
+        struct Bin
+        {
+            AABB Bounds;
+            uint32_t Count = 0;
+        };
+
+        std::vector<int32_t> leafIndices(leaves.size());
+        std::iota(leafIndices.begin(), leafIndices.end(), 0);
+        std::vector<BuildTask> tasks{{.First = 0, .Last = static_cast<uint32_t>(leafIndices.size())}};
+        std::vector<int32_t> internalNodes;
+        while (!tasks.empty())
+        {
+            const BuildTask task = tasks.back();
+            tasks.pop_back();
+
+            int32_t node = NullNode;
+            if (task.Last - task.First == 1)
+            {
+                node = leafIndices[task.First];
+            }
+            else
+            {
+                AABB centroidBounds;
+                for (uint32_t i = task.First; i < task.Last; ++i)
+                {
+                    const DirectX::SimpleMath::Vector3 center = m_Nodes[leafIndices[i]].Bounds.GetCenter();
+                    centroidBounds = AABB::Union(centroidBounds, {center, center});
+                }
+
+                const DirectX::SimpleMath::Vector3 extent = centroidBounds.Max - centroidBounds.Min;
+                const uint32_t axis = extent.x > extent.y && extent.x > extent.z ? 0 : extent.y > extent.z ? 1 : 2;
+                const float axisMin = GetAxis(centroidBounds.Min, axis);
+                const float axisExtent = GetAxis(extent, axis);
+
+                uint32_t middle = task.First + (task.Last - task.First) / 2;
+                if (axisExtent > 0.0f)
+                {
+                    const float binScale = static_cast<float>(SAHBinCount) / axisExtent;
+                    const auto getBin = [&](int32_t leaf)
+                    {
+                        const float offset = GetAxis(m_Nodes[leaf].Bounds.GetCenter(), axis) - axisMin;
+                        return std::min(static_cast<uint32_t>(offset * binScale), SAHBinCount - 1);
+                    };
+
+                    Bin bins[SAHBinCount];
+                    for (uint32_t i = task.First; i < task.Last; ++i)
+                    {
+                        Bin& bin = bins[getBin(leafIndices[i])];
+                        bin.Bounds = AABB::Union(bin.Bounds, m_Nodes[leafIndices[i]].Bounds);
+                        bin.Count++;
+                    }
+
+                    // 왼쪽에서 누적한 Cost를 저장해 두고 오른쪽에서 누적하며 가장 작은 분할을 찾음.
+                    float leftCosts[SAHBinCount - 1];
+                    AABB leftBounds;
+                    uint32_t leftCount = 0;
+                    for (uint32_t i = 0; i + 1 < SAHBinCount; ++i)
+                    {
+                        leftBounds = AABB::Union(leftBounds, bins[i].Bounds);
+                        leftCount += bins[i].Count;
+                        leftCosts[i] = leftCount > 0 ? leftBounds.GetSurfaceArea() * static_cast<float>(leftCount) : 0.0f;
+                    }
+
+                    float bestCost = FLT_MAX;
+                    uint32_t bestSplit = 0;
+                    AABB rightBounds;
+                    uint32_t rightCount = 0;
+                    for (uint32_t i = SAHBinCount - 1; i > 0; --i)
+                    {
+                        rightBounds = AABB::Union(rightBounds, bins[i].Bounds);
+                        rightCount += bins[i].Count;
+                        const float cost = leftCosts[i - 1] + (rightCount > 0 ? rightBounds.GetSurfaceArea() * static_cast<float>(rightCount) : 0.0f);
+                        if (cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestSplit = i;
+                        }
+                    }
+
+                    const auto it = std::partition(leafIndices.begin() + task.First, leafIndices.begin() + task.Last,
+                                                   [&](int32_t leaf) { return getBin(leaf) < bestSplit; });
+                    const auto split = static_cast<uint32_t>(it - leafIndices.begin());
+                    if (split != task.First && split != task.Last)
+                    {
+                        middle = split;
+                    }
+                }
+
+                node = AllocateNode();
+                m_Nodes[node].Height = 1;
+                internalNodes.push_back(node);
+                tasks.push_back({.First = middle, .Last = task.Last, .Parent = node, .bIsLeft = false});
+                tasks.push_back({.First = task.First, .Last = middle, .Parent = node, .bIsLeft = true});
+            }
+
+            m_Nodes[node].Parent = task.Parent;
+            if (task.Parent == NullNode)
+            {
+                m_Root = node;
+            }
+            else if (task.bIsLeft)
+            {
+                m_Nodes[task.Parent].Left = node;
+            }
+            else
+            {
+                m_Nodes[task.Parent].Right = node;
+            }
+        }
+
+        // 내부 Node는 부모가 자식보다 먼저 만들어졌으므로 거꾸로 돌면서 AABB와 높이를 채움.
+        for (auto it = internalNodes.rbegin(); it != internalNodes.rend(); ++it)
+        {
+            Node& node = m_Nodes[*it];
+            node.Bounds = AABB::Union(m_Nodes[node.Left].Bounds, m_Nodes[node.Right].Bounds);
+            node.Height = 1 + std::max(m_Nodes[node.Left].Height, m_Nodes[node.Right].Height);
+        }
+
+        m_RebuiltCost = ComputeCost();
+        m_ReinsertedSinceCheck = 0;
+        m_Stats.Height = static_cast<uint32_t>(m_Nodes[m_Root].Height);
+    }
+
+    void SceneBVH::QueryFrustum(const DirectX::BoundingFrustum& frustum, std::vector<entt::entity>& outEntities) const
+    {
+        Query([&](const AABB& bounds) { return frustum.Intersects(bounds.ToBoundingBox()); },
+              [&](const AABB& bounds) { return frustum.Contains(bounds.ToBoundingBox()) == DirectX::CONTAINS; }, outEntities);
+    }
+
+    void SceneBVH::QuerySphere(const DirectX::BoundingSphere& sphere, std::vector<entt::entity>& outEntities) const
+    {
+        Query([&](const AABB& bounds) { return sphere.Intersects(bounds.ToBoundingBox()); },
+              [&](const AABB& bounds) { return sphere.Contains(bounds.ToBoundingBox()) == DirectX::CONTAINS; }, outEntities);
+    }
+
+    void SceneBVH::QueryBox(const AABB& box, std::vector<entt::entity>& outEntities) const
+    {
+        Query([&](const AABB& bounds) { return box.Intersects(bounds); },
+              [&](const AABB& bounds) { return box.Contains(bounds); }, outEntities);
+    }
+
+    bool SceneBVH::RayCast(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance,
+                           entt::entity& outEntity, float& outDistance) const
+    {
+        outEntity = entt::null;
+        outDistance = maxDistance;
+        if (m_Root == NullNode)
+        {
+            return false;
+        }
+
+        // 0으로 나누면 무한대가 되어 그 축의 Slab은 항상 통과하거나 항상 실패함.
+        const DirectX::SimpleMath::Vector3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        std::vector<std::pair<int32_t, float>> stack;
+        float rootDistance = 0.0f;
+        if (IntersectRay(m_Nodes[m_Root].Bounds, origin, inverseDirection, maxDistance, rootDistance))
+        {
+            stack.emplace_back(m_Root, rootDistance);
+        }
+
+        while (!stack.empty())
+        {
+            const auto [nodeIndex, distance] = stack.back();
+            stack.pop_back();
+            // 더 가까운 Entity를 이미 찾았다면 건너뜀.
+            if (distance > outDistance)
+            {
+                continue;
+            }
+
+            const Node& node = m_Nodes[nodeIndex];
+            if (node.IsLeaf())
+            {
+                float leafDistance = 0.0f;
+                if (IntersectRay(node.TightBounds, origin, inverseDirection, outDistance, leafDistance))
+                {
+                    outEntity = node.Entity;
+                    outDistance = leafDistance;
+                }
+                continue;
+            }
+
+            // 가까운 자식을 나중에 넣어 먼저 방문함.
+            float leftDistance = 0.0f;
+            float rightDistance = 0.0f;
+            const bool bHitsLeft = IntersectRay(m_Nodes[node.Left].Bounds, origin, inverseDirection, outDistance, leftDistance);
+            const bool bHitsRight = IntersectRay(m_Nodes[node.Right].Bounds, origin, inverseDirection, outDistance, rightDistance);
+            if (bHitsLeft && bHitsRight)
+            {
+                const bool bIsLeftCloser = leftDistance <= rightDistance;
+                stack.emplace_back(bIsLeftCloser ? node.Right : node.Left, bIsLeftCloser ? rightDistance : leftDistance);
+                stack.emplace_back(bIsLeftCloser ? node.Left : node.Right, bIsLeftCloser ? leftDistance : rightDistance);
+            }
+            else if (bHitsLeft)
+            {
+                stack.emplace_back(node.Left, leftDistance);
+            }
+            else if (bHitsRight)
+            {
+                stack.emplace_back(node.Right, rightDistance);
+            }
+        }
+        return outEntity != entt::null;
+    }
+
+    const AABB* SceneBVH::GetBounds(entt::entity entity) const
+    {
+        const auto index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= m_EntityLeaves.size() || m_EntityLeaves[index] == NullNode || m_Nodes[m_EntityLeaves[index]].Entity != entity)
+        {
+            return nullptr;
+        }
+        return &m_Nodes[m_EntityLeaves[index]].TightBounds;
+    }
+
+    float SceneBVH::ComputeCost() const
+    {
+        if (m_Root == NullNode)
+        {
+            return 0.0f;
+        }
+
+        float internalArea = 0.0f;
+        for (const Node& node : m_Nodes)
+        {
+            if (node.Height > 0)
+            {
+                internalArea += node.Bounds.GetSurfaceArea();
+            }
+        }
+        const float rootArea = m_Nodes[m_Root].Bounds.GetSurfaceArea();
+        return rootArea > 0.0f ? internalArea / rootArea : 0.0f;
+    }
+
+    int32_t SceneBVH::AllocateNode()
+    {
+        int32_t node = m_FreeNode;
+        if (node != NullNode)
+        {
+            m_FreeNode = m_Nodes[node].Parent;
+        }
+        else
+        {
+            node = static_cast<int32_t>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+
+        m_Nodes[node] = {};
+        return node;
+    }
+
+    void SceneBVH::FreeNode(int32_t node)
+    {
+        m_Nodes[node] = {};
+        m_Nodes[node].Parent = m_FreeNode;
+        m_Nodes[node].Height = -1;
+        m_FreeNode = node;
+    }
+
+    void SceneBVH::InsertLeaf(int32_t leaf)
+    {
+        if (m_Root == NullNode)
+        {
+            m_Root = leaf;
+            m_Nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // 새 부모를 만들었을 때 늘어나는 넓이와, 내려가면서 조상이 넓어지는 넓이를 합한 Cost가 가장 작은 형제를 찾음.
+        const AABB leafBounds = m_Nodes[leaf].Bounds;
+        int32_t sibling = m_Root;
+        while (!m_Nodes[sibling].IsLeaf())
+        {
+            const Node& node = m_Nodes[sibling];
+            const float area = node.Bounds.GetSurfaceArea();
+            const float combinedArea = AABB::Union(node.Bounds, leafBounds).GetSurfaceArea();
+            const float cost = 2.0f * combinedArea;
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            const auto getDescendCost = [&](int32_t child)
+            {
+                const Node& childNode = m_Nodes[child];
+                const float childCombinedArea = AABB::Union(childNode.Bounds, leafBounds).GetSurfaceArea();
+                return (childNode.IsLeaf() ? childCombinedArea : childCombinedArea - childNode.Bounds.GetSurfaceArea()) + inheritanceCost;
+            };
+
+            const float leftCost = getDescendCost(node.Left);
+            const float rightCost = getDescendCost(node.Right);
+            if (cost < leftCost && cost < rightCost)
+            {
+                break;
+            }
+            sibling = leftCost < rightCost ? node.Left : node.Right;
+        }
+
+        const int32_t oldParent = m_Nodes[sibling].Parent;
+        const int32_t newParent = AllocateNode();
+        Node& parentNode = m_Nodes[newParent];
+        parentNode.Parent = oldParent;
+        parentNode.Bounds = AABB::Union(leafBounds, m_Nodes[sibling].Bounds);
+        parentNode.Height = m_Nodes[sibling].Height + 1;
+        parentNode.Left = sibling;
+        parentNode.Right = leaf;
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent = newParent;
+
+        if (oldParent == NullNode)
+        {
+            m_Root = newParent;
+        }
+        else if (m_Nodes[oldParent].Left == sibling)
+        {
+            m_Nodes[oldParent].Left = newParent;
+        }
+        else
+        {
+            m_Nodes[oldParent].Right = newParent;
+        }
+
+        RefitAncestors(newParent);
+    }
+
+    void SceneBVH::RemoveLeaf(int32_t leaf)
+    {
+        if (leaf == m_Root)
+        {
+            m_Root = NullNode;
+            return;
+        }
+
+        // 부모를 지우고 형제를 그 자리로 올림.
+        const int32_t parent = m_Nodes[leaf].Parent;
+        const int32_t grandParent = m_Nodes[parent].Parent;
+        const int32_t sibling = m_Nodes[parent].Left == leaf ? m_Nodes[parent].Right : m_Nodes[parent].Left;
+        m_Nodes[sibling].Parent = grandParent;
+        m_Nodes[leaf].Parent = NullNode;
+        FreeNode(parent);
+
+        if (grandParent == NullNode)
+        {
+            m_Root = sibling;
+            return;
+        }
+
+        if (m_Nodes[grandParent].Left == parent)
+        {
+            m_Nodes[grandParent].Left = sibling;
+        }
+        else
+        {
+            m_Nodes[grandParent].Right = sibling;
+        }
+        RefitAncestors(grandParent);
+    }
+
+    void SceneBVH::RefitAncestors(int32_t node)
+    {
+        for (int32_t index = node; index != NullNode; index = m_Nodes[index].Parent)
+        {
+            index = Balance(index);
+            Node& current = m_Nodes[index];
+            current.Bounds = AABB::Union(m_Nodes[current.Left].Bounds, m_Nodes[current.Right].Bounds);
+            current.Height = 1 + std::max(m_Nodes[current.Left].Height, m_Nodes[current.Right].Height);
+        }
+    }
+
+    int32_t SceneBVH::Balance(int32_t indexA)
+    {
+        Node& a = m_Nodes[indexA];
+        if (a.IsLeaf() || a.Height < 2)
+        {
+            return indexA;
+        }
+
+        const int32_t indexB = a.Left;
+        const int32_t indexC = a.Right;
+        Node& b = m_Nodes[indexB];
+        Node& c = m_Nodes[indexC];
+        const int32_t balance = c.Height - b.Height;
+
+        const auto replaceChild = [&](int32_t parent, int32_t oldChild, int32_t newChild)
+        {
+            if (parent == NullNode)
+            {
+                m_Root = newChild;
+            }
+            else if (m_Nodes[parent].Left == oldChild)
+            {
+                m_Nodes[parent].Left = newChild;
+            }
+            else
+            {
+                m_Nodes[parent].Right = newChild;
+            }
+        };
+
+        // C가 더 높다면 C를 A 자리로 올리고, C의 자식 중 높은 쪽을 C에 남기고 낮은 쪽을 A에 붙임.
+        if (balance > 1)
+        {
+            const int32_t indexF = c.Left;
+            const int32_t indexG = c.Right;
+            Node& f = m_Nodes[indexF];
+            Node& g = m_Nodes[indexG];
+
+            c.Left = indexA;
+            c.Parent = a.Parent;
+            a.Parent = indexC;
+            replaceChild(c.Parent, indexA, indexC);
+
+            const bool bKeepsF = f.Height > g.Height;
+            const int32_t indexKept = bKeepsF ? indexF : indexG;
+            const int32_t indexMoved = bKeepsF ? indexG : indexF;
+            c.Right = indexKept;
+            a.Right = indexMoved;
+            m_Nodes[indexMoved].Parent = indexA;
+            a.Bounds = AABB::Union(b.Bounds, m_Nodes[indexMoved].Bounds);
+            c.Bounds = AABB::Union(a.Bounds, m_Nodes[indexKept].Bounds);
+            a.Height = 1 + std::max(b.Height, m_Nodes[indexMoved].Height);
+            c.Height = 1 + std::max(a.Height, m_Nodes[indexKept].Height);
+            return indexC;
+        }
+
+        // B가 더 높다면 반대로 B를 올림.
+        if (balance < -1)
+        {
+            const int32_t indexD = b.Left;
+            const int32_t indexE = b.Right;
+            Node& d = m_Nodes[indexD];
+            Node& e = m_Nodes[indexE];
+
+            b.Left = indexA;
+            b.Parent = a.Parent;
+            a.Parent = indexB;
+            replaceChild(b.Parent, indexA, indexB);
+
+            const bool bKeepsD = d.Height > e.Height;
+            const int32_t indexKept = bKeepsD ? indexD : indexE;
+            const int32_t indexMoved = bKeepsD ? indexE : indexD;
+            b.Right = indexKept;
+            a.Left = indexMoved;
+            m_Nodes[indexMoved].Parent = indexA;
+            a.Bounds = AABB::Union(c.Bounds, m_Nodes[indexMoved].Bounds);
+            b.Bounds = AABB::Union(a.Bounds, m_Nodes[indexKept].Bounds);
+            a.Height = 1 + std::max(c.Height, m_Nodes[indexMoved].Height);
+            b.Height = 1 + std::max(a.Height, m_Nodes[indexKept].Height);
+            return indexB;
+        }
+
+        return indexA;
+    }
+
+    void SceneBVH::RemoveEntity(entt::entity entity)
+    {
+        const auto index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= m_EntityLeaves.size() || m_EntityLeaves[index] == NullNode)
+        {
+            return;
+        }
+
+        const int32_t leaf = m_EntityLeaves[index];
+        RemoveLeaf(leaf);
+        FreeNode(leaf);
+        m_EntityLeaves[index] = NullNode;
+        m_Stats.LeafCount--;
+    }
+
+    bool SceneBVH::ComputeWorldBounds(entt::entity entity, AABB& outBounds) const
+    {
+        const auto& meshRender = m_Registry.get<MeshRenderComponent>(entity);
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        if (!meshRender.Mesh || !meshPool.IsValid(meshRender.Mesh))
+        {
+            return false;
+        }
+
+        DirectX::BoundingBox worldBox;
+        meshPool.Get(meshRender.Mesh).Bounds.Transform(worldBox, m_Registry.get<WorldTransformComponent>(entity).World);
+        outBounds = AABB::FromBoundingBox(worldBox);
+        return true;
+    }
+
+    void SceneBVH::OnDestroy(entt::registry& registry, entt::entity entity)
+    {
+        RemoveEntity(entity);
+    }
+
+    template <typename Overlap, typename Contain>
+    void SceneBVH::Query(Overlap&& overlaps, Contain&& contains, std::vector<entt::entity>& outEntities) const
+    {
+        if (m_Root == NullNode)
+        {
+            return;
+        }
+
+        std::vector<int32_t> stack{m_Root};
+        while (!stack.empty())
+        {
+            const Node& node = m_Nodes[stack.back()];
+            const int32_t nodeIndex = stack.back();
+            stack.pop_back();
+
+            if (node.IsLeaf())
+            {
+                if (overlaps(node.TightBounds))
+                {
+                    outEntities.push_back(node.Entity);
+                }
+                continue;
+            }
+
+            if (!overlaps(node.Bounds))
+            {
+                continue;
+            }
+            // 완전히 안쪽인 Subtree는 더 검사하지 않고 모두 넣음. 넓힌 AABB가 안쪽이면 원래 AABB도 안쪽임.
+            if (contains(node.Bounds))
+            {
+                CollectLeaves(nodeIndex, outEntities);
+                continue;
+            }
+            stack.push_back(node.Left);
+            stack.push_back(node.Right);
+        }
+    }
+
+    void SceneBVH::CollectLeaves(int32_t node, std::vector<entt::entity>& outEntities) const
+    {
+        std::vector<int32_t> stack{node};
+        while (!stack.empty())
+        {
+            const Node& current = m_Nodes[stack.back()];
+            stack.pop_back();
+            if (current.IsLeaf())
+            {
+                outEntities.push_back(current.Entity);
+            }
+            else
+            {
+                stack.push_back(current.Left);
+                stack.push_back(current.Right);
+            }
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <cfloat>
+#include <vector>
+#include <entt/entt.hpp>
+#include <SimpleMath.h>
+
+namespace Engine
+{
+    // 최소/최대 좌표로 표현한 AABB. DirectX::BoundingBox보다 합치기와 넓이 계산이 단순함.
+    struct AABB
+    {
+        DirectX::SimpleMath::Vector3 Min{FLT_MAX, FLT_MAX, FLT_MAX};
+        DirectX::SimpleMath::Vector3 Max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+        static AABB FromBoundingBox(const DirectX::BoundingBox& box)
+        {
+            return {DirectX::SimpleMath::Vector3(box.Center) - box.Extents, DirectX::SimpleMath::Vector3(box.Center) + box.Extents};
+        }
+
+        static AABB Union(const AABB& lhs, const AABB& rhs)
+        {
+            return {DirectX::SimpleMath::Vector3::Min(lhs.Min, rhs.Min), DirectX::SimpleMath::Vector3::Max(lhs.Max, rhs.Max)};
+        }
+
+        DirectX::BoundingBox ToBoundingBox() const { return {GetCenter(), (Max - Min) * 0.5f}; }
+        DirectX::SimpleMath::Vector3 GetCenter() const { return (Min + Max) * 0.5f; }
+
+        float GetSurfaceArea() const
+        {
+            const DirectX::SimpleMath::Vector3 size = Max - Min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        bool Contains(const AABB& other) const
+        {
+            return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+                && other.Max.x <= Max.x && other.Max.y <= Max.y && other.Max.z <= Max.z;
+        }
+
+        bool Intersects(const AABB& other) const
+        {
+            return Min.x <= other.Max.x && other.Min.x <= Max.x
+                && Min.y <= other.Max.y && other.Min.y <= Max.y
+                && Min.z <= other.Max.z && other.Min.z <= Max.z;
+        }
+    };
+
+    // MeshRenderComponent와 WorldTransformComponent를 가진 Entity의 World AABB로 만든 Dynamic AABB Tree.
+    // Observer가 World Matrix나 Mesh가 바뀐 Entity만 모아 두고 Update에서 그 Entity의 Leaf만 고침.
+    // Leaf는 Margin만큼 넓힌 AABB를 가지므로 그 안에서 움직이는 동안에는 Tree를 바꾸지 않고, 벗어나면 빼서 다시 넣음.
+    // 다시 넣을 때는 SAH Cost가 가장 적게 늘어나는 위치를 찾고 회전으로 높이를 맞추므로 Update는 O(log n)임.
+    // 다시 넣은 Leaf가 쌓여 Tree 품질이 떨어지면 Binned SAH로 전체를 다시 만듦.
+    class SceneBVH
+    {
+    public:
+        struct Settings
+        {
+            // Leaf AABB를 각 축으로 넓히는 거리.
+            float Margin = 0.5f;
+            // 다시 넣은 Leaf 수가 전체의 이 비율을 넘을 때마다 Tree 품질을 확인함.
+            float RebuildCheckRatio = 0.25f;
+            // SAH Cost가 마지막으로 다시 만든 직후보다 이 배율 이상 커졌다면 다시 만듦.
+            float RebuildCostRatio = 1.3f;
+        };
+
+        struct Stats
+        {
+            uint32_t LeafCount = 0;
+            uint32_t Height = 0;
+            uint32_t RebuildCount = 0;
+            // 마지막 Update에서 Observer로 받은 Entity 수와 Tree에 새로 넣거나 빼서 다시 넣은 Leaf 수.
+            uint32_t UpdatedLeafCount = 0;
+            uint32_t ReinsertedLeafCount = 0;
+        };
+
+    public:
+        explicit SceneBVH(entt::registry& registry, Settings settings = {});
+        ~SceneBVH();
+
+        SceneBVH(const SceneBVH&) = delete;
+        SceneBVH& operator=(const SceneBVH&) = delete;
+
+        // World Matrix가 갱신된 뒤에 호출해야 함. Scene::UpdateWorldTransforms가 호출함.
+        void Update();
+        // 모든 Leaf로 Binned SAH Tree를 다시 만듦.
+        void Rebuild();
+
+        // 결과는 outEntities 뒤에 덧붙임. Leaf는 넓히지 않은 AABB로 검사함.
+        void QueryFrustum(const DirectX::BoundingFrustum& frustum, std::vector<entt::entity>& outEntities) const;
+        void QuerySphere(const DirectX::BoundingSphere& sphere, std::vector<entt::entity>& outEntities) const;
+        void QueryBox(const AABB& box, std::vector<entt::entity>& outEntities) const;
+        // AABB에 가장 먼저 닿는 Entity를 찾음. 거리는 direction 길이를 1로 하는 단위이며 maxDistance 안에서만 찾음.
+        bool RayCast(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance,
+                     entt::entity& outEntity, float& outDistance) const;
+
+        // Tree에 없는 Entity라면 nullptr를 반환함.
+        const AABB* GetBounds(entt::entity entity) const;
+        // 내부 Node 넓이의 합을 Root 넓이로 나눈 값. 작을수록 Query에서 방문하는 Node가 적음.
+        float ComputeCost() const;
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        static constexpr int32_t NullNode = -1;
+
+        struct Node
+        {
+            // Leaf라면 Margin만큼 넓힌 AABB임.
+            AABB Bounds;
+            AABB TightBounds;
+            entt::entity Entity = entt::null;
+            // Free List에 있는 Node는 Parent에 다음 빈 Node를 가짐.
+            int32_t Parent = NullNode;
+            int32_t Left = NullNode;
+            int32_t Right = NullNode;
+            // Leaf는 0, 빈 Node는 -1임.
+            int32_t Height = 0;
+
+            bool IsLeaf() const { return Left == NullNode; }
+        };
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t node);
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        // AVL 회전으로 양쪽 높이 차이를 1 이하로 맞추고 그 자리의 새 Node를 반환함.
+        int32_t Balance(int32_t node);
+        void RefitAncestors(int32_t node);
+
+        void RemoveEntity(entt::entity entity);
+        bool ComputeWorldBounds(entt::entity entity, AABB& outBounds) const;
+        void OnDestroy(entt::registry& registry, entt::entity entity);
+
+        template <typename Overlap, typename Contain>
+        void Query(Overlap&& overlaps, Contain&& contains, std::vector<entt::entity>& outEntities) const;
+        void CollectLeaves(int32_t node, std::vector<entt::entity>& outEntities) const;
+
+    private:
+        entt::registry& m_Registry;
+        Settings m_Settings;
+        entt::observer m_Observer;
+
+        std::vector<Node> m_Nodes;
+        int32_t m_Root = NullNode;
+        int32_t m_FreeNode = NullNode;
+        // Entity Index로 찾는 Leaf Node.
+        std::vector<int32_t> m_EntityLeaves;
+
+        uint32_t m_ReinsertedSinceCheck = 0;
+        float m_RebuiltCost = 0.0f;
+        Stats m_Stats;
+    };
+}
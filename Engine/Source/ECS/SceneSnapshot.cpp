@@ -0,0 +1,828 @@
+#include "EnginePCH.h"
+#include "SceneSnapshot.h"
+
+#include <chrono>
+#include <fstream>
+
+#include "AssetManager.h"
+#include "Components.h"
+#include "Scene.h"
+#include "Core/MappedFile.h"
+
+namespace Engine
+{
+    // Component Storage 하나. Index 배열의 i번째 값은 Component 배열의 i번째 Component를 가진 Entity의 Entity Table 위치임.
+    struct SnapshotSectionHeader
+    {
+        entt::id_type TypeId = 0;
+        uint32_t Version = 0;
+        uint32_t ElementSize = 0;
+        uint32_t Count = 0;
+        uint64_t IndexOffset = 0;
+        uint64_t DataOffset = 0;
+        // 문자열처럼 Component 배열에 직접 넣을 수 없는 가변 길이 데이터.
+        uint64_t ExtraOffset = 0;
+        uint64_t ExtraSize = 0;
+    };
+
+    namespace
+    {
+        constexpr uint32_t SnapshotMagic = 0x4e534745; // "EGSN"
+        constexpr uint32_t SnapshotVersion = 1;
+        // Mapping된 파일에서 Component 배열을 그대로 읽을 수 있도록 모든 배열을 정렬함.
+        constexpr uint64_t SnapshotAlignment = 16;
+        constexpr uint32_t InvalidIndex = UINT32_MAX;
+        // Open에서 Page를 미리 읽을 때의 간격.
+        constexpr size_t PageSize = 4096;
+
+        struct SnapshotHeader
+        {
+            uint32_t Magic = SnapshotMagic;
+            uint32_t Version = SnapshotVersion;
+            uint32_t EntityCount = 0;
+            uint32_t SectionCount = 0;
+            uint64_t EntityTableOffset = 0;
+            uint64_t SectionTableOffset = 0;
+        };
+
+        // Extra 영역의 문자열 위치.
+        struct StringEntry
+        {
+            uint32_t Offset = 0;
+            uint32_t Length = 0;
+        };
+
+        // MeshRenderComponent Section의 Extra 영역은 AssetTableHeader, AssetEntry 배열, 문자열 순서로 놓임.
+        struct AssetTableHeader
+        {
+            uint32_t AssetCount = 0;
+            uint32_t Padding = 0;
+        };
+
+        struct AssetEntry
+        {
+            entt::id_type Id = 0;
+            StringEntry SourcePath;
+        };
+
+        // Component 구조가 바뀌면 Version을 올려야 함. Version이나 크기가 다른 Section은 불러오지 않음.
+        template <typename Type>
+        struct SnapshotTraits;
+
+        template <>
+        struct SnapshotTraits<DisplayNameComponent>
+        {
+            using StoredType = StringEntry;
+            static constexpr entt::id_type TypeId = entt::hashed_string::value("DisplayNameComponent");
+            static constexpr uint32_t Version = 1;
+        };
+
+        template <>
+        struct SnapshotTraits<TransformComponent>
+        {
+            using StoredType = TransformComponent;
+            static constexpr entt::id_type TypeId = entt::hashed_string::value("TransformComponent");
+            static constexpr uint32_t Version = 1;
+        };
+
+        template <>
+        struct SnapshotTraits<RelationshipComponent>
+        {
+            using StoredType = RelationshipComponent;
+            static constexpr entt::id_type TypeId = entt::hashed_string::value("RelationshipComponent");
+            static constexpr uint32_t Version = 1;
+        };
+
+        template <>
+        struct SnapshotTraits<LightComponent>
+        {
+            using StoredType = LightComponent;
+            static constexpr entt::id_type TypeId = entt::hashed_string::value("LightComponent");
+            static constexpr uint32_t Version = 2;
+        };
+
+        template <>
+        struct SnapshotTraits<MeshRenderComponent>
+        {
+            // AssetTable의 Index.
+            using StoredType = uint32_t;
+            static constexpr entt::id_type TypeId = entt::hashed_string::value("MeshRenderComponent");
+            static constexpr uint32_t Version = 1;
+        };
+
+        class SnapshotWriter
+        {
+        public:
+            explicit SnapshotWriter(const std::filesystem::path& filePath)
+                : m_File(filePath, std::ios::binary | std::ios::trunc)
+            {
+            }
+
+            bool IsOpen() const { return static_cast<bool>(m_File); }
+
+            // 정렬된 위치에 기록하고 그 위치를 반환함.
+            uint64_t Write(const void* data, size_t sizeInBytes)
+            {
+                constexpr char padding[SnapshotAlignment]{};
+                const uint64_t paddingSize = (SnapshotAlignment - m_Offset % SnapshotAlignment) % SnapshotAlignment;
+                m_File.write(padding, static_cast<std::streamsize>(paddingSize));
+                m_Offset += paddingSize;
+
+                const uint64_t offset = m_Offset;
+                m_File.write(static_cast<const char*>(data), static_cast<std::streamsize>(sizeInBytes));
+                m_Offset += sizeInBytes;
+                return offset;
+            }
+
+            template <typename Type>
+            uint64_t WriteArray(const std::vector<Type>& values)
+            {
+                return Write(values.data(), values.size() * sizeof(Type));
+            }
+
+            bool Finish(const SnapshotHeader& header)
+            {
+                m_File.seekp(0);
+                m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                m_File.flush();
+                return static_cast<bool>(m_File);
+            }
+
+        private:
+            std::ofstream m_File;
+            uint64_t m_Offset = 0;
+        };
+
+        class SnapshotReader
+        {
+        public:
+            SnapshotReader(const uint8_t* data, size_t sizeInBytes)
+                : m_Data(data), m_Size(sizeInBytes)
+            {
+            }
+
+            // 파일 범위를 벗어나거나 정렬되지 않았다면 nullptr를 반환함.
+            template <typename Type>
+            const Type* Get(uint64_t offset, uint64_t count) const
+            {
+                if (offset > m_Size || count > (m_Size - offset) / sizeof(Type) || offset % alignof(Type) != 0)
+                {
+                    return nullptr;
+                }
+                return reinterpret_cast<const Type*>(m_Data + offset);
+            }
+
+        private:
+            const uint8_t* m_Data = nullptr;
+            size_t m_Size = 0;
+        };
+
+        // 문자열을 blob 끝에 붙이고 그 위치를 반환함.
+        StringEntry AppendString(std::vector<char>& blob, std::string_view string)
+        {
+            const StringEntry entry{.Offset = static_cast<uint32_t>(blob.size()), .Length = static_cast<uint32_t>(string.size())};
+            blob.insert(blob.end(), string.begin(), string.end());
+            return entry;
+        }
+
+        std::optional<std::string_view> GetString(const char* blob, uint64_t blobSize, const StringEntry& entry)
+        {
+            if (entry.Offset > blobSize || entry.Length > blobSize - entry.Offset)
+            {
+                return std::nullopt;
+            }
+            return std::string_view(blob + entry.Offset, entry.Length);
+        }
+
+        template <typename Type>
+        void AppendBytes(std::vector<uint8_t>& bytes, const Type* values, size_t count)
+        {
+            const auto* begin = reinterpret_cast<const uint8_t*>(values);
+            bytes.insert(bytes.end(), begin, begin + count * sizeof(Type));
+        }
+
+        // 저장하는 Entity라면 Entity Table의 위치를, 아니라면 InvalidIndex를 반환함.
+        uint32_t GetEntityIndex(const std::vector<uint32_t>& entityIndices, entt::entity entity)
+        {
+            const auto index = static_cast<size_t>(entt::to_entity(entity));
+            return index < entityIndices.size() ? entityIndices[index] : InvalidIndex;
+        }
+
+        // Storage를 Packed Array 순서대로 모음. 불러올 때 같은 순서로 들어가므로 정렬 상태가 유지됨.
+        // convert는 Component를 파일에 기록할 형태로 바꿈.
+        template <typename Type, typename Convert>
+        void CollectElements(const entt::registry& registry, const std::vector<uint32_t>& entityIndices,
+                             std::vector<uint32_t>& outIndices, std::vector<typename SnapshotTraits<Type>::StoredType>& outElements, Convert&& convert)
+        {
+            const auto* storage = registry.storage<Type>();
+            if (!storage)
+            {
+                return;
+            }
+
+            outIndices.reserve(outIndices.size() + storage->size());
+            outElements.reserve(outElements.size() + storage->size());
+            for (const auto [entity, component] : storage->reach())
+            {
+                if (const uint32_t index = GetEntityIndex(entityIndices, entity); index != InvalidIndex)
+                {
+                    outIndices.push_back(index);
+                    outElements.push_back(convert(component));
+                }
+            }
+        }
+
+        // 모은 Component를 하나의 Section으로 기록함.
+        template <typename Type>
+        SnapshotSectionHeader* WriteElements(SnapshotWriter& writer, std::vector<SnapshotSectionHeader>& sections,
+                                             const std::vector<uint32_t>& indices, const std::vector<typename SnapshotTraits<Type>::StoredType>& elements)
+        {
+            using StoredType = typename SnapshotTraits<Type>::StoredType;
+
+            if (elements.empty())
+            {
+                return nullptr;
+            }
+
+            SnapshotSectionHeader& section = sections.emplace_back();
+            section.TypeId = SnapshotTraits<Type>::TypeId;
+            section.Version = SnapshotTraits<Type>::Version;
+            section.ElementSize = sizeof(StoredType);
+            section.Count = static_cast<uint32_t>(elements.size());
+            section.IndexOffset = writer.WriteArray(indices);
+            section.DataOffset = writer.WriteArray(elements);
+            return &section;
+        }
+
+        template <typename Type, typename Convert>
+        SnapshotSectionHeader* WriteSection(SnapshotWriter& writer, const entt::registry& registry, const std::vector<uint32_t>& entityIndices,
+                                    std::vector<SnapshotSectionHeader>& sections, Convert&& convert)
+        {
+            std::vector<uint32_t> indices;
+            std::vector<typename SnapshotTraits<Type>::StoredType> elements;
+            CollectElements<Type>(registry, entityIndices, indices, elements, std::forward<Convert>(convert));
+            return WriteElements<Type>(writer, sections, indices, elements);
+        }
+
+        template <typename Type>
+        void WriteTrivialSection(SnapshotWriter& writer, const entt::registry& registry, const std::vector<uint32_t>& entityIndices, std::vector<SnapshotSectionHeader>& sections)
+        {
+            static_assert(std::is_trivially_copyable_v<Type>);
+            WriteSection<Type>(writer, registry, entityIndices, sections, [](const Type& component) { return component; });
+        }
+
+        template <typename Type>
+        const typename SnapshotTraits<Type>::StoredType* GetElements(const SnapshotReader& reader, const SnapshotSectionHeader& section)
+        {
+            return reader.Get<typename SnapshotTraits<Type>::StoredType>(section.DataOffset, section.Count);
+        }
+
+        template <typename Type>
+        void ReserveStorage(entt::registry& registry, size_t count)
+        {
+            auto& storage = registry.storage<Type>();
+            storage.reserve(storage.size() + count);
+        }
+
+        struct AssetTable
+        {
+            const AssetTableHeader* Header = nullptr;
+            const AssetEntry* Entries = nullptr;
+            const char* Strings = nullptr;
+            uint64_t StringsSize = 0;
+        };
+
+        std::optional<AssetTable> GetAssetTable(const SnapshotReader& reader, const SnapshotSectionHeader& section)
+        {
+            AssetTable table;
+            table.Header = reader.Get<AssetTableHeader>(section.ExtraOffset, 1);
+            if (!table.Header || section.ExtraSize < sizeof(AssetTableHeader))
+            {
+                return std::nullopt;
+            }
+
+            const uint64_t entriesSize = static_cast<uint64_t>(table.Header->AssetCount) * sizeof(AssetEntry);
+            if (entriesSize > section.ExtraSize - sizeof(AssetTableHeader))
+            {
+                return std::nullopt;
+            }
+
+            table.Entries = reader.Get<AssetEntry>(section.ExtraOffset + sizeof(AssetTableHeader), table.Header->AssetCount);
+            table.StringsSize = section.ExtraSize - sizeof(AssetTableHeader) - entriesSize;
+            table.Strings = reader.Get<char>(section.ExtraOffset + sizeof(AssetTableHeader) + entriesSize, table.StringsSize);
+            if (!table.Entries || !table.Strings)
+            {
+                return std::nullopt;
+            }
+            return table;
+        }
+
+        // Version과 크기가 다르면 불러오지 않을 Section이므로 따로 확인함.
+        template <typename Type>
+        bool IsCompatible(const SnapshotSectionHeader& section)
+        {
+            if (section.Version != SnapshotTraits<Type>::Version || section.ElementSize != sizeof(typename SnapshotTraits<Type>::StoredType))
+            {
+                spdlog::warn("Scene snapshot: skipped {} section (version {}, element size {})", entt::type_name<Type>::value(), section.Version, section.ElementSize);
+                return false;
+            }
+            return true;
+        }
+
+        // 범위와 Entity Index를 검사함. 같은 Entity가 두 번 나오면 Component를 넣을 수 없으므로 손상된 것으로 봄.
+        template <typename Type>
+        bool ValidateElements(const SnapshotReader& reader, const SnapshotSectionHeader& section, uint32_t entityCount)
+        {
+            const auto* indices = reader.Get<uint32_t>(section.IndexOffset, section.Count);
+            if (!indices || !GetElements<Type>(reader, section))
+            {
+                spdlog::warn("Scene snapshot: {} section is out of range", entt::type_name<Type>::value());
+                return false;
+            }
+
+            std::vector<bool> bIsUsed(entityCount, false);
+            for (uint32_t i = 0; i < section.Count; ++i)
+            {
+                if (indices[i] >= entityCount || bIsUsed[indices[i]])
+                {
+                    spdlog::warn("Scene snapshot: {} section has an invalid entity index", entt::type_name<Type>::value());
+                    return false;
+                }
+                bIsUsed[indices[i]] = true;
+            }
+            return true;
+        }
+
+        double ToMilliseconds(std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    }
+
+
+    SceneSnapshot::Loader::~Loader()
+    {
+        EndSection();
+    }
+
+    bool SceneSnapshot::Loader::Open(const std::filesystem::path& filePath)
+    {
+        if (!m_File.Open(filePath))
+        {
+            spdlog::warn("Failed to open scene snapshot {}", filePath.string());
+            return false;
+        }
+
+        const SnapshotReader reader(m_File.GetData(), m_File.GetSize());
+        const auto* header = reader.Get<SnapshotHeader>(0, 1);
+        if (!header || header->Magic != SnapshotMagic || header->Version != SnapshotVersion)
+        {
+            spdlog::warn("{} is not a scene snapshot of version {}", filePath.string(), SnapshotVersion);
+            return false;
+        }
+
+        m_OriginalEntities = reader.Get<entt::entity>(header->EntityTableOffset, header->EntityCount);
+        const auto* sections = reader.Get<SnapshotSectionHeader>(header->SectionTableOffset, header->SectionCount);
+        if (!m_OriginalEntities || !sections)
+        {
+            spdlog::warn("Scene snapshot {} is corrupted", filePath.string());
+            return false;
+        }
+        m_EntityCount = header->EntityCount;
+
+        // Instantiate는 여기서 검증된 Section만 다룸. 하나라도 손상되었다면 Scene을 비우기 전에 실패해야 반쯤 불러온 Scene이 남지 않음.
+        for (uint32_t i = 0; i < header->SectionCount; ++i)
+        {
+            if (sections[i].Count == 0)
+            {
+                continue;
+            }
+
+            const SectionState state = ValidateSection(sections[i]);
+            if (state == SectionState::Corrupted)
+            {
+                spdlog::warn("Scene snapshot {} is corrupted", filePath.string());
+                m_Sections.clear();
+                return false;
+            }
+            if (state == SectionState::Valid)
+            {
+                m_Sections.push_back(&sections[i]);
+            }
+        }
+
+        // Instantiate하는 Thread에서 Page Fault로 멈추지 않도록 파일 전체를 미리 읽어 둠.
+        uint8_t pageSum = 0;
+        for (size_t offset = 0; offset < m_File.GetSize(); offset += PageSize)
+        {
+            pageSum += m_File.GetData()[offset];
+        }
+        [[maybe_unused]] volatile uint8_t touchedPages = pageSum;
+        return true;
+    }
+
+    uint32_t SceneSnapshot::Loader::Instantiate(Scene& scene, uint32_t elementBudget)
+    {
+        entt::registry& registry = scene.m_Registry;
+        uint32_t processedCount = 0;
+
+        if (m_Entities.size() < m_EntityCount)
+        {
+            const size_t first = m_Entities.size();
+            if (first == 0)
+            {
+                ReserveStorage<entt::entity>(registry, m_EntityCount);
+            }
+
+            const size_t count = std::min<size_t>(elementBudget, m_EntityCount - first);
+            m_Entities.resize(first + count);
+            registry.create(m_Entities.begin() + static_cast<ptrdiff_t>(first), m_Entities.end());
+            processedCount += static_cast<uint32_t>(count);
+            if (m_Entities.size() < m_EntityCount)
+            {
+                return processedCount;
+            }
+
+            uint32_t maxIndex = 0;
+            for (uint32_t i = 0; i < m_EntityCount; ++i)
+            {
+                maxIndex = std::max(maxIndex, static_cast<uint32_t>(entt::to_entity(m_OriginalEntities[i])));
+            }
+            m_RemapTable.assign(static_cast<size_t>(maxIndex) + 1, {entt::null, entt::null});
+            for (uint32_t i = 0; i < m_EntityCount; ++i)
+            {
+                m_RemapTable[entt::to_entity(m_OriginalEntities[i])] = {m_OriginalEntities[i], m_Entities[i]};
+            }
+        }
+
+        while (m_SectionIndex < m_Sections.size() && processedCount < elementBudget)
+        {
+            const SnapshotSectionHeader& section = *m_Sections[m_SectionIndex];
+            if (m_ElementIndex == 0)
+            {
+                BeginSection(section);
+            }
+
+            const uint32_t count = std::min(elementBudget - processedCount, section.Count - m_ElementIndex);
+            InstantiateSection(scene, section, m_ElementIndex, count);
+            processedCount += count;
+            m_ElementIndex += count;
+
+            if (m_ElementIndex == section.Count)
+            {
+                EndSection();
+                m_SectionIndex++;
+                m_ElementIndex = 0;
+            }
+        }
+        return processedCount;
+    }
+
+    bool SceneSnapshot::Loader::IsFinished() const
+    {
+        return m_Entities.size() == m_EntityCount && m_SectionIndex == m_Sections.size();
+    }
+
+    SceneSnapshot::Loader::SectionState SceneSnapshot::Loader::ValidateSection(const SnapshotSectionHeader& section) const
+    {
+        const SnapshotReader reader(m_File.GetData(), m_File.GetSize());
+        bool bIsCompatible = false;
+        bool bIsValid = false;
+        switch (section.TypeId)
+        {
+        case SnapshotTraits<TransformComponent>::TypeId:
+            bIsCompatible = IsCompatible<TransformComponent>(section);
+            bIsValid = bIsCompatible && ValidateElements<TransformComponent>(reader, section, m_EntityCount);
+            break;
+
+        case SnapshotTraits<RelationshipComponent>::TypeId:
+            bIsCompatible = IsCompatible<RelationshipComponent>(section);
+            bIsValid = bIsCompatible && ValidateElements<RelationshipComponent>(reader, section, m_EntityCount);
+            break;
+
+        case SnapshotTraits<LightComponent>::TypeId:
+            bIsCompatible = IsCompatible<LightComponent>(section);
+            bIsValid = bIsCompatible && ValidateElements<LightComponent>(reader, section, m_EntityCount);
+            break;
+
+        case SnapshotTraits<DisplayNameComponent>::TypeId:
+            bIsCompatible = IsCompatible<DisplayNameComponent>(section);
+            if (bIsCompatible && ValidateElements<DisplayNameComponent>(reader, section, m_EntityCount))
+            {
+                const char* blob = reader.Get<char>(section.ExtraOffset, section.ExtraSize);
+                const StringEntry* names = GetElements<DisplayNameComponent>(reader, section);
+                bIsValid = blob && std::all_of(names, names + section.Count, [&](const StringEntry& name) { return GetString(blob, section.ExtraSize, name).has_value(); });
+                if (!bIsValid)
+                {
+                    spdlog::warn("Scene snapshot: DisplayNameComponent section has an invalid string");
+                }
+            }
+            break;
+
+        case SnapshotTraits<MeshRenderComponent>::TypeId:
+            bIsCompatible = IsCompatible<MeshRenderComponent>(section);
+            if (bIsCompatible && ValidateElements<MeshRenderComponent>(reader, section, m_EntityCount))
+            {
+                const auto table = GetAssetTable(reader, section);
+                const uint32_t* meshIndices = GetElements<MeshRenderComponent>(reader, section);
+                bIsValid = table && std::all_of(meshIndices, meshIndices + section.Count, [&](uint32_t meshIndex) { return meshIndex < table->Header->AssetCount; });
+                if (!bIsValid)
+                {
+                    spdlog::warn("Scene snapshot: MeshRenderComponent section has an invalid asset table");
+                }
+            }
+            break;
+
+        default:
+            spdlog::warn("Scene snapshot: skipped unknown section {:#x}", section.TypeId);
+            break;
+        }
+
+        if (!bIsCompatible)
+        {
+            return SectionState::Skipped;
+        }
+        return bIsValid ? SectionState::Valid : SectionState::Corrupted;
+    }
+
+    void SceneSnapshot::Loader::BeginSection(const SnapshotSectionHeader& section)
+    {
+        if (section.TypeId != SnapshotTraits<MeshRenderComponent>::TypeId)
+        {
+            return;
+        }
+
+        // Asset마다 한 번만 불러오고 Component마다 참조 횟수를 올림. Section이 끝나면 여기서 얻은 참조는 놓음.
+        const SnapshotReader reader(m_File.GetData(), m_File.GetSize());
+        const AssetTable table = *GetAssetTable(reader, section);
+        m_Meshes.resize(table.Header->AssetCount);
+        for (uint32_t i = 0; i < table.Header->AssetCount; ++i)
+        {
+            const auto sourcePath = GetString(table.Strings, table.StringsSize, table.Entries[i].SourcePath);
+            if (sourcePath && !sourcePath->empty())
+            {
+                m_Meshes[i] = AssetManager::AcquireMesh(table.Entries[i].Id, *sourcePath);
+            }
+            if (!m_Meshes[i])
+            {
+                spdlog::warn("Scene snapshot: failed to load mesh {}", sourcePath.value_or("<invalid>"));
+            }
+        }
+    }
+
+    void SceneSnapshot::Loader::InstantiateSection(Scene& scene, const SnapshotSectionHeader& section, uint32_t first, uint32_t count)
+    {
+        entt::registry& registry = scene.m_Registry;
+        const SnapshotReader reader(m_File.GetData(), m_File.GetSize());
+
+        const uint32_t* indices = reader.Get<uint32_t>(section.IndexOffset, section.Count) + first;
+        m_SectionEntities.resize(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_SectionEntities[i] = m_Entities[indices[i]];
+        }
+
+        switch (section.TypeId)
+        {
+        case SnapshotTraits<TransformComponent>::TypeId:
+            {
+                if (first == 0)
+                {
+                    ReserveStorage<TransformComponent>(registry, section.Count);
+                    ReserveStorage<WorldTransformComponent>(registry, section.Count);
+                }
+
+                // WorldTransformComponent도 한 번에 들어가고 순서는 한 번만 다시 계산됨.
+                scene.AddComponents<TransformComponent>(m_SectionEntities, GetElements<TransformComponent>(reader, section) + first);
+                break;
+            }
+
+        case SnapshotTraits<RelationshipComponent>::TypeId:
+            {
+                if (first == 0)
+                {
+                    ReserveStorage<RelationshipComponent>(registry, section.Count);
+                }
+
+                const RelationshipComponent* relationships = GetElements<RelationshipComponent>(reader, section) + first;
+                std::vector<RelationshipComponent> remappedRelationships(relationships, relationships + count);
+                for (RelationshipComponent& relationship : remappedRelationships)
+                {
+                    relationship.Parent = Remap(relationship.Parent);
+                    relationship.FirstChild = Remap(relationship.FirstChild);
+                    relationship.PreviousSibling = Remap(relationship.PreviousSibling);
+                    relationship.NextSibling = Remap(relationship.NextSibling);
+                }
+                registry.insert<RelationshipComponent>(m_SectionEntities.begin(), m_SectionEntities.end(), remappedRelationships.begin());
+                scene.m_bIsTransformOrderDirty = true;
+                break;
+            }
+
+        case SnapshotTraits<LightComponent>::TypeId:
+            {
+                if (first == 0)
+                {
+                    ReserveStorage<LightComponent>(registry, section.Count);
+                }
+                registry.insert<LightComponent>(m_SectionEntities.begin(), m_SectionEntities.end(), GetElements<LightComponent>(reader, section) + first);
+                break;
+            }
+
+        case SnapshotTraits<DisplayNameComponent>::TypeId:
+            {
+                if (first == 0)
+                {
+                    ReserveStorage<DisplayNameComponent>(registry, section.Count);
+                }
+
+                const char* blob = reader.Get<char>(section.ExtraOffset, section.ExtraSize);
+                const StringEntry* names = GetElements<DisplayNameComponent>(reader, section) + first;
+                std::vector<DisplayNameComponent> displayNames(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    displayNames[i].Name = *GetString(blob, section.ExtraSize, names[i]);
+                }
+                registry.insert<DisplayNameComponent>(m_SectionEntities.begin(), m_SectionEntities.end(), std::make_move_iterator(displayNames.begin()));
+                break;
+            }
+
+        case SnapshotTraits<MeshRenderComponent>::TypeId:
+            {
+                if (first == 0)
+                {
+                    ReserveStorage<MeshRenderComponent>(registry, section.Count);
+                }
+
+                // Mesh를 불러오지 못한 Entity에는 Component를 넣지 않음.
+                const uint32_t* meshIndices = GetElements<MeshRenderComponent>(reader, section) + first;
+                std::vector<MeshRenderComponent> meshRenders;
+                meshRenders.reserve(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const AssetHandle<Mesh> mesh = m_Meshes[meshIndices[i]];
+                    if (mesh)
+                    {
+                        AssetManager::Retain(mesh);
+                        m_SectionEntities[meshRenders.size()] = m_SectionEntities[i];
+                        meshRenders.push_back({.Mesh = mesh});
+                    }
+                }
+                registry.insert<MeshRenderComponent>(m_SectionEntities.begin(), m_SectionEntities.begin() + static_cast<ptrdiff_t>(meshRenders.size()), meshRenders.begin());
+                break;
+            }
+
+        default:
+            break;
+        }
+    }
+
+    void SceneSnapshot::Loader::EndSection()
+    {
+        for (const AssetHandle<Mesh> mesh : m_Meshes)
+        {
+            if (mesh)
+            {
+                AssetManager::Release(mesh);
+            }
+        }
+        m_Meshes.clear();
+    }
+
+    entt::entity SceneSnapshot::Loader::Remap(entt::entity originalEntity) const
+    {
+        const auto index = static_cast<size_t>(entt::to_entity(originalEntity));
+        if (originalEntity == entt::null || index >= m_RemapTable.size() || m_RemapTable[index].first != originalEntity)
+        {
+            return entt::null;
+        }
+        return m_RemapTable[index].second;
+    }
+
+    bool SceneSnapshot::Save(const Scene& scene, const std::filesystem::path& filePath)
+    {
+        std::vector<entt::entity> entities;
+        for (const auto [entity] : scene.GetRegistry().storage<entt::entity>()->each())
+        {
+            entities.push_back(entity);
+        }
+        return Save(scene, filePath, entities);
+    }
+
+    bool SceneSnapshot::Save(const Scene& scene, const std::filesystem::path& filePath, const std::vector<entt::entity>& entities)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        SnapshotWriter writer(filePath);
+        if (!writer.IsOpen())
+        {
+            spdlog::warn("Failed to open {} for writing", filePath.string());
+            return false;
+        }
+
+        const entt::registry& registry = scene.GetRegistry();
+        SnapshotHeader header;
+        writer.Write(&header, sizeof(header));
+
+        // Entity Table. Component는 Entity 값 대신 이 Table의 위치로 Entity를 가리킴.
+        std::vector<uint32_t> entityIndices;
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            const auto index = static_cast<size_t>(entt::to_entity(entities[i]));
+            if (index >= entityIndices.size())
+            {
+                entityIndices.resize(index + 1, InvalidIndex);
+            }
+            entityIndices[index] = static_cast<uint32_t>(i);
+        }
+        header.EntityCount = static_cast<uint32_t>(entities.size());
+        header.EntityTableOffset = writer.WriteArray(entities);
+
+        std::vector<SnapshotSectionHeader> sections;
+        WriteTrivialSection<TransformComponent>(writer, registry, entityIndices, sections);
+        // 다른 Entity를 가리키는 값은 불러올 때 Entity Table로 다시 연결함.
+        WriteTrivialSection<RelationshipComponent>(writer, registry, entityIndices, sections);
+        WriteTrivialSection<LightComponent>(writer, registry, entityIndices, sections);
+
+        std::vector<char> names;
+        std::vector<uint32_t> nameIndices;
+        std::vector<StringEntry> nameEntries;
+        CollectElements<DisplayNameComponent>(registry, entityIndices, nameIndices, nameEntries, [&](const DisplayNameComponent& displayName)
+        {
+            return AppendString(names, displayName.Name);
+        });
+        // Prefab은 저장하지 않으므로, 자신의 이름이 없는 Prefab Instance는 Prefab Node의 이름을 구워 넣음.
+        // 불러온 Entity는 보통 Entity처럼 자신의 DisplayNameComponent를 가짐.
+        for (const auto entity : registry.view<PrefabInstanceComponent>(entt::exclude<DisplayNameComponent>))
+        {
+            if (const uint32_t index = GetEntityIndex(entityIndices, entity); index != InvalidIndex)
+            {
+                nameIndices.push_back(index);
+                nameEntries.push_back(AppendString(names, scene.GetDisplayName(entity)));
+            }
+        }
+        if (auto* section = WriteElements<DisplayNameComponent>(writer, sections, nameIndices, nameEntries))
+        {
+            section->ExtraSize = names.size();
+            section->ExtraOffset = writer.WriteArray(names);
+        }
+
+        // Mesh는 Asset Id와 경로를 한 번씩만 기록하고 Component는 그 Index를 가짐.
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        std::vector<AssetEntry> meshEntries;
+        std::vector<char> meshPaths;
+        std::unordered_map<uint32_t, uint32_t> meshIndices;
+        if (auto* section = WriteSection<MeshRenderComponent>(writer, registry, entityIndices, sections, [&](const MeshRenderComponent& meshRender)
+        {
+            const auto [it, bInserted] = meshIndices.try_emplace(meshRender.Mesh.Value, static_cast<uint32_t>(meshEntries.size()));
+            if (bInserted)
+            {
+                const bool bIsValid = meshPool.IsValid(meshRender.Mesh);
+                meshEntries.push_back({
+                    .Id = bIsValid ? meshPool.GetId(meshRender.Mesh) : 0,
+                    .SourcePath = AppendString(meshPaths, bIsValid ? std::string_view(meshPool.GetSourcePath(meshRender.Mesh)) : std::string_view()),
+                });
+            }
+            return it->second;
+        }))
+        {
+            const AssetTableHeader tableHeader{.AssetCount = static_cast<uint32_t>(meshEntries.size())};
+            std::vector<uint8_t> assetTable;
+            AppendBytes(assetTable, &tableHeader, 1);
+            AppendBytes(assetTable, meshEntries.data(), meshEntries.size());
+            AppendBytes(assetTable, meshPaths.data(), meshPaths.size());
+            section->ExtraSize = assetTable.size();
+            section->ExtraOffset = writer.WriteArray(assetTable);
+        }
+
+        header.SectionCount = static_cast<uint32_t>(sections.size());
+        header.SectionTableOffset = writer.WriteArray(sections);
+        if (!writer.Finish(header))
+        {
+            spdlog::warn("Failed to write scene snapshot {}", filePath.string());
+            return false;
+        }
+
+        spdlog::info("Scene snapshot saved: {} ({} entities, {:.2f} ms)", filePath.string(), entities.size(), ToMilliseconds(std::chrono::steady_clock::now() - startTime));
+        return true;
+    }
+
+    bool SceneSnapshot::Load(Scene& scene, const std::filesystem::path& filePath)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // Open이 모든 Section을 검증하므로, 여기서부터는 파일 때문에 실패하지 않음.
+        Loader loader;
+        if (!loader.Open(filePath))
+        {
+            return false;
+        }
+
+        scene.m_Registry.clear();
+        scene.m_TransformOrder.clear();
+        scene.m_DirtyTransforms.clear();
+        loader.Instantiate(scene);
+
+        spdlog::info("Scene snapshot loaded: {} ({} entities, {:.2f} ms)", filePath.string(), loader.GetEntityCount(), ToMilliseconds(std::chrono::steady_clock::now() - startTime));
+        return true;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <filesystem>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "AssetHandle.h"
+#include "Core/MappedFile.h"
+
+namespace Engine
+{
+    class Scene;
+    struct Mesh;
+    struct SnapshotSectionHeader;
+
+    // Scene을 Binary 파일로 저장하고 불러옴.
+    // 파일은 Entity Table과 Component Storage별 Section으로 이루어지며, 각 Section은 Component 배열을 연속으로 가지고 있음.
+    // 불러올 때는 파일을 Mapping한 뒤 Section마다 Storage에 한 번에 넣음.
+    // WorldTransformComponent는 저장하지 않고 불러온 뒤 다시 계산함.
+    // Prefab도 저장하지 않으므로 Prefab Instance는 Prefab의 이름을 DisplayNameComponent로 구워 저장함.
+    class SceneSnapshot final
+    {
+    public:
+        // Snapshot 파일 하나를 Scene에 나누어 넣음.
+        // Open은 Scene에 접근하지 않으므로 어느 Thread에서나 호출할 수 있으며, 파일 전체를 검증하고 Page를 미리 읽어 둠.
+        // Instantiate는 Scene을 수정하므로 Main Thread에서 호출해야 함.
+        class Loader
+        {
+        public:
+            Loader() = default;
+            ~Loader();
+
+            Loader(const Loader&) = delete;
+            Loader& operator=(const Loader&) = delete;
+
+            // Section 하나라도 손상되었다면 실패함. Version이 다르거나 모르는 Section만 건너뜀.
+            bool Open(const std::filesystem::path& filePath);
+
+            // Entity 생성과 Component 추가를 합쳐 최대 elementBudget개만 처리하고, 처리한 개수를 반환함.
+            // Entity를 모두 만든 뒤에 Component를 넣으므로 Component가 다른 Entity를 가리켜도 됨.
+            uint32_t Instantiate(Scene& scene, uint32_t elementBudget = UINT32_MAX);
+            bool IsFinished() const;
+
+            // 지금까지 만든 Entity. Scene에서 다시 내릴 때 사용함.
+            const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+            uint32_t GetEntityCount() const { return m_EntityCount; }
+            size_t GetSizeInBytes() const { return m_File.GetSize(); }
+
+        private:
+            enum class SectionState
+            {
+                Valid,
+                // Version이나 Type이 달라 불러오지 않는 Section.
+                Skipped,
+                Corrupted
+            };
+
+            SectionState ValidateSection(const SnapshotSectionHeader& section) const;
+            void BeginSection(const SnapshotSectionHeader& section);
+            void InstantiateSection(Scene& scene, const SnapshotSectionHeader& section, uint32_t first, uint32_t count);
+            void EndSection();
+            entt::entity Remap(entt::entity originalEntity) const;
+
+        private:
+            MappedFile m_File;
+            const entt::entity* m_OriginalEntities = nullptr;
+            uint32_t m_EntityCount = 0;
+            std::vector<const SnapshotSectionHeader*> m_Sections;
+
+            std::vector<entt::entity> m_Entities;
+            // 저장할 때의 Entity Index로 찾는 저장할 때의 Entity와 새 Entity.
+            std::vector<std::pair<entt::entity, entt::entity>> m_RemapTable;
+            size_t m_SectionIndex = 0;
+            uint32_t m_ElementIndex = 0;
+
+            std::vector<entt::entity> m_SectionEntities;
+            // 진행 중인 MeshRenderComponent Section이 가진 Mesh 참조.
+            std::vector<AssetHandle<Mesh>> m_Meshes;
+        };
+
+    public:
+        SceneSnapshot() = delete;
+
+        static bool Save(const Scene& scene, const std::filesystem::path& filePath);
+        // entities와 그 Component만 저장함. entities 밖의 Entity를 가리키는 값은 불러올 때 entt::null이 됨.
+        static bool Save(const Scene& scene, const std::filesystem::path& filePath, const std::vector<entt::entity>& entities);
+        // Scene의 기존 Entity는 모두 삭제됨. Entity 값은 새로 발급되며, Component가 참조하는 Entity도 새 값으로 바뀜.
+        // 파일이 손상되었다면 Scene을 건드리지 않고 실패함.
+        static bool Load(Scene& scene, const std::filesystem::path& filePath);
+    };
+}
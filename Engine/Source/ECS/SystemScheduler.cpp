@@ -0,0 +1,82 @@
+#include "EnginePCH.h"
+#include "SystemScheduler.h"
+
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+    {
+        const auto overlaps = [](const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs)
+        {
+            return std::any_of(lhs.begin(), lhs.end(), [&](entt::id_type type) { return std::find(rhs.begin(), rhs.end(), type) != rhs.end(); });
+        };
+
+        return overlaps(m_Writes, other.m_Writes) || overlaps(m_Writes, other.m_Reads) || overlaps(m_Reads, other.m_Writes);
+    }
+
+    void SystemScheduler::Register(entt::registry& registry, std::string name, SystemAccess access, SystemFunction function)
+    {
+        // Storage는 처음 접근할 때 생성되므로, 여러 Thread가 동시에 생성하지 않도록 미리 만들어 둠.
+        for (const auto createStorage : access.m_StorageCreators)
+        {
+            createStorage(registry);
+        }
+
+        m_Systems.push_back({.Access = std::move(access), .Function = std::move(function)});
+        m_Stats.push_back({.Name = std::move(name)});
+    }
+
+    void SystemScheduler::Run(entt::registry& registry, JobSystem& jobSystem, float deltaSeconds)
+    {
+        const size_t systemCount = m_Systems.size();
+        if (systemCount == 0)
+        {
+            return;
+        }
+
+        // 먼저 등록된 System과 충돌한다면 그 System이 끝난 뒤에 실행함.
+        std::vector<std::vector<uint32_t>> dependents(systemCount);
+        const auto remainingDependencies = std::make_unique<std::atomic<uint32_t>[]>(systemCount);
+        for (uint32_t i = 0; i < systemCount; ++i)
+        {
+            uint32_t dependencyCount = 0;
+            for (uint32_t j = 0; j < i; ++j)
+            {
+                if (m_Systems[i].Access.ConflictsWith(m_Systems[j].Access))
+                {
+                    dependents[j].push_back(i);
+                    dependencyCount++;
+                }
+            }
+            remainingDependencies[i].store(dependencyCount, std::memory_order_relaxed);
+        }
+
+        JobSystem::Counter counter;
+        std::function<void(uint32_t)> runSystem = [&](uint32_t systemIndex)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            m_Systems[systemIndex].Function(registry, deltaSeconds);
+            m_Stats[systemIndex].Duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+            m_Stats[systemIndex].ThreadIndex = JobSystem::GetCurrentThreadIndex();
+
+            // 이 Job이 끝나기 전에 Submit하므로 Counter가 먼저 0이 되는 일은 없음.
+            for (const uint32_t dependent : dependents[systemIndex])
+            {
+                if (remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    jobSystem.Submit([&runSystem, dependent] { runSystem(dependent); }, &counter);
+                }
+            }
+        };
+
+        for (uint32_t i = 0; i < systemCount; ++i)
+        {
+            if (remainingDependencies[i].load(std::memory_order_relaxed) == 0)
+            {
+                jobSystem.Submit([&runSystem, i] { runSystem(i); }, &counter);
+            }
+        }
+        jobSystem.Wait(counter);
+    }
+}
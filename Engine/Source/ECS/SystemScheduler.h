@@ -0,0 +1,81 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <entt/entt.hpp>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // System이 읽고 쓰는 Component 목록.
+    // 한 쪽이 쓰는 Component를 다른 쪽이 읽거나 쓰지 않는다면 두 System은 동시에 실행될 수 있음.
+    class SystemAccess
+    {
+        friend class SystemScheduler;
+
+    public:
+        template <typename... Types>
+        SystemAccess& Read()
+        {
+            (Add<Types>(m_Reads), ...);
+            return *this;
+        }
+
+        template <typename... Types>
+        SystemAccess& Write()
+        {
+            (Add<Types>(m_Writes), ...);
+            return *this;
+        }
+
+        bool ConflictsWith(const SystemAccess& other) const;
+
+    private:
+        template <typename Type>
+        void Add(std::vector<entt::id_type>& componentTypes)
+        {
+            componentTypes.push_back(entt::type_hash<Type>::value());
+            m_StorageCreators.push_back(+[](entt::registry& registry) { registry.storage<Type>(); });
+        }
+
+    private:
+        std::vector<entt::id_type> m_Reads;
+        std::vector<entt::id_type> m_Writes;
+        std::vector<void(*)(entt::registry&)> m_StorageCreators;
+    };
+
+    // 등록된 System을 매 Frame 의존성 Graph로 정리하여 JobSystem에서 실행함.
+    // 충돌하는 System은 등록된 순서대로 실행되고, 나머지는 병렬로 실행됨.
+    // System 안에서는 Component 값만 수정해야 하며, Entity 생성/삭제나 Component 추가/제거,
+    // Signal이 발생하는 patch/replace는 허용되지 않음.
+    class SystemScheduler
+    {
+    public:
+        using SystemFunction = std::function<void(entt::registry&, float)>;
+
+        struct SystemStats
+        {
+            std::string Name;
+            std::chrono::nanoseconds Duration{};
+            uint32_t ThreadIndex = 0;
+        };
+
+    public:
+        void Register(entt::registry& registry, std::string name, SystemAccess access, SystemFunction function);
+        void Run(entt::registry& registry, JobSystem& jobSystem, float deltaSeconds);
+
+        const std::vector<SystemStats>& GetStats() const { return m_Stats; }
+
+    private:
+        struct System
+        {
+            SystemAccess Access;
+            SystemFunction Function;
+        };
+
+        std::vector<System> m_Systems;
+        std::vector<SystemStats> m_Stats;
+    };
+}
@@ -0,0 +1,286 @@
+#include "EnginePCH.h"
+#include "TransformBatch.h"
+
+#include <cmath>
+#include <intrin.h>
+
+#include "Components.h"
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr float DegreeToRadian = DirectX::XM_PI / 180.0f;
+
+        // XMMatrixRotationRollPitchYaw와 같은 Roll(Z) -> Pitch(X) -> Yaw(Y) 순서의 회전 행렬에 Scale과 Translation을 합친 것.
+        // 각 Path는 이 식을 Lane 수만큼 동시에 계산함.
+        void ComposeScalar(const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices)
+        {
+            for (size_t i = first; i < first + count; ++i)
+            {
+                const float pitch = transforms.RotationX[i] * DegreeToRadian;
+                const float yaw = transforms.RotationY[i] * DegreeToRadian;
+                const float roll = transforms.RotationZ[i] * DegreeToRadian;
+                const float sp = std::sin(pitch), cp = std::cos(pitch);
+                const float sy = std::sin(yaw), cy = std::cos(yaw);
+                const float sr = std::sin(roll), cr = std::cos(roll);
+                const float sx = transforms.ScaleX[i], syScale = transforms.ScaleY[i], sz = transforms.ScaleZ[i];
+
+                DirectX::XMFLOAT4X4& matrix = outMatrices[i - first];
+                matrix._11 = (cr * cy + sr * sp * sy) * sx;
+                matrix._12 = (sr * cp) * sx;
+                matrix._13 = (sr * sp * cy - cr * sy) * sx;
+                matrix._14 = 0.0f;
+                matrix._21 = (cr * sp * sy - sr * cy) * syScale;
+                matrix._22 = (cr * cp) * syScale;
+                matrix._23 = (sr * sy + cr * sp * cy) * syScale;
+                matrix._24 = 0.0f;
+                matrix._31 = (cp * sy) * sz;
+                matrix._32 = -sp * sz;
+                matrix._33 = (cp * cy) * sz;
+                matrix._34 = 0.0f;
+                matrix._41 = transforms.PositionX[i];
+                matrix._42 = transforms.PositionY[i];
+                matrix._43 = transforms.PositionZ[i];
+                matrix._44 = 1.0f;
+            }
+        }
+
+        // 4개씩 XMVECTOR의 각 Lane에 한 Entity를 담아 계산한 뒤, 전치하여 행렬로 저장함.
+        void ComposeSSE(const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices)
+        {
+            using namespace DirectX;
+
+            const size_t vectorCount = count / 4 * 4;
+            const XMVECTOR degreeToRadian = XMVectorReplicate(DegreeToRadian);
+            const XMVECTOR zero = XMVectorZero();
+            const XMVECTOR one = XMVectorSplatOne();
+            for (size_t i = 0; i < vectorCount; i += 4)
+            {
+                const size_t index = first + i;
+                const auto load = [index](const std::vector<float>& values) { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(values.data() + index)); };
+
+                XMVECTOR sp, cp, sy, cy, sr, cr;
+                XMVectorSinCos(&sp, &cp, XMVectorMultiply(load(transforms.RotationX), degreeToRadian));
+                XMVectorSinCos(&sy, &cy, XMVectorMultiply(load(transforms.RotationY), degreeToRadian));
+                XMVectorSinCos(&sr, &cr, XMVectorMultiply(load(transforms.RotationZ), degreeToRadian));
+                const XMVECTOR sx = load(transforms.ScaleX);
+                const XMVECTOR syScale = load(transforms.ScaleY);
+                const XMVECTOR sz = load(transforms.ScaleZ);
+
+                const XMVECTOR srsp = XMVectorMultiply(sr, sp);
+                const XMVECTOR crsp = XMVectorMultiply(cr, sp);
+
+                // rows[r]의 각 성분은 4개 Entity의 r번째 행 값임.
+                XMMATRIX rows[4];
+                rows[0] = XMMATRIX(
+                    XMVectorMultiply(XMVectorMultiplyAdd(srsp, sy, XMVectorMultiply(cr, cy)), sx),
+                    XMVectorMultiply(XMVectorMultiply(sr, cp), sx),
+                    XMVectorMultiply(XMVectorNegativeMultiplySubtract(cr, sy, XMVectorMultiply(srsp, cy)), sx),
+                    zero);
+                rows[1] = XMMATRIX(
+                    XMVectorMultiply(XMVectorNegativeMultiplySubtract(sr, cy, XMVectorMultiply(crsp, sy)), syScale),
+                    XMVectorMultiply(XMVectorMultiply(cr, cp), syScale),
+                    XMVectorMultiply(XMVectorMultiplyAdd(crsp, cy, XMVectorMultiply(sr, sy)), syScale),
+                    zero);
+                rows[2] = XMMATRIX(
+                    XMVectorMultiply(XMVectorMultiply(cp, sy), sz),
+                    XMVectorNegate(XMVectorMultiply(sp, sz)),
+                    XMVectorMultiply(XMVectorMultiply(cp, cy), sz),
+                    zero);
+                rows[3] = XMMATRIX(load(transforms.PositionX), load(transforms.PositionY), load(transforms.PositionZ), one);
+
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    const XMMATRIX transposed = XMMatrixTranspose(rows[row]);
+                    for (size_t lane = 0; lane < 4; ++lane)
+                    {
+                        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(outMatrices[i + lane].m[row]), transposed.r[lane]);
+                    }
+                }
+            }
+
+            ComposeScalar(transforms, first + vectorCount, count - vectorCount, outMatrices + vectorCount);
+        }
+
+        // XMVectorSinCos와 같은 다항식을 8 Lane으로 계산함.
+        void SinCosAVX2(__m256 angle, __m256& outSin, __m256& outCos)
+        {
+            // [-Pi, Pi]로 옮김.
+            const __m256 quotient = _mm256_round_ps(_mm256_mul_ps(angle, _mm256_set1_ps(DirectX::XM_1DIV2PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256 x = _mm256_fnmadd_ps(quotient, _mm256_set1_ps(DirectX::XM_2PI), angle);
+
+            // [-Pi/2, Pi/2]로 반사하고, 반사한 Lane은 Cos의 부호를 바꿈.
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            const __m256 sign = _mm256_and_ps(x, signMask);
+            const __m256 reflected = _mm256_sub_ps(_mm256_or_ps(_mm256_set1_ps(DirectX::XM_PI), sign), x);
+            const __m256 bIsInRange = _mm256_cmp_ps(_mm256_andnot_ps(signMask, x), _mm256_set1_ps(DirectX::XM_PIDIV2), _CMP_LE_OQ);
+            x = _mm256_blendv_ps(reflected, x, bIsInRange);
+            const __m256 cosSign = _mm256_blendv_ps(_mm256_set1_ps(-1.0f), _mm256_set1_ps(1.0f), bIsInRange);
+            const __m256 x2 = _mm256_mul_ps(x, x);
+
+            __m256 sinResult = _mm256_set1_ps(-2.3889859e-08f);
+            sinResult = _mm256_fmadd_ps(sinResult, x2, _mm256_set1_ps(2.7525562e-06f));
+            sinResult = _mm256_fmadd_ps(sinResult, x2, _mm256_set1_ps(-0.00019840874f));
+            sinResult = _mm256_fmadd_ps(sinResult, x2, _mm256_set1_ps(0.0083333310f));
+            sinResult = _mm256_fmadd_ps(sinResult, x2, _mm256_set1_ps(-0.16666667f));
+            sinResult = _mm256_fmadd_ps(sinResult, x2, _mm256_set1_ps(1.0f));
+            outSin = _mm256_mul_ps(sinResult, x);
+
+            __m256 cosResult = _mm256_set1_ps(-2.6051615e-07f);
+            cosResult = _mm256_fmadd_ps(cosResult, x2, _mm256_set1_ps(2.4760495e-05f));
+            cosResult = _mm256_fmadd_ps(cosResult, x2, _mm256_set1_ps(-0.0013888378f));
+            cosResult = _mm256_fmadd_ps(cosResult, x2, _mm256_set1_ps(0.041666638f));
+            cosResult = _mm256_fmadd_ps(cosResult, x2, _mm256_set1_ps(-0.5f));
+            cosResult = _mm256_fmadd_ps(cosResult, x2, _mm256_set1_ps(1.0f));
+            outCos = _mm256_mul_ps(cosResult, cosSign);
+        }
+
+        // 8개씩 계산하고, 128bit 절반마다 4x4 전치하여 저장함.
+        void ComposeAVX2(const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices)
+        {
+            const size_t vectorCount = count / 8 * 8;
+            const __m256 degreeToRadian = _mm256_set1_ps(DegreeToRadian);
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            for (size_t i = 0; i < vectorCount; i += 8)
+            {
+                const size_t index = first + i;
+                const auto load = [index](const std::vector<float>& values) { return _mm256_loadu_ps(values.data() + index); };
+
+                __m256 sp, cp, sy, cy, sr, cr;
+                SinCosAVX2(_mm256_mul_ps(load(transforms.RotationX), degreeToRadian), sp, cp);
+                SinCosAVX2(_mm256_mul_ps(load(transforms.RotationY), degreeToRadian), sy, cy);
+                SinCosAVX2(_mm256_mul_ps(load(transforms.RotationZ), degreeToRadian), sr, cr);
+                const __m256 sx = load(transforms.ScaleX);
+                const __m256 syScale = load(transforms.ScaleY);
+                const __m256 sz = load(transforms.ScaleZ);
+
+                const __m256 srsp = _mm256_mul_ps(sr, sp);
+                const __m256 crsp = _mm256_mul_ps(cr, sp);
+
+                const __m256 rows[4][4] = {
+                    {
+                        _mm256_mul_ps(_mm256_fmadd_ps(srsp, sy, _mm256_mul_ps(cr, cy)), sx),
+                        _mm256_mul_ps(_mm256_mul_ps(sr, cp), sx),
+                        _mm256_mul_ps(_mm256_fnmadd_ps(cr, sy, _mm256_mul_ps(srsp, cy)), sx),
+                        zero
+                    },
+                    {
+                        _mm256_mul_ps(_mm256_fnmadd_ps(sr, cy, _mm256_mul_ps(crsp, sy)), syScale),
+                        _mm256_mul_ps(_mm256_mul_ps(cr, cp), syScale),
+                        _mm256_mul_ps(_mm256_fmadd_ps(crsp, cy, _mm256_mul_ps(sr, sy)), syScale),
+                        zero
+                    },
+                    {
+                        _mm256_mul_ps(_mm256_mul_ps(cp, sy), sz),
+                        _mm256_sub_ps(zero, _mm256_mul_ps(sp, sz)),
+                        _mm256_mul_ps(_mm256_mul_ps(cp, cy), sz),
+                        zero
+                    },
+                    {load(transforms.PositionX), load(transforms.PositionY), load(transforms.PositionZ), one}
+                };
+
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    for (size_t half = 0; half < 2; ++half)
+                    {
+                        __m128 column0 = half == 0 ? _mm256_castps256_ps128(rows[row][0]) : _mm256_extractf128_ps(rows[row][0], 1);
+                        __m128 column1 = half == 0 ? _mm256_castps256_ps128(rows[row][1]) : _mm256_extractf128_ps(rows[row][1], 1);
+                        __m128 column2 = half == 0 ? _mm256_castps256_ps128(rows[row][2]) : _mm256_extractf128_ps(rows[row][2], 1);
+                        __m128 column3 = half == 0 ? _mm256_castps256_ps128(rows[row][3]) : _mm256_extractf128_ps(rows[row][3], 1);
+                        _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+                        DirectX::XMFLOAT4X4* matrices = outMatrices + i + half * 4;
+                        _mm_storeu_ps(matrices[0].m[row], column0);
+                        _mm_storeu_ps(matrices[1].m[row], column1);
+                        _mm_storeu_ps(matrices[2].m[row], column2);
+                        _mm_storeu_ps(matrices[3].m[row], column3);
+                    }
+                }
+            }
+
+            ComposeSSE(transforms, first + vectorCount, count - vectorCount, outMatrices + vectorCount);
+        }
+
+        bool IsAVX2Supported()
+        {
+            // AVX2와 FMA 명령어를 지원하고, OS가 YMM Register를 저장해 주는지 확인함.
+            int registers[4] = {};
+            __cpuid(registers, 0);
+            if (registers[0] < 7)
+            {
+                return false;
+            }
+
+            __cpuid(registers, 1);
+            const bool bHasFMA = (registers[2] & (1 << 12)) != 0;
+            const bool bHasOSXSAVE = (registers[2] & (1 << 27)) != 0;
+            const bool bHasAVX = (registers[2] & (1 << 28)) != 0;
+            if (!bHasFMA || !bHasOSXSAVE || !bHasAVX || (_xgetbv(0) & 0x6) != 0x6)
+            {
+                return false;
+            }
+
+            __cpuidex(registers, 7, 0);
+            return (registers[1] & (1 << 5)) != 0;
+        }
+    }
+
+    void TransformSoA::Resize(size_t count)
+    {
+        for (std::vector<float>* values : {&PositionX, &PositionY, &PositionZ, &RotationX, &RotationY, &RotationZ, &ScaleX, &ScaleY, &ScaleZ})
+        {
+            values->resize(count);
+        }
+    }
+
+    void TransformSoA::Set(size_t index, const TransformComponent& transform)
+    {
+        PositionX[index] = transform.Position.x;
+        PositionY[index] = transform.Position.y;
+        PositionZ[index] = transform.Position.z;
+        RotationX[index] = transform.Rotation.x;
+        RotationY[index] = transform.Rotation.y;
+        RotationZ[index] = transform.Rotation.z;
+        ScaleX[index] = transform.Scale.x;
+        ScaleY[index] = transform.Scale.y;
+        ScaleZ[index] = transform.Scale.z;
+    }
+
+    namespace TransformBatch
+    {
+        void Compose(const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices)
+        {
+            static const Path bestPath = GetBestPath();
+            Compose(bestPath, transforms, first, count, outMatrices);
+        }
+
+        void Compose(Path path, const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices)
+        {
+            switch (path)
+            {
+            case Path::AVX2: ComposeAVX2(transforms, first, count, outMatrices);
+                break;
+            case Path::SSE: ComposeSSE(transforms, first, count, outMatrices);
+                break;
+            default: ComposeScalar(transforms, first, count, outMatrices);
+            }
+        }
+
+        Path GetBestPath()
+        {
+            return IsAVX2Supported() ? Path::AVX2 : Path::SSE;
+        }
+
+        const char* GetPathName(Path path)
+        {
+            switch (path)
+            {
+            case Path::AVX2: return "AVX2";
+            case Path::SSE: return "SSE";
+            default: return "Scalar";
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <DirectXMath.h>
+
+namespace Engine
+{
+    struct TransformComponent;
+
+    // TransformComponent를 성분별 배열로 펼친 것. Rotation은 TransformComponent와 같이 Degree 단위임.
+    struct TransformSoA
+    {
+        std::vector<float> PositionX;
+        std::vector<float> PositionY;
+        std::vector<float> PositionZ;
+        std::vector<float> RotationX;
+        std::vector<float> RotationY;
+        std::vector<float> RotationZ;
+        std::vector<float> ScaleX;
+        std::vector<float> ScaleY;
+        std::vector<float> ScaleZ;
+
+        void Resize(size_t count);
+        void Set(size_t index, const TransformComponent& transform);
+        size_t GetSize() const { return PositionX.size(); }
+    };
+
+    // TransformComponent::GetLocalMatrix와 같은 Scale * Rotation(Yaw, Pitch, Roll) * Translation 행렬을 여러 개 한 번에 계산함.
+    namespace TransformBatch
+    {
+        enum class Path
+        {
+            Scalar,
+            SSE,
+            AVX2
+        };
+
+        // CPU가 지원하는 가장 넓은 Path를 사용함.
+        void Compose(const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices);
+        void Compose(Path path, const TransformSoA& transforms, size_t first, size_t count, DirectX::XMFLOAT4X4* outMatrices);
+
+        Path GetBestPath();
+        const char* GetPathName(Path path);
+    }
+}
@@ -0,0 +1,374 @@
+#include "EnginePCH.h"
+#include "WorldPartition.h"
+
+#include <charconv>
+#include <format>
+#include <map>
+
+#include "Components.h"
+#include "Scene.h"
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr std::string_view CellFilePrefix = "Cell_";
+        constexpr std::string_view CellFileExtension = ".scene";
+
+        std::filesystem::path MakeCellFileName(int32_t cellX, int32_t cellZ)
+        {
+            return std::format("{}{}_{}{}", CellFilePrefix, cellX, cellZ, CellFileExtension);
+        }
+
+        // "Cell_X_Z.scene" 형식이 아니라면 false를 반환함.
+        bool ParseCellFileName(const std::filesystem::path& filePath, int32_t& outCellX, int32_t& outCellZ)
+        {
+            if (filePath.extension() != CellFileExtension)
+            {
+                return false;
+            }
+
+            const std::string stem = filePath.stem().string();
+            if (!stem.starts_with(CellFilePrefix))
+            {
+                return false;
+            }
+
+            const char* first = stem.data() + CellFilePrefix.size();
+            const char* last = stem.data() + stem.size();
+            const auto [xEnd, xError] = std::from_chars(first, last, outCellX);
+            if (xError != std::errc() || xEnd == last || *xEnd != '_')
+            {
+                return false;
+            }
+            const auto [zEnd, zError] = std::from_chars(xEnd + 1, last, outCellZ);
+            return zError == std::errc() && zEnd == last;
+        }
+    }
+
+    WorldPartition::WorldPartition(Scene& scene, JobSystem& jobSystem, std::filesystem::path directory, Settings settings)
+        : m_Scene(scene), m_JobSystem(jobSystem), m_Settings(settings)
+    {
+        EG_CONFIRM(m_Settings.UnloadRadius >= m_Settings.LoadRadius);
+
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            int32_t cellX = 0;
+            int32_t cellZ = 0;
+            if (!entry.is_regular_file() || !ParseCellFileName(entry.path(), cellX, cellZ))
+            {
+                continue;
+            }
+
+            Cell& cell = m_Cells[MakeCellKey(cellX, cellZ)];
+            cell.X = cellX;
+            cell.Z = cellZ;
+            cell.FilePath = entry.path();
+            cell.SizeInBytes = entry.file_size(error);
+        }
+
+        m_SortedCells.reserve(m_Cells.size());
+        for (auto& [key, cell] : m_Cells)
+        {
+            m_SortedCells.push_back(&cell);
+        }
+        m_Stats.CellCount = static_cast<uint32_t>(m_Cells.size());
+    }
+
+    WorldPartition::~WorldPartition()
+    {
+        m_JobSystem.Wait(m_PendingLoads);
+    }
+
+    bool WorldPartition::Build(Scene& scene, const std::filesystem::path& directory, float cellSize,
+                               const std::vector<entt::entity>& excludedRoots, std::vector<entt::entity>& outPartitionedEntities)
+    {
+        scene.UpdateWorldTransforms();
+        const entt::registry& registry = scene.GetRegistry();
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        // 이전에 만든 Cell이 남아 있으면 Streaming할 때 같이 올라오므로 지움.
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            int32_t cellX = 0;
+            int32_t cellZ = 0;
+            if (entry.is_regular_file() && ParseCellFileName(entry.path(), cellX, cellZ))
+            {
+                std::filesystem::remove(entry.path(), error);
+            }
+        }
+
+        // 자식은 부모와 같은 Cell에 들어가므로 부모가 Cell 경계를 넘어도 관계가 끊어지지 않음.
+        std::map<std::pair<int32_t, int32_t>, std::vector<entt::entity>> cellEntities;
+        std::vector<entt::entity> stack;
+        for (const auto [root, worldTransform] : registry.view<const WorldTransformComponent>().each())
+        {
+            const auto* relationship = registry.try_get<RelationshipComponent>(root);
+            if ((relationship && relationship->Parent != entt::null) || std::find(excludedRoots.begin(), excludedRoots.end(), root) != excludedRoots.end())
+            {
+                continue;
+            }
+
+            const DirectX::SimpleMath::Vector3 position = worldTransform.World.Translation();
+            const auto cellX = static_cast<int32_t>(std::floor(position.x / cellSize));
+            const auto cellZ = static_cast<int32_t>(std::floor(position.z / cellSize));
+            std::vector<entt::entity>& entities = cellEntities[{cellX, cellZ}];
+
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                const entt::entity entity = stack.back();
+                stack.pop_back();
+                entities.push_back(entity);
+
+                if (const auto* entityRelationship = registry.try_get<RelationshipComponent>(entity))
+                {
+                    for (entt::entity child = entityRelationship->FirstChild; child != entt::null; child = registry.get<RelationshipComponent>(child).NextSibling)
+                    {
+                        stack.push_back(child);
+                    }
+                }
+            }
+        }
+
+        for (const auto& [cell, entities] : cellEntities)
+        {
+            if (!SceneSnapshot::Save(scene, directory / MakeCellFileName(cell.first, cell.second), entities))
+            {
+                return false;
+            }
+            outPartitionedEntities.insert(outPartitionedEntities.end(), entities.begin(), entities.end());
+        }
+
+        spdlog::info("World partition built: {} ({} cells, {} entities)", directory.string(), cellEntities.size(), outPartitionedEntities.size());
+        return true;
+    }
+
+    void WorldPartition::Update(const DirectX::SimpleMath::Vector3& cameraPosition)
+    {
+        for (Cell* cell : m_SortedCells)
+        {
+            cell->Distance = GetDistanceToCell(*cell, cameraPosition);
+        }
+        std::sort(m_SortedCells.begin(), m_SortedCells.end(), [](const Cell* lhs, const Cell* rhs) { return lhs->Distance < rhs->Distance; });
+
+        PollLoads();
+
+        for (Cell* cell : m_SortedCells)
+        {
+            if (cell->Distance > m_Settings.UnloadRadius && (cell->State == CellState::Activating || cell->State == CellState::Resident))
+            {
+                StartUnload(*cell);
+            }
+        }
+
+        RequestLoads();
+
+        // 내리는 작업을 먼저 처리하여 Memory를 먼저 돌려받음.
+        m_Stats.ActivatedCellCount = 0;
+        uint32_t processedCount = ProcessUnloads(m_Settings.ElementsPerFrame);
+        processedCount += ProcessActivations(m_Settings.ElementsPerFrame - processedCount);
+        m_Stats.ProcessedElementCount = processedCount;
+
+        m_Stats.LoadingCellCount = 0;
+        m_Stats.ActivatingCellCount = 0;
+        m_Stats.ResidentCellCount = 0;
+        m_Stats.UnloadingCellCount = 0;
+        m_Stats.CommittedBytes = 0;
+        for (const Cell* cell : m_SortedCells)
+        {
+            switch (cell->State)
+            {
+            case CellState::Loading: m_Stats.LoadingCellCount++; break;
+            case CellState::Activating: m_Stats.ActivatingCellCount++; break;
+            case CellState::Resident: m_Stats.ResidentCellCount++; break;
+            case CellState::Unloading: m_Stats.UnloadingCellCount++; break;
+            default: break;
+            }
+            if (cell->State != CellState::Unloaded)
+            {
+                m_Stats.CommittedBytes += cell->SizeInBytes;
+            }
+        }
+    }
+
+    WorldPartition::CellState WorldPartition::GetCellState(int32_t cellX, int32_t cellZ) const
+    {
+        const auto it = m_Cells.find(MakeCellKey(cellX, cellZ));
+        return it != m_Cells.end() ? it->second.State : CellState::Unloaded;
+    }
+
+    uint64_t WorldPartition::MakeCellKey(int32_t cellX, int32_t cellZ)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32 | static_cast<uint32_t>(cellZ);
+    }
+
+    float WorldPartition::GetDistanceToCell(const Cell& cell, const DirectX::SimpleMath::Vector3& cameraPosition) const
+    {
+        // Cell 영역 안이면 0임.
+        const float minX = static_cast<float>(cell.X) * m_Settings.CellSize;
+        const float minZ = static_cast<float>(cell.Z) * m_Settings.CellSize;
+        const float dx = std::max({minX - cameraPosition.x, 0.0f, cameraPosition.x - (minX + m_Settings.CellSize)});
+        const float dz = std::max({minZ - cameraPosition.z, 0.0f, cameraPosition.z - (minZ + m_Settings.CellSize)});
+        return std::sqrt(dx * dx + dz * dz);
+    }
+
+    void WorldPartition::PollLoads()
+    {
+        for (Cell* cell : m_SortedCells)
+        {
+            if (cell->State != CellState::Loading || !cell->Request->bIsDone.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            if (!cell->Request->bHasSucceeded)
+            {
+                cell->bHasFailed = true;
+                cell->Request.reset();
+                cell->State = CellState::Unloaded;
+            }
+            else if (cell->Distance > m_Settings.UnloadRadius)
+            {
+                // 불러오는 동안 멀어졌다면 Scene에 넣지 않고 버림.
+                cell->Request.reset();
+                cell->State = CellState::Unloaded;
+            }
+            else
+            {
+                cell->State = CellState::Activating;
+            }
+        }
+    }
+
+    void WorldPartition::RequestLoads()
+    {
+        uint32_t loadingCount = 0;
+        uint64_t committedBytes = 0;
+        for (const Cell* cell : m_SortedCells)
+        {
+            loadingCount += cell->State == CellState::Loading;
+            committedBytes += cell->State != CellState::Unloaded ? cell->SizeInBytes : 0;
+        }
+
+        // 가까운 Cell부터 불러옴.
+        for (Cell* cell : m_SortedCells)
+        {
+            if (cell->Distance > m_Settings.LoadRadius || loadingCount >= m_Settings.MaxConcurrentLoads)
+            {
+                break;
+            }
+            if (cell->State != CellState::Unloaded || cell->bHasFailed)
+            {
+                continue;
+            }
+
+            // Budget을 넘는다면 더 먼 Cell을 내리기 시작하고, 내리는 작업이 끝난 뒤의 Frame에서 다시 시도함.
+            if (committedBytes + cell->SizeInBytes > m_Settings.MemoryBudgetInBytes)
+            {
+                EvictFor(*cell);
+                break;
+            }
+
+            cell->Request = std::make_shared<LoadRequest>();
+            cell->State = CellState::Loading;
+            loadingCount++;
+            committedBytes += cell->SizeInBytes;
+
+            m_JobSystem.SubmitBackground([request = cell->Request, filePath = cell->FilePath]
+            {
+                request->bHasSucceeded = request->Loader.Open(filePath);
+                request->bIsDone.store(true, std::memory_order_release);
+            }, &m_PendingLoads);
+        }
+    }
+
+    void WorldPartition::EvictFor(const Cell& cell)
+    {
+        // LoadRadius 밖이지만 Hysteresis 때문에 남아 있는 Cell 중 가장 먼 것부터 내림.
+        for (auto it = m_SortedCells.rbegin(); it != m_SortedCells.rend(); ++it)
+        {
+            Cell* candidate = *it;
+            if (candidate->Distance <= std::max(m_Settings.LoadRadius, cell.Distance))
+            {
+                break;
+            }
+            if (candidate->State == CellState::Resident || candidate->State == CellState::Activating)
+            {
+                StartUnload(*candidate);
+            }
+        }
+    }
+
+    void WorldPartition::StartUnload(Cell& cell)
+    {
+        if (cell.State == CellState::Activating)
+        {
+            cell.Entities = cell.Request->Loader.GetEntities();
+            cell.Request.reset();
+        }
+        cell.UnloadedEntityCount = 0;
+        cell.State = CellState::Unloading;
+    }
+
+    uint32_t WorldPartition::ProcessUnloads(uint32_t elementBudget)
+    {
+        const entt::registry& registry = m_Scene.GetRegistry();
+        uint32_t processedCount = 0;
+        std::vector<entt::entity> validEntities;
+        for (Cell* cell : m_SortedCells)
+        {
+            if (cell->State != CellState::Unloading)
+            {
+                continue;
+            }
+
+            // Cell이 올라가 있는 동안 다른 곳에서 삭제한 Entity도 있을 수 있음.
+            const size_t count = std::min<size_t>(elementBudget - processedCount, cell->Entities.size() - cell->UnloadedEntityCount);
+            const auto first = cell->Entities.begin() + static_cast<ptrdiff_t>(cell->UnloadedEntityCount);
+            validEntities.clear();
+            std::copy_if(first, first + static_cast<ptrdiff_t>(count), std::back_inserter(validEntities), [&](entt::entity entity) { return registry.valid(entity); });
+            m_Scene.DestroyEntities(validEntities);
+            cell->UnloadedEntityCount += count;
+            processedCount += static_cast<uint32_t>(count);
+
+            if (cell->UnloadedEntityCount < cell->Entities.size())
+            {
+                break;
+            }
+            cell->Entities = {};
+            cell->State = CellState::Unloaded;
+        }
+        return processedCount;
+    }
+
+    uint32_t WorldPartition::ProcessActivations(uint32_t elementBudget)
+    {
+        uint32_t processedCount = 0;
+        for (Cell* cell : m_SortedCells)
+        {
+            if (processedCount >= elementBudget)
+            {
+                break;
+            }
+            if (cell->State != CellState::Activating)
+            {
+                continue;
+            }
+
+            SceneSnapshot::Loader& loader = cell->Request->Loader;
+            processedCount += loader.Instantiate(m_Scene, elementBudget - processedCount);
+            if (loader.IsFinished())
+            {
+                // Mapping을 닫아 파일을 놓음.
+                cell->Entities = loader.GetEntities();
+                cell->Request.reset();
+                cell->State = CellState::Resident;
+                m_Stats.ActivatedCellCount++;
+            }
+        }
+        return processedCount;
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <SimpleMath.h>
+
+#include "SceneSnapshot.h"
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    class Scene;
+
+    // Scene을 XZ 평면의 정사각형 Cell로 나누고 Camera 주변의 Cell만 Scene에 올려 둠.
+    // Cell 하나는 Directory 안의 Snapshot 파일 하나이며, 파일을 열고 검증하는 작업은 Background Job에서,
+    // Scene에 넣고 빼는 작업은 Update에서 Frame마다 정해진 양만큼만 진행함.
+    // Renderer나 Window 없이 Scene과 JobSystem만으로 동작하므로 Camera 경로를 정해 두고 Update를 반복하여 검증할 수 있음.
+    class WorldPartition
+    {
+    public:
+        struct Settings
+        {
+            float CellSize = 64.0f;
+            // Camera와 Cell 사이의 거리가 LoadRadius 안이면 불러오고, UnloadRadius 밖이면 내림.
+            // 그 사이에서는 상태를 유지하므로 경계에서 Camera가 흔들려도 반복해서 불러오지 않음.
+            float LoadRadius = 128.0f;
+            float UnloadRadius = 192.0f;
+            // 올라가 있거나 불러오는 중인 Cell 파일 크기의 합. 넘는다면 먼 Cell을 먼저 내리고, 그래도 넘는다면 불러오지 않음.
+            uint64_t MemoryBudgetInBytes = 256ull * 1024 * 1024;
+            // 한 Frame에 Scene에 넣거나 빼는 Entity와 Component의 수.
+            uint32_t ElementsPerFrame = 16 * 1024;
+            uint32_t MaxConcurrentLoads = 4;
+        };
+
+        enum class CellState
+        {
+            Unloaded,
+            Loading,
+            Activating,
+            Resident,
+            Unloading
+        };
+
+        struct Stats
+        {
+            uint32_t CellCount = 0;
+            uint32_t LoadingCellCount = 0;
+            uint32_t ActivatingCellCount = 0;
+            uint32_t ResidentCellCount = 0;
+            uint32_t UnloadingCellCount = 0;
+            uint64_t CommittedBytes = 0;
+            // 마지막 Update에서 Scene에 올라간 Cell 수와 처리한 Entity/Component 수.
+            uint32_t ActivatedCellCount = 0;
+            uint32_t ProcessedElementCount = 0;
+        };
+
+    public:
+        // directory 안의 Cell 파일을 찾아 둠. Scene에는 아직 아무것도 올리지 않음.
+        WorldPartition(Scene& scene, JobSystem& jobSystem, std::filesystem::path directory, Settings settings);
+        // 진행 중인 Background Job이 끝날 때까지 기다림. Scene에 올라간 Entity는 그대로 남음.
+        ~WorldPartition();
+
+        WorldPartition(const WorldPartition&) = delete;
+        WorldPartition& operator=(const WorldPartition&) = delete;
+
+        // Root Entity의 World 위치로 Cell을 정하여 Subtree와 함께 Cell 파일로 저장함.
+        // TransformComponent가 없는 Entity와 excludedRoots의 Subtree는 Cell에 넣지 않고 Scene에 항상 남겨 둠.
+        // outPartitionedEntities에는 Cell에 저장된 Entity가 채워지며, Streaming을 시작하기 전에 Scene에서 삭제해야 함.
+        static bool Build(Scene& scene, const std::filesystem::path& directory, float cellSize,
+                          const std::vector<entt::entity>& excludedRoots, std::vector<entt::entity>& outPartitionedEntities);
+
+        void Update(const DirectX::SimpleMath::Vector3& cameraPosition);
+
+        CellState GetCellState(int32_t cellX, int32_t cellZ) const;
+        const Stats& GetStats() const { return m_Stats; }
+        const Settings& GetSettings() const { return m_Settings; }
+
+    private:
+        // Background Job과 공유하는 상태. Job이 끝나기 전에 Cell이 사라질 수 있으므로 따로 소유함.
+        struct LoadRequest
+        {
+            SceneSnapshot::Loader Loader;
+            std::atomic<bool> bIsDone = false;
+            bool bHasSucceeded = false;
+        };
+
+        struct Cell
+        {
+            int32_t X = 0;
+            int32_t Z = 0;
+            std::filesystem::path FilePath;
+            uint64_t SizeInBytes = 0;
+            CellState State = CellState::Unloaded;
+            // 파일이 잘못되었다면 다시 시도하지 않음.
+            bool bHasFailed = false;
+            float Distance = 0.0f;
+
+            std::shared_ptr<LoadRequest> Request;
+            std::vector<entt::entity> Entities;
+            size_t UnloadedEntityCount = 0;
+        };
+
+        static uint64_t MakeCellKey(int32_t cellX, int32_t cellZ);
+        float GetDistanceToCell(const Cell& cell, const DirectX::SimpleMath::Vector3& cameraPosition) const;
+
+        void PollLoads();
+        void RequestLoads();
+        void EvictFor(const Cell& cell);
+        void StartUnload(Cell& cell);
+        uint32_t ProcessUnloads(uint32_t elementBudget);
+        uint32_t ProcessActivations(uint32_t elementBudget);
+
+    private:
+        Scene& m_Scene;
+        JobSystem& m_JobSystem;
+        Settings m_Settings;
+
+        std::unordered_map<uint64_t, Cell> m_Cells;
+        // 가까운 순서로 정렬하기 위한 Cell 목록. Cell은 생성자에서만 추가되므로 주소가 바뀌지 않음.
+        std::vector<Cell*> m_SortedCells;
+        JobSystem::Counter m_PendingLoads;
+        Stats m_Stats;
+    };
+}
@@ -0,0 +1,68 @@
+#include "EnginePCH.h"
+#include "DescriptorAllocator.h"
+
+#include "Engine.h"
+
+namespace Engine
+{
+    DescriptorAllocator::DescriptorAllocator(uint32_t capacity)
+        : m_Capacity(capacity)
+    {
+        if (capacity > 0)
+        {
+            m_FreeRanges.emplace(0, capacity);
+        }
+    }
+
+    std::optional<uint32_t> DescriptorAllocator::Allocate(uint32_t count)
+    {
+        EG_CONFIRM(count > 0);
+        // 대부분 Descriptor 하나씩 할당하므로 앞에서부터 처음 맞는 구간을 씀. 그 경우 첫 구간에서 바로 끝남.
+        for (auto it = m_FreeRanges.begin(); it != m_FreeRanges.end(); ++it)
+        {
+            const auto [index, rangeCount] = *it;
+            if (rangeCount < count)
+            {
+                continue;
+            }
+
+            m_FreeRanges.erase(it);
+            if (rangeCount > count)
+            {
+                m_FreeRanges.emplace(index + count, rangeCount - count);
+            }
+            m_AllocatedCount += count;
+            return index;
+        }
+        return std::nullopt;
+    }
+
+    void DescriptorAllocator::Free(uint32_t index, uint32_t count)
+    {
+        EG_CONFIRM(count > 0 && index + count <= m_Capacity && count <= m_AllocatedCount);
+        auto next = m_FreeRanges.lower_bound(index);
+        // 이미 비어 있는 구간과 겹치면 두 번 Free한 것임.
+        EG_CONFIRM(next == m_FreeRanges.end() || index + count <= next->first);
+
+        uint32_t first = index;
+        uint32_t last = index + count;
+        if (next != m_FreeRanges.begin())
+        {
+            const auto previous = std::prev(next);
+            EG_CONFIRM(previous->first + previous->second <= index);
+            if (previous->first + previous->second == index)
+            {
+                first = previous->first;
+                m_FreeRanges.erase(previous);
+            }
+        }
+        if (next != m_FreeRanges.end() && next->first == last)
+        {
+            last += next->second;
+            m_FreeRanges.erase(next);
+        }
+
+        m_FreeRanges.emplace(first, last - first);
+        m_AllocatedCount -= count;
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <map>
+#include <optional>
+
+namespace Engine
+{
+    // Descriptor Heap 안에서 오래 유지되는 Descriptor의 자리를 나눠 주는 Free List의 Index 계산 부분.
+    // Heap을 직접 다루지 않으므로 UploadRing처럼 D3D12 없이도 검사할 수 있음.
+    // 빈 구간을 Index 순서로 보관하여 앞에서부터 맞는 구간을 찾고, Free하면 붙어 있는 빈 구간과 합침.
+    class DescriptorAllocator
+    {
+    public:
+        explicit DescriptorAllocator(uint32_t capacity = 0);
+
+        // 연속된 count개의 자리를 찾아 첫 Index를 반환함. 자리가 없으면 std::nullopt를 반환함.
+        std::optional<uint32_t> Allocate(uint32_t count);
+        // Allocate로 받은 구간을 그대로 돌려줘야 함. GPU가 아직 읽을 수 있는 Descriptor는 돌려주면 안 됨.
+        void Free(uint32_t index, uint32_t count);
+
+        uint32_t GetCapacity() const { return m_Capacity; }
+        uint32_t GetAllocatedCount() const { return m_AllocatedCount; }
+        // 빈 구간의 수. 많을수록 조각나 있어 큰 구간을 할당하기 어려움.
+        size_t GetFreeRangeCount() const { return m_FreeRanges.size(); }
+
+    private:
+        uint32_t m_Capacity = 0;
+        uint32_t m_AllocatedCount = 0;
+        // 빈 구간의 첫 Index와 길이.
+        std::map<uint32_t, uint32_t> m_FreeRanges;
+    };
+}
@@ -0,0 +1,63 @@
+#include "EnginePCH.h"
+#include "DescriptorHeap.h"
+
+#include "Engine.h"
+#include "Core/Core.h"
+
+namespace Engine
+{
+    void DescriptorHeap::Initialize(Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap, uint32_t transientCount)
+    {
+        const D3D12_DESCRIPTOR_HEAP_DESC heapDesc = heap->GetDesc();
+        EG_CONFIRM(transientCount < heapDesc.NumDescriptors);
+
+        m_Heap = std::move(heap);
+        m_Type = heapDesc.Type;
+        m_IncrementSize = Core::GetRenderContext().GetIncrementSize(m_Type);
+        m_bIsShaderVisible = (heapDesc.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) != 0;
+        m_CPUStart = m_Heap->GetCPUDescriptorHandleForHeapStart();
+        m_GPUStart = m_bIsShaderVisible ? m_Heap->GetGPUDescriptorHandleForHeapStart() : D3D12_GPU_DESCRIPTOR_HANDLE{};
+
+        m_TransientStart = heapDesc.NumDescriptors - transientCount;
+        m_PersistentAllocator = DescriptorAllocator(m_TransientStart);
+        m_TransientRing = UploadRing(transientCount);
+    }
+
+    DescriptorHandle DescriptorHeap::Allocate(uint32_t count)
+    {
+        const std::optional<uint32_t> index = m_PersistentAllocator.Allocate(count);
+        EG_CONFIRM(index.has_value());
+        return GetHandle(*index, count);
+    }
+
+    void DescriptorHeap::Free(DescriptorHandle& handle)
+    {
+        EG_CONFIRM(handle.IsValid() && handle.Index < m_TransientStart);
+        m_PersistentAllocator.Free(handle.Index, handle.Count);
+        handle = {};
+    }
+
+    std::optional<DescriptorHandle> DescriptorHeap::AllocateTransient(uint32_t count)
+    {
+        // Descriptor는 정렬이 필요 없으므로 Ring의 단위를 Byte 대신 Descriptor 하나로 씀.
+        const std::optional<uint64_t> offset = m_TransientRing.Allocate(count, 1);
+        if (!offset)
+        {
+            return std::nullopt;
+        }
+        return GetHandle(m_TransientStart + static_cast<uint32_t>(*offset), count);
+    }
+
+    DescriptorHandle DescriptorHeap::GetHandle(uint32_t index, uint32_t count) const
+    {
+        DescriptorHandle handle;
+        handle.CPU.ptr = m_CPUStart.ptr + static_cast<SIZE_T>(index) * m_IncrementSize;
+        if (m_bIsShaderVisible)
+        {
+            handle.GPU.ptr = m_GPUStart.ptr + static_cast<uint64_t>(index) * m_IncrementSize;
+        }
+        handle.Index = index;
+        handle.Count = count;
+        return handle;
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <d3d12.h>
+#include <optional>
+#include <wrl.h>
+
+#include "DescriptorAllocator.h"
+#include "UploadRing.h"
+
+namespace Engine
+{
+    // Heap 안의 연속된 Descriptor 구간. Count가 0이면 할당되지 않은 것임.
+    struct DescriptorHandle
+    {
+        D3D12_CPU_DESCRIPTOR_HANDLE CPU{};
+        // Shader Visible Heap에서만 유효함.
+        D3D12_GPU_DESCRIPTOR_HANDLE GPU{};
+        uint32_t Index = 0;
+        uint32_t Count = 0;
+
+        bool IsValid() const { return Count > 0; }
+    };
+
+    // Descriptor Heap 하나와 그 안의 자리를 관리함. 자리를 Index로 직접 정하지 않고 여기서 할당받아 사용함.
+    // 앞쪽은 Texture처럼 오래 유지되는 Descriptor를 위한 Free List이고, 뒤쪽 transientCount개는 Frame마다 만들고 버리는 Table을 위한 Ring임.
+    // Ring은 UploadRing과 같이 Renderer가 Frame Fence 값으로 Retire와 Reclaim을 호출해야 다시 쓸 수 있음.
+    class DescriptorHeap
+    {
+    public:
+        // heap의 Descriptor 중 마지막 transientCount개를 Ring으로 사용함.
+        void Initialize(Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap, uint32_t transientCount = 0);
+
+        // 자리가 없으면 중단함. Heap 크기는 Renderer에서 넉넉하게 정함.
+        DescriptorHandle Allocate(uint32_t count = 1);
+        // GPU가 아직 읽을 수 있는 Descriptor는 돌려주면 안 됨.
+        void Free(DescriptorHandle& handle);
+
+        // Ring에 자리가 없으면 std::nullopt를 반환함. 이번 Frame이 끝날 때까지만 유효함.
+        std::optional<DescriptorHandle> AllocateTransient(uint32_t count);
+        void Retire(uint64_t fenceValue) { m_TransientRing.Retire(fenceValue); }
+        void Reclaim(uint64_t completedFenceValue) { m_TransientRing.Reclaim(completedFenceValue); }
+        const UploadRing& GetTransientRing() const { return m_TransientRing; }
+
+        ID3D12DescriptorHeap* Get() const { return m_Heap.Get(); }
+        ID3D12DescriptorHeap* const* GetAddressOf() const { return m_Heap.GetAddressOf(); }
+        D3D12_DESCRIPTOR_HEAP_TYPE GetType() const { return m_Type; }
+
+    private:
+        DescriptorHandle GetHandle(uint32_t index, uint32_t count) const;
+
+    private:
+        Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_Heap = nullptr;
+        D3D12_DESCRIPTOR_HEAP_TYPE m_Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        uint32_t m_IncrementSize = 0;
+        bool m_bIsShaderVisible = false;
+        D3D12_CPU_DESCRIPTOR_HANDLE m_CPUStart{};
+        D3D12_GPU_DESCRIPTOR_HANDLE m_GPUStart{};
+
+        DescriptorAllocator m_PersistentAllocator;
+        // Ring의 Offset은 Ring 구간 안에서의 위치이므로 m_TransientStart를 더해야 Heap의 Index가 됨.
+        uint32_t m_TransientStart = 0;
+        UploadRing m_TransientRing;
+    };
+}
@@ -0,0 +1,237 @@
+#include "EnginePCH.h"
+#include "FrustumCulling.h"
+
+#include <intrin.h>
+
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // Job 하나가 검사하는 AABB 수. 너무 작으면 Job을 만드는 비용이 더 커짐.
+        constexpr size_t CullingChunkSize = 16 * 1024;
+
+        // 평면과 AABB 중심 사이의 거리가 -(|n| · extent)보다 작다면 AABB 전체가 평면 바깥쪽에 있음.
+        size_t CullScalar(const FrustumCulling::Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices)
+        {
+            size_t visibleCount = 0;
+            for (size_t i = first; i < first + count; ++i)
+            {
+                bool bIsVisible = true;
+                for (const DirectX::SimpleMath::Vector4& plane : planes)
+                {
+                    const float distance = plane.x * bounds.CenterX[i] + plane.y * bounds.CenterY[i] + plane.z * bounds.CenterZ[i] + plane.w;
+                    const float radius = std::abs(plane.x) * bounds.ExtentX[i] + std::abs(plane.y) * bounds.ExtentY[i] + std::abs(plane.z) * bounds.ExtentZ[i];
+                    bIsVisible &= distance + radius >= 0.0f;
+                }
+
+                // 분기 없이 항상 쓰고, 보이는 경우에만 다음 자리로 넘어감.
+                outVisibleIndices[visibleCount] = static_cast<uint32_t>(i);
+                visibleCount += bIsVisible;
+            }
+            return visibleCount;
+        }
+
+        // Lane마다 하나의 AABB를 담아 6개의 평면을 차례로 검사함. 마지막에 Mask의 Bit마다 Index를 씀.
+        size_t CullSSE(const FrustumCulling::Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices)
+        {
+            const size_t vectorCount = count / 4 * 4;
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            __m128 planeX[6], planeY[6], planeZ[6], planeW[6], absPlaneX[6], absPlaneY[6], absPlaneZ[6];
+            for (size_t p = 0; p < planes.size(); ++p)
+            {
+                planeX[p] = _mm_set1_ps(planes[p].x);
+                planeY[p] = _mm_set1_ps(planes[p].y);
+                planeZ[p] = _mm_set1_ps(planes[p].z);
+                planeW[p] = _mm_set1_ps(planes[p].w);
+                absPlaneX[p] = _mm_and_ps(planeX[p], absMask);
+                absPlaneY[p] = _mm_and_ps(planeY[p], absMask);
+                absPlaneZ[p] = _mm_and_ps(planeZ[p], absMask);
+            }
+
+            size_t visibleCount = 0;
+            for (size_t i = 0; i < vectorCount; i += 4)
+            {
+                const size_t index = first + i;
+                const __m128 centerX = _mm_loadu_ps(bounds.CenterX.data() + index);
+                const __m128 centerY = _mm_loadu_ps(bounds.CenterY.data() + index);
+                const __m128 centerZ = _mm_loadu_ps(bounds.CenterZ.data() + index);
+                const __m128 extentX = _mm_loadu_ps(bounds.ExtentX.data() + index);
+                const __m128 extentY = _mm_loadu_ps(bounds.ExtentY.data() + index);
+                const __m128 extentZ = _mm_loadu_ps(bounds.ExtentZ.data() + index);
+
+                __m128 bIsVisible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (size_t p = 0; p < planes.size(); ++p)
+                {
+                    __m128 distance = _mm_add_ps(_mm_mul_ps(planeX[p], centerX), planeW[p]);
+                    distance = _mm_add_ps(_mm_mul_ps(planeY[p], centerY), distance);
+                    distance = _mm_add_ps(_mm_mul_ps(planeZ[p], centerZ), distance);
+                    distance = _mm_add_ps(_mm_mul_ps(absPlaneX[p], extentX), distance);
+                    distance = _mm_add_ps(_mm_mul_ps(absPlaneY[p], extentY), distance);
+                    distance = _mm_add_ps(_mm_mul_ps(absPlaneZ[p], extentZ), distance);
+                    bIsVisible = _mm_and_ps(bIsVisible, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+                }
+
+                const int mask = _mm_movemask_ps(bIsVisible);
+                for (uint32_t lane = 0; lane < 4; ++lane)
+                {
+                    outVisibleIndices[visibleCount] = static_cast<uint32_t>(index + lane);
+                    visibleCount += (mask >> lane) & 1;
+                }
+            }
+
+            return visibleCount + CullScalar(planes, bounds, first + vectorCount, count - vectorCount, outVisibleIndices + visibleCount);
+        }
+
+        size_t CullAVX2(const FrustumCulling::Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices)
+        {
+            const size_t vectorCount = count / 8 * 8;
+            const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+            __m256 planeX[6], planeY[6], planeZ[6], planeW[6], absPlaneX[6], absPlaneY[6], absPlaneZ[6];
+            for (size_t p = 0; p < planes.size(); ++p)
+            {
+                planeX[p] = _mm256_set1_ps(planes[p].x);
+                planeY[p] = _mm256_set1_ps(planes[p].y);
+                planeZ[p] = _mm256_set1_ps(planes[p].z);
+                planeW[p] = _mm256_set1_ps(planes[p].w);
+                absPlaneX[p] = _mm256_and_ps(planeX[p], absMask);
+                absPlaneY[p] = _mm256_and_ps(planeY[p], absMask);
+                absPlaneZ[p] = _mm256_and_ps(planeZ[p], absMask);
+            }
+
+            size_t visibleCount = 0;
+            for (size_t i = 0; i < vectorCount; i += 8)
+            {
+                const size_t index = first + i;
+                const __m256 centerX = _mm256_loadu_ps(bounds.CenterX.data() + index);
+                const __m256 centerY = _mm256_loadu_ps(bounds.CenterY.data() + index);
+                const __m256 centerZ = _mm256_loadu_ps(bounds.CenterZ.data() + index);
+                const __m256 extentX = _mm256_loadu_ps(bounds.ExtentX.data() + index);
+                const __m256 extentY = _mm256_loadu_ps(bounds.ExtentY.data() + index);
+                const __m256 extentZ = _mm256_loadu_ps(bounds.ExtentZ.data() + index);
+
+                __m256 bIsVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for (size_t p = 0; p < planes.size(); ++p)
+                {
+                    __m256 distance = _mm256_fmadd_ps(planeX[p], centerX, planeW[p]);
+                    distance = _mm256_fmadd_ps(planeY[p], centerY, distance);
+                    distance = _mm256_fmadd_ps(planeZ[p], centerZ, distance);
+                    distance = _mm256_fmadd_ps(absPlaneX[p], extentX, distance);
+                    distance = _mm256_fmadd_ps(absPlaneY[p], extentY, distance);
+                    distance = _mm256_fmadd_ps(absPlaneZ[p], extentZ, distance);
+                    bIsVisible = _mm256_and_ps(bIsVisible, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+                }
+
+                // 8개 모두 보이지 않는 경우가 많으므로 그때는 쓰지 않고 넘어감.
+                const int mask = _mm256_movemask_ps(bIsVisible);
+                if (mask == 0)
+                {
+                    continue;
+                }
+                for (uint32_t lane = 0; lane < 8; ++lane)
+                {
+                    outVisibleIndices[visibleCount] = static_cast<uint32_t>(index + lane);
+                    visibleCount += (mask >> lane) & 1;
+                }
+            }
+
+            return visibleCount + CullSSE(planes, bounds, first + vectorCount, count - vectorCount, outVisibleIndices + visibleCount);
+        }
+    }
+
+    void CullingBoundsSoA::Resize(size_t count)
+    {
+        for (std::vector<float>* values : {&CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ})
+        {
+            values->resize(count);
+        }
+    }
+
+    void CullingBoundsSoA::Set(size_t index, const DirectX::BoundingBox& bounds)
+    {
+        CenterX[index] = bounds.Center.x;
+        CenterY[index] = bounds.Center.y;
+        CenterZ[index] = bounds.Center.z;
+        ExtentX[index] = bounds.Extents.x;
+        ExtentY[index] = bounds.Extents.y;
+        ExtentZ[index] = bounds.Extents.z;
+    }
+
+    namespace FrustumCulling
+    {
+        Planes ExtractPlanes(const DirectX::SimpleMath::Matrix& viewProjection)
+        {
+            // Clip 좌표는 v * M이므로 x, y, z, w는 각각 M의 1~4번째 열과의 내적임.
+            const DirectX::SimpleMath::Matrix& m = viewProjection;
+            const DirectX::SimpleMath::Vector4 column1(m._11, m._21, m._31, m._41);
+            const DirectX::SimpleMath::Vector4 column2(m._12, m._22, m._32, m._42);
+            const DirectX::SimpleMath::Vector4 column3(m._13, m._23, m._33, m._43);
+            const DirectX::SimpleMath::Vector4 column4(m._14, m._24, m._34, m._44);
+
+            Planes planes = {
+                column4 + column1,
+                column4 - column1,
+                column4 + column2,
+                column4 - column2,
+                column3,
+                column4 - column3,
+            };
+            for (DirectX::SimpleMath::Vector4& plane : planes)
+            {
+                plane /= DirectX::SimpleMath::Vector3(plane.x, plane.y, plane.z).Length();
+            }
+            return planes;
+        }
+
+        size_t Cull(const Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices)
+        {
+            static const TransformBatch::Path bestPath = TransformBatch::GetBestPath();
+            return Cull(bestPath, planes, bounds, first, count, outVisibleIndices);
+        }
+
+        size_t Cull(TransformBatch::Path path, const Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices)
+        {
+            switch (path)
+            {
+            case TransformBatch::Path::AVX2: return CullAVX2(planes, bounds, first, count, outVisibleIndices);
+            case TransformBatch::Path::SSE: return CullSSE(planes, bounds, first, count, outVisibleIndices);
+            default: return CullScalar(planes, bounds, first, count, outVisibleIndices);
+            }
+        }
+
+        void CullParallel(JobSystem& jobSystem, const Planes& planes, const CullingBoundsSoA& bounds, std::vector<uint32_t>& outVisibleIndices)
+        {
+            const size_t count = bounds.GetSize();
+            outVisibleIndices.resize(count);
+            const size_t chunkCount = (count + CullingChunkSize - 1) / CullingChunkSize;
+            if (chunkCount <= 1)
+            {
+                outVisibleIndices.resize(Cull(planes, bounds, 0, count, outVisibleIndices.data()));
+                return;
+            }
+
+            // 각 Chunk는 자기 구간의 앞부분에 결과를 쓰므로 Job끼리 겹치지 않음.
+            std::vector<size_t> visibleCounts(chunkCount);
+            JobSystem::Counter counter;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                jobSystem.Submit([&, chunk]
+                {
+                    const size_t first = chunk * CullingChunkSize;
+                    visibleCounts[chunk] = Cull(planes, bounds, first, std::min(CullingChunkSize, count - first), outVisibleIndices.data() + first);
+                }, &counter);
+            }
+            jobSystem.Wait(counter);
+
+            size_t visibleCount = visibleCounts[0];
+            for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+            {
+                const uint32_t* chunkIndices = outVisibleIndices.data() + chunk * CullingChunkSize;
+                std::copy(chunkIndices, chunkIndices + visibleCounts[chunk], outVisibleIndices.data() + visibleCount);
+                visibleCount += visibleCounts[chunk];
+            }
+            outVisibleIndices.resize(visibleCount);
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <SimpleMath.h>
+
+#include "ECS/TransformBatch.h"
+
+namespace Engine
+{
+    class JobSystem;
+
+    // World 공간 AABB를 성분별 배열로 펼친 것. Culling은 Lane마다 다른 AABB를 담아 검사함.
+    struct CullingBoundsSoA
+    {
+        std::vector<float> CenterX;
+        std::vector<float> CenterY;
+        std::vector<float> CenterZ;
+        std::vector<float> ExtentX;
+        std::vector<float> ExtentY;
+        std::vector<float> ExtentZ;
+
+        void Resize(size_t count);
+        void Set(size_t index, const DirectX::BoundingBox& bounds);
+        size_t GetSize() const { return CenterX.size(); }
+    };
+
+    // View-Projection 행렬에서 뽑은 6개의 평면으로 AABB를 검사하고, 보이는 것의 Index만 연속으로 모음.
+    // Path는 TransformBatch와 같은 CPU 검사 결과를 사용함.
+    namespace FrustumCulling
+    {
+        // Left, Right, Bottom, Top, Near, Far 순서. 법선은 Frustum 안쪽을 향하며 길이가 1임.
+        using Planes = std::array<DirectX::SimpleMath::Vector4, 6>;
+
+        // viewProjection은 이 Engine의 다른 행렬처럼 행 벡터(v * M)를 기준으로 하며, Clip 공간의 z는 [0, w] 범위임.
+        Planes ExtractPlanes(const DirectX::SimpleMath::Matrix& viewProjection);
+
+        // [first, first + count)를 검사하여 보이는 AABB의 Index를 outVisibleIndices에 앞에서부터 쓰고 그 개수를 반환함.
+        // outVisibleIndices는 count개를 쓸 수 있어야 함.
+        size_t Cull(const Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices);
+        size_t Cull(TransformBatch::Path path, const Planes& planes, const CullingBoundsSoA& bounds, size_t first, size_t count, uint32_t* outVisibleIndices);
+
+        // 구간을 나누어 Worker에서 검사한 뒤 결과를 앞으로 모음. 결과는 Index 순서대로 정렬되어 있음.
+        void CullParallel(JobSystem& jobSystem, const Planes& planes, const CullingBoundsSoA& bounds, std::vector<uint32_t>& outVisibleIndices);
+    }
+}
@@ -1,23 +1,17 @@
 #pragma once
 
-namespace Microsoft::WRL::Wrappers
-{
-    class Event;
-}
-
 namespace Engine
 {
     struct Texture;
+    class ResourceStateTracker;
+    class UploadManager;
 
     namespace GraphicsHelper
     {
-        void CreateTextureResource(entt::resource<Texture> textureHandle,
-                                   Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue,
-                                   Microsoft::WRL::ComPtr<ID3D12Fence> fence,
-                                   uint64_t& fenceValue,
-                                   Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList,
-                                   Microsoft::WRL::ComPtr<ID3D12Resource>& outResource);
-
-        void WaitForGPU(Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue, Microsoft::WRL::ComPtr<ID3D12Fence> fence, uint64_t& fenceValue);
+        // Texture를 COMMON으로 만들어 등록하고 Upload를 uploadManager의 Batch에 넣음. 반환한 Ticket이 끝나기 전에는 읽으면 안 됨.
+        uint64_t CreateTextureResource(entt::resource<Texture> textureHandle,
+                                       UploadManager& uploadManager,
+                                       ResourceStateTracker& resourceStates,
+                                       Microsoft::WRL::ComPtr<ID3D12Resource>& outResource);
     }
 }
@@ -9,4 +9,12 @@ namespace Engine
         DirectX::SimpleMath::Vector3 Normal{};
         DirectX::SimpleMath::Vector2 TexCoord{};
     };
+
+    // Shader의 LIGHT_TYPE_* 값과 같아야 함.
+    enum class LightType : uint32_t
+    {
+        Directional,
+        Point,
+        Spot
+    };
 }
@@ -0,0 +1,202 @@
+#include "EnginePCH.h"
+#include "LightClusterGrid.h"
+
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    LightClusterGrid::LightClusterGrid(Settings settings)
+        : m_Settings(settings)
+    {
+    }
+
+    void LightClusterGrid::Build(JobSystem& jobSystem, const DirectX::SimpleMath::Matrix& view, const DirectX::SimpleMath::Matrix& projection,
+                                 float nearPlane, float farPlane, std::span<const ShaderLight> lights)
+    {
+        UpdateClusterBounds(projection, nearPlane, farPlane);
+
+        // 각 Light가 걸치는 깊이 Slice 범위를 미리 구해 두면 Slice Job은 그 범위의 Light만 검사함.
+        m_LocalLights.clear();
+        for (uint32_t i = 0; i < static_cast<uint32_t>(lights.size()); ++i)
+        {
+            LocalLight localLight;
+            if (!ComputeViewBoundingSphere(lights[i], view, localLight.Center, localLight.Radius))
+            {
+                continue;
+            }
+
+            const float viewDepth = -localLight.Center.z;
+            if (viewDepth + localLight.Radius < nearPlane || viewDepth - localLight.Radius > farPlane)
+            {
+                continue;
+            }
+            // Slice 경계는 pow로, Light의 Slice는 log로 구하므로 오차로 빠지지 않도록 한 Slice씩 넓힘. 넓힌 Slice는 AABB 검사에서 걸러짐.
+            localLight.LightIndex = i;
+            localLight.FirstSlice = std::max(GetSlice(std::max(viewDepth - localLight.Radius, nearPlane)), 1u) - 1;
+            localLight.LastSlice = std::min(GetSlice(std::min(viewDepth + localLight.Radius, farPlane)) + 1, m_Settings.ClusterCountZ - 1);
+            m_LocalLights.push_back(localLight);
+        }
+
+        m_Clusters.resize(GetClusterCount());
+        m_SliceCandidates.resize(m_Settings.ClusterCountZ);
+        m_SliceLightIndices.resize(m_Settings.ClusterCountZ);
+        JobSystem::Counter counter;
+        for (uint32_t slice = 0; slice < m_Settings.ClusterCountZ; ++slice)
+        {
+            jobSystem.Submit([this, slice] { AssignSlice(slice); }, &counter);
+        }
+        jobSystem.Wait(counter);
+
+        m_Stats = {};
+        m_Stats.LocalLightCount = static_cast<uint32_t>(m_LocalLights.size());
+        m_LightIndices.clear();
+        const uint32_t clustersPerSlice = m_Settings.ClusterCountX * m_Settings.ClusterCountY;
+        for (uint32_t slice = 0; slice < m_Settings.ClusterCountZ; ++slice)
+        {
+            const uint32_t sliceOffset = static_cast<uint32_t>(m_LightIndices.size());
+            for (uint32_t cluster = slice * clustersPerSlice; cluster < (slice + 1) * clustersPerSlice; ++cluster)
+            {
+                m_Clusters[cluster].Offset += sliceOffset;
+                m_Stats.MaxLightsPerCluster = std::max(m_Stats.MaxLightsPerCluster, m_Clusters[cluster].Count);
+                m_Stats.OccupiedClusterCount += m_Clusters[cluster].Count > 0;
+            }
+            const std::vector<uint32_t>& sliceIndices = m_SliceLightIndices[slice];
+            m_LightIndices.insert(m_LightIndices.end(), sliceIndices.begin(), sliceIndices.end());
+        }
+        m_Stats.IndexCount = static_cast<uint32_t>(m_LightIndices.size());
+    }
+
+    bool LightClusterGrid::IntersectsCluster(uint32_t clusterIndex, const DirectX::SimpleMath::Vector3& viewCenter, float radius) const
+    {
+        const ClusterBounds& bounds = m_ClusterBounds[clusterIndex];
+        const DirectX::SimpleMath::Vector3 closestPoint = DirectX::SimpleMath::Vector3::Clamp(viewCenter, bounds.Min, bounds.Max);
+        return DirectX::SimpleMath::Vector3::DistanceSquared(closestPoint, viewCenter) <= radius * radius;
+    }
+
+    bool LightClusterGrid::ComputeViewBoundingSphere(const ShaderLight& light, const DirectX::SimpleMath::Matrix& view,
+                                                     DirectX::SimpleMath::Vector3& outCenter, float& outRadius)
+    {
+        const DirectX::SimpleMath::Vector3 viewPosition = DirectX::SimpleMath::Vector3::Transform(light.Position, view);
+        switch (light.Type)
+        {
+        case LightType::Point:
+            outCenter = viewPosition;
+            outRadius = light.Range;
+            return true;
+        case LightType::Spot:
+            {
+                // 원뿔을 감싸는 가장 작은 구. 넓은 원뿔은 밑면의 원이, 좁은 원뿔은 꼭짓점과 밑면 둘레가 구에 닿음.
+                const DirectX::SimpleMath::Vector3 viewDirection = DirectX::SimpleMath::Vector3::TransformNormal(light.Direction, view);
+                const float cosAngle = std::clamp(light.CosOuterCone, 0.0f, 1.0f);
+                // 반각이 45도보다 넓은 경우.
+                if (cosAngle < 0.70710678f)
+                {
+                    outCenter = viewPosition + viewDirection * (light.Range * cosAngle);
+                    outRadius = light.Range * std::sqrt(1.0f - cosAngle * cosAngle);
+                }
+                else
+                {
+                    outRadius = light.Range / (2.0f * cosAngle);
+                    outCenter = viewPosition + viewDirection * outRadius;
+                }
+                return true;
+            }
+        default:
+            return false;
+        }
+    }
+
+    void LightClusterGrid::UpdateClusterBounds(const DirectX::SimpleMath::Matrix& projection, float nearPlane, float farPlane)
+    {
+        if (!m_ClusterBounds.empty() && projection == m_BoundsProjection && nearPlane == m_BoundsNearPlane && farPlane == m_BoundsFarPlane)
+        {
+            return;
+        }
+        m_BoundsProjection = projection;
+        m_BoundsNearPlane = nearPlane;
+        m_BoundsFarPlane = farPlane;
+
+        const float logDepthRange = std::log(farPlane / nearPlane);
+        m_DepthSliceScale = static_cast<float>(m_Settings.ClusterCountZ) / logDepthRange;
+        m_DepthSliceBias = static_cast<float>(m_Settings.ClusterCountZ) * std::log(nearPlane) / logDepthRange;
+
+        // 오른손 좌표계에서 View 공간의 점 (x, y, -d)는 NDC의 x = (x * P11 - d * P31) / d에 놓임.
+        const auto toView = [&projection](float ndcX, float ndcY, float depth)
+        {
+            return DirectX::SimpleMath::Vector3((ndcX + projection._31) * depth / projection._11, (ndcY + projection._32) * depth / projection._22, -depth);
+        };
+
+        m_ClusterBounds.resize(GetClusterCount());
+        for (uint32_t z = 0; z < m_Settings.ClusterCountZ; ++z)
+        {
+            const float sliceNear = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z) / static_cast<float>(m_Settings.ClusterCountZ));
+            const float sliceFar = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z + 1) / static_cast<float>(m_Settings.ClusterCountZ));
+            for (uint32_t y = 0; y < m_Settings.ClusterCountY; ++y)
+            {
+                // 화면의 위쪽 Tile부터 0번이므로 NDC의 y는 위에서 아래로 줄어듦.
+                const float ndcTop = 1.0f - 2.0f * static_cast<float>(y) / static_cast<float>(m_Settings.ClusterCountY);
+                const float ndcBottom = 1.0f - 2.0f * static_cast<float>(y + 1) / static_cast<float>(m_Settings.ClusterCountY);
+                for (uint32_t x = 0; x < m_Settings.ClusterCountX; ++x)
+                {
+                    const float ndcLeft = -1.0f + 2.0f * static_cast<float>(x) / static_cast<float>(m_Settings.ClusterCountX);
+                    const float ndcRight = -1.0f + 2.0f * static_cast<float>(x + 1) / static_cast<float>(m_Settings.ClusterCountX);
+
+                    ClusterBounds& bounds = m_ClusterBounds[GetClusterIndex(x, y, z)];
+                    bounds.Min = DirectX::SimpleMath::Vector3(FLT_MAX);
+                    bounds.Max = DirectX::SimpleMath::Vector3(-FLT_MAX);
+                    for (const float depth : {sliceNear, sliceFar})
+                    {
+                        for (const float ndcX : {ndcLeft, ndcRight})
+                        {
+                            for (const float ndcY : {ndcBottom, ndcTop})
+                            {
+                                const DirectX::SimpleMath::Vector3 corner = toView(ndcX, ndcY, depth);
+                                bounds.Min = DirectX::SimpleMath::Vector3::Min(bounds.Min, corner);
+                                bounds.Max = DirectX::SimpleMath::Vector3::Max(bounds.Max, corner);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    uint32_t LightClusterGrid::GetSlice(float viewDepth) const
+    {
+        const float slice = std::floor(std::log(viewDepth) * m_DepthSliceScale - m_DepthSliceBias);
+        return static_cast<uint32_t>(std::clamp(slice, 0.0f, static_cast<float>(m_Settings.ClusterCountZ - 1)));
+    }
+
+    void LightClusterGrid::AssignSlice(uint32_t slice)
+    {
+        std::vector<uint32_t>& candidates = m_SliceCandidates[slice];
+        candidates.clear();
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_LocalLights.size()); ++i)
+        {
+            if (m_LocalLights[i].FirstSlice <= slice && slice <= m_LocalLights[i].LastSlice)
+            {
+                candidates.push_back(i);
+            }
+        }
+
+        std::vector<uint32_t>& sliceIndices = m_SliceLightIndices[slice];
+        sliceIndices.clear();
+
+        // Light 순서대로 검사하므로 Cluster의 Index 목록은 항상 오름차순임.
+        const uint32_t clustersPerSlice = m_Settings.ClusterCountX * m_Settings.ClusterCountY;
+        for (uint32_t cluster = slice * clustersPerSlice; cluster < (slice + 1) * clustersPerSlice; ++cluster)
+        {
+            ClusterRange& range = m_Clusters[cluster];
+            range.Offset = static_cast<uint32_t>(sliceIndices.size());
+            for (const uint32_t candidate : candidates)
+            {
+                const LocalLight& light = m_LocalLights[candidate];
+                if (IntersectsCluster(cluster, light.Center, light.Radius))
+                {
+                    sliceIndices.push_back(light.LightIndex);
+                }
+            }
+            range.Count = static_cast<uint32_t>(sliceIndices.size()) - range.Offset;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <span>
+#include <vector>
+#include <SimpleMath.h>
+
+#include "GraphicsTypes.h"
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Pixel Shader의 Light 구조체와 같은 배치. 위치와 방향은 World 공간이며, Color에는 Intensity가 곱해져 있음.
+    struct ShaderLight
+    {
+        DirectX::SimpleMath::Vector3 Position;
+        float Range = 0.0f;
+        DirectX::SimpleMath::Vector3 Color;
+        LightType Type = LightType::Directional;
+        DirectX::SimpleMath::Vector3 Direction;
+        float CosOuterCone = 0.0f;
+        float CosInnerCone = 0.0f;
+        float Padding[3]{};
+    };
+    static_assert(sizeof(ShaderLight) == 64);
+
+    // View Frustum을 화면 Tile과 지수 간격의 깊이 Slice로 나눈 Cluster마다 닿는 Point/Spot Light의 목록을 만듦.
+    // Pixel Shader는 자기 Cluster의 목록만 보므로 Light가 많아져도 Pixel마다 계산하는 Light 수는 크게 늘지 않음.
+    // 깊이 Slice마다 Job 하나가 그 Slice에 걸치는 Light만 골라 Cluster와 검사하고, 결과는 Slice 순서대로 이어 붙임.
+    class LightClusterGrid
+    {
+    public:
+        struct Settings
+        {
+            uint32_t ClusterCountX = 16;
+            uint32_t ClusterCountY = 9;
+            uint32_t ClusterCountZ = 24;
+        };
+
+        // Cluster의 Light Index는 GetLightIndices()[Offset, Offset + Count)에 있음.
+        struct ClusterRange
+        {
+            uint32_t Offset = 0;
+            uint32_t Count = 0;
+        };
+
+        struct Stats
+        {
+            uint32_t LocalLightCount = 0;
+            uint32_t IndexCount = 0;
+            uint32_t MaxLightsPerCluster = 0;
+            uint32_t OccupiedClusterCount = 0;
+        };
+
+    public:
+        explicit LightClusterGrid(Settings settings = {});
+
+        // lights 중 Directional Light는 모든 Pixel에 적용되므로 Cluster에 넣지 않음. Index는 lights 안의 위치임.
+        // view와 projection은 Renderer와 같이 오른손 좌표계를 기준으로 함.
+        void Build(JobSystem& jobSystem, const DirectX::SimpleMath::Matrix& view, const DirectX::SimpleMath::Matrix& projection,
+                   float nearPlane, float farPlane, std::span<const ShaderLight> lights);
+
+        // View 공간의 구가 Cluster의 AABB와 겹치는지 검사함.
+        bool IntersectsCluster(uint32_t clusterIndex, const DirectX::SimpleMath::Vector3& viewCenter, float radius) const;
+        // Light가 닿는 범위를 감싸는 View 공간의 구. Directional Light라면 false를 반환함.
+        static bool ComputeViewBoundingSphere(const ShaderLight& light, const DirectX::SimpleMath::Matrix& view,
+                                              DirectX::SimpleMath::Vector3& outCenter, float& outRadius);
+
+        uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const { return (z * m_Settings.ClusterCountY + y) * m_Settings.ClusterCountX + x; }
+        uint32_t GetClusterCount() const { return m_Settings.ClusterCountX * m_Settings.ClusterCountY * m_Settings.ClusterCountZ; }
+        const Settings& GetSettings() const { return m_Settings; }
+        // Shader는 View 공간 깊이 d의 Slice를 floor(log(d) * Scale - Bias)로 구함.
+        float GetDepthSliceScale() const { return m_DepthSliceScale; }
+        float GetDepthSliceBias() const { return m_DepthSliceBias; }
+
+        const std::vector<ClusterRange>& GetClusters() const { return m_Clusters; }
+        const std::vector<uint32_t>& GetLightIndices() const { return m_LightIndices; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        struct ClusterBounds
+        {
+            DirectX::SimpleMath::Vector3 Min;
+            DirectX::SimpleMath::Vector3 Max;
+        };
+
+        struct LocalLight
+        {
+            DirectX::SimpleMath::Vector3 Center;
+            float Radius = 0.0f;
+            uint32_t LightIndex = 0;
+            uint32_t FirstSlice = 0;
+            uint32_t LastSlice = 0;
+        };
+
+        // Projection이나 Near/Far가 바뀐 경우에만 Cluster의 AABB를 다시 계산함.
+        void UpdateClusterBounds(const DirectX::SimpleMath::Matrix& projection, float nearPlane, float farPlane);
+        uint32_t GetSlice(float viewDepth) const;
+        void AssignSlice(uint32_t slice);
+
+    private:
+        Settings m_Settings;
+        std::vector<ClusterBounds> m_ClusterBounds;
+        DirectX::SimpleMath::Matrix m_BoundsProjection;
+        float m_BoundsNearPlane = 0.0f;
+        float m_BoundsFarPlane = 0.0f;
+        float m_DepthSliceScale = 0.0f;
+        float m_DepthSliceBias = 0.0f;
+
+        std::vector<LocalLight> m_LocalLights;
+        // Slice마다 그 깊이에 걸치는 m_LocalLights의 Index.
+        std::vector<std::vector<uint32_t>> m_SliceCandidates;
+        // Slice마다 Job이 채우는 Index 목록. Cluster의 Offset은 Slice 안에서의 위치로 채운 뒤 이어 붙일 때 고침.
+        std::vector<std::vector<uint32_t>> m_SliceLightIndices;
+        std::vector<ClusterRange> m_Clusters;
+        std::vector<uint32_t> m_LightIndices;
+        Stats m_Stats;
+    };
+}
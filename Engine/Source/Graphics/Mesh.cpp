@@ -1,21 +1,88 @@
 #include "EnginePCH.h"
 #include "Mesh.h"
 
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>      // C++ importer interface
+#include <assimp/MemoryIOWrapper.h>
 #include <assimp/postprocess.h>     // Post processing flags
 #include <assimp/scene.h>           // Output data structure
 
+#include "AssetLoadProfiler.h"
+#include "Core/FileHelper.h"
+
 namespace Engine
 {
+    namespace
+    {
+        // 미리 읽은 Model File은 Memory에서 넘기고, mtllib 같은 나머지 File은 Model File의 경로 기준으로 Disk에서 엶.
+        class MeshIOSystem final : public Assimp::DefaultIOSystem
+        {
+        public:
+            MeshIOSystem(std::string_view filePath, const std::vector<uint8_t>& fileData)
+                : m_FilePath(filePath), m_FileData(fileData)
+            {
+            }
+
+            bool Exists(const char* pFile) const override
+            {
+                return m_FilePath == pFile || DefaultIOSystem::Exists(pFile);
+            }
+
+            Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override
+            {
+                if (m_FilePath == pFile)
+                {
+                    return new Assimp::MemoryIOStream(m_FileData.data(), m_FileData.size());
+                }
+
+                Assimp::IOStream* stream = DefaultIOSystem::Open(pFile, pMode);
+                if (stream)
+                {
+                    AssetLoadProfiler::AddBytesRead(stream->FileSize());
+                }
+                return stream;
+            }
+
+        private:
+            std::string m_FilePath;
+            const std::vector<uint8_t>& m_FileData;
+        };
+    }
+
     MeshLoader::result_type MeshLoader::operator()(std::string_view filePath) const
     {
-        Assimp::Importer importer;
+        AssetLoadProfiler::AssetScope assetScope(filePath);
 
         std::vector<Vertex> Vertices;
         std::vector<uint32_t> Indices;
 
 
-        const aiScene* scene = importer.ReadFile(filePath.data(), aiProcess_ConvertToLeftHanded | aiProcessPreset_TargetRealtime_Fast);
+        std::vector<uint8_t> fileData;
+        {
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::FileRead);
+            if (!FileHelper::ReadFile(filePath, fileData))
+            {
+                spdlog::debug("Failed to read {}", filePath);
+                return nullptr;
+            }
+            AssetLoadProfiler::AddBytesRead(fileData.size());
+        }
+
+        // ReadFileFromMemory는 경로를 모르므로 Material 같은 상대 경로 File을 찾지 못함. 경로로 읽되 IOSystem이 읽은 Data를 넘김.
+        Assimp::Importer importer;
+        importer.SetIOHandler(new MeshIOSystem(filePath, fileData));
+
+        const aiScene* scene = nullptr;
+        {
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::Decode);
+            scene = importer.ReadFile(std::string(filePath), 0);
+        }
+
+        AssetLoadProfiler::StageScope stageScope(AssetLoadStage::PostProcess);
+        if (scene)
+        {
+            scene = importer.ApplyPostProcessing(aiProcess_ConvertToLeftHanded | aiProcessPreset_TargetRealtime_Fast);
+        }
         if (!scene)
         {
             spdlog::debug("{}", importer.GetErrorString());
@@ -53,6 +120,11 @@ namespace Engine
 
         
         auto mesh = std::make_shared<Mesh>(Vertices, Indices);
+        if (!mesh->Vertices.empty())
+        {
+            DirectX::BoundingBox::CreateFromPoints(mesh->Bounds, mesh->Vertices.size(), &mesh->Vertices[0].Position, sizeof(Vertex));
+        }
+        AssetLoadProfiler::AddBytesResident(mesh->GetSizeInBytes());
         return mesh;
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
+#include <cstring>
 #include <memory>
 #include <vector>
 #include "GraphicsTypes.h"
+#include "Core/HashHelper.h"
 
 
 namespace Engine
@@ -11,7 +13,31 @@ namespace Engine
     {
         std::vector<Vertex> Vertices;
         std::vector<uint32_t> Indices;
-        
+
+        // 같은 내용의 Mesh는 하나의 GPU Buffer를 공유함.
+        Microsoft::WRL::ComPtr<ID3D12Resource> VertexBuffer = nullptr;
+        Microsoft::WRL::ComPtr<ID3D12Resource> IndexBuffer = nullptr;
+        D3D12_VERTEX_BUFFER_VIEW VertexBufferView{};
+        D3D12_INDEX_BUFFER_VIEW IndexBufferView{};
+        // Buffer의 Upload가 끝나면 UploadManager의 Fence가 도달하는 값. 그 전에 그리려면 GPU에서 기다려야 함.
+        uint64_t UploadFenceValue = 0;
+        // Local 공간의 Vertex를 감싸는 AABB. Culling과 SceneBVH가 World 공간으로 변환하여 사용함.
+        DirectX::BoundingBox Bounds;
+
+        uint64_t GetSizeInBytes() const { return Vertices.size() * sizeof(Vertex) + Indices.size() * sizeof(uint32_t); }
+
+        uint64_t GetContentHash() const
+        {
+            const uint64_t vertexHash = HashHelper::HashBytes(Vertices.data(), Vertices.size() * sizeof(Vertex));
+            return HashHelper::HashBytes(Indices.data(), Indices.size() * sizeof(uint32_t), vertexHash);
+        }
+
+        // Hash가 같을 때 실제로 같은 내용인지 Byte 단위로 확인함.
+        bool HasSameContent(const Mesh& other) const
+        {
+            return Vertices.size() == other.Vertices.size() && Indices == other.Indices &&
+                (Vertices.empty() || std::memcmp(Vertices.data(), other.Vertices.data(), Vertices.size() * sizeof(Vertex)) == 0);
+        }
     };
 
 
@@ -0,0 +1,379 @@
+// Engine 없이 Test와 Benchmark를 Build할 수 있도록 Precompiled Header를 쓰지 않음. 필요한 Header는 모두 여기서 Include함.
+#include "OcclusionBuffer.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <immintrin.h>
+
+#include "FrustumCulling.h"
+#include "Core/Assert.h"
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // 이보다 w가 작은 Vertex는 Camera 뒤에 있을 수 있으므로 그 Triangle을 그리지 않음. 덜 가리는 쪽이므로 안전함.
+        constexpr float MinimumClipW = 1e-5f;
+        // Job 하나가 검사하는 Occludee 수.
+        constexpr size_t VisibilityChunkSize = 4 * 1024;
+
+        DirectX::SimpleMath::Vector4 TransformToClip(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Matrix& matrix)
+        {
+            return DirectX::SimpleMath::Vector4::Transform(DirectX::SimpleMath::Vector4(position.x, position.y, position.z, 1.0f), matrix);
+        }
+    }
+
+    OcclusionBuffer::OcclusionBuffer()
+        : OcclusionBuffer(Settings{})
+    {
+    }
+
+    OcclusionBuffer::OcclusionBuffer(Settings settings)
+        : m_Settings(settings)
+    {
+        EG_CONFIRM(settings.Width % TileWidth == 0 && settings.Height % TileHeight == 0);
+        m_TileCountX = settings.Width / TileWidth;
+        m_TileCountY = settings.Height / TileHeight;
+
+        uint32_t width = settings.Width;
+        uint32_t height = settings.Height;
+        m_HierarchicalZ.push_back({width, height, std::vector<float>(static_cast<size_t>(width) * height, 1.0f)});
+        while (width > 1 || height > 1)
+        {
+            width = (width + 1) / 2;
+            height = (height + 1) / 2;
+            m_HierarchicalZ.push_back({width, height, std::vector<float>(static_cast<size_t>(width) * height, 1.0f)});
+        }
+    }
+
+    void OcclusionBuffer::Begin(const DirectX::SimpleMath::Matrix& viewProjection)
+    {
+        m_ViewProjection = viewProjection;
+        m_Occluders.clear();
+        m_TriangleCount = 0;
+    }
+
+    void OcclusionBuffer::AddOccluder(const DirectX::SimpleMath::Matrix& world, std::span<const Vertex> vertices, std::span<const uint32_t> indices)
+    {
+        m_Occluders.push_back({world * m_ViewProjection, vertices, indices, m_TriangleCount});
+        m_TriangleCount += static_cast<uint32_t>(indices.size() / 3);
+    }
+
+    void OcclusionBuffer::Rasterize(JobSystem& jobSystem)
+    {
+        const uint32_t trianglesPerJob = m_Settings.TrianglesPerBinningJob;
+        const uint32_t binningJobCount = (m_TriangleCount + trianglesPerJob - 1) / trianglesPerJob;
+        const uint32_t tileCount = m_TileCountX * m_TileCountY;
+
+        // 이전 Frame의 Bin은 비우기만 하여 할당을 재사용함.
+        m_BinningResults.resize(binningJobCount);
+        JobSystem::Counter counter;
+        for (uint32_t job = 0; job < binningJobCount; ++job)
+        {
+            jobSystem.Submit([this, job, trianglesPerJob, tileCount]
+            {
+                BinningResult& result = m_BinningResults[job];
+                result.Triangles.clear();
+                result.TileBins.resize(tileCount);
+                for (std::vector<uint32_t>& bin : result.TileBins)
+                {
+                    bin.clear();
+                }
+
+                const uint32_t firstTriangle = job * trianglesPerJob;
+                BinTriangles(firstTriangle, std::min(trianglesPerJob, m_TriangleCount - firstTriangle), result);
+            }, &counter);
+        }
+        jobSystem.Wait(counter);
+
+        for (uint32_t tile = 0; tile < tileCount; ++tile)
+        {
+            jobSystem.Submit([this, tile] { RasterizeTile(tile); }, &counter);
+        }
+        jobSystem.Wait(counter);
+
+        BuildHierarchicalZ();
+
+        m_Stats = {};
+        m_Stats.OccluderCount = static_cast<uint32_t>(m_Occluders.size());
+        m_Stats.TriangleCount = m_TriangleCount;
+        for (const BinningResult& result : m_BinningResults)
+        {
+            m_Stats.SkippedTriangleCount += result.SkippedTriangleCount;
+            m_Stats.BinnedTriangleCount += static_cast<uint32_t>(result.Triangles.size());
+        }
+    }
+
+    void OcclusionBuffer::BinTriangles(uint32_t firstTriangle, uint32_t triangleCount, BinningResult& outResult) const
+    {
+        const float width = static_cast<float>(m_Settings.Width);
+        const float height = static_cast<float>(m_Settings.Height);
+        outResult.SkippedTriangleCount = 0;
+
+        // Triangle 구간이 여러 Occluder에 걸칠 수 있으므로 첫 Triangle이 속한 Occluder부터 차례로 넘어감.
+        auto occluder = std::upper_bound(m_Occluders.begin(), m_Occluders.end(), firstTriangle, [](uint32_t triangle, const Occluder& other)
+        {
+            return triangle < other.FirstTriangle;
+        }) - 1;
+
+        for (uint32_t triangle = firstTriangle; triangle < firstTriangle + triangleCount; ++triangle)
+        {
+            while (triangle >= occluder->FirstTriangle + occluder->Indices.size() / 3)
+            {
+                ++occluder;
+            }
+
+            const uint32_t* indices = occluder->Indices.data() + (triangle - occluder->FirstTriangle) * 3;
+            float x[3], y[3], z[3];
+            bool bIsBehindNear = false;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const DirectX::SimpleMath::Vector4 clip = TransformToClip(occluder->Vertices[indices[i]].Position, occluder->WorldViewProjection);
+                bIsBehindNear |= clip.w < MinimumClipW;
+                const float inverseW = 1.0f / clip.w;
+                x[i] = (clip.x * inverseW * 0.5f + 0.5f) * width;
+                y[i] = (0.5f - clip.y * inverseW * 0.5f) * height;
+                z[i] = clip.z * inverseW;
+            }
+
+            // Screen 공간은 y가 아래로 커지므로 이 값이 양수인 순서로 Edge 함수를 만들면 안쪽이 양수가 됨.
+            float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+            if (bIsBehindNear || std::abs(area) < 1e-6f)
+            {
+                ++outResult.SkippedTriangleCount;
+                continue;
+            }
+            if (area < 0.0f)
+            {
+                std::swap(x[1], x[2]);
+                std::swap(y[1], y[2]);
+                std::swap(z[1], z[2]);
+                area = -area;
+            }
+
+            ScreenTriangle screenTriangle;
+            screenTriangle.MinX = std::max(0, static_cast<int32_t>(std::ceil(std::min({x[0], x[1], x[2]}) - 0.5f)));
+            screenTriangle.MinY = std::max(0, static_cast<int32_t>(std::ceil(std::min({y[0], y[1], y[2]}) - 0.5f)));
+            screenTriangle.MaxX = std::min(static_cast<int32_t>(m_Settings.Width) - 1, static_cast<int32_t>(std::floor(std::max({x[0], x[1], x[2]}) - 0.5f)));
+            screenTriangle.MaxY = std::min(static_cast<int32_t>(m_Settings.Height) - 1, static_cast<int32_t>(std::floor(std::max({y[0], y[1], y[2]}) - 0.5f)));
+            if (screenTriangle.MinX > screenTriangle.MaxX || screenTriangle.MinY > screenTriangle.MaxY)
+            {
+                continue;
+            }
+
+            for (uint32_t edge = 0; edge < 3; ++edge)
+            {
+                const uint32_t a = (edge + 1) % 3;
+                const uint32_t b = (edge + 2) % 3;
+                screenTriangle.EdgeA[edge] = y[a] - y[b];
+                screenTriangle.EdgeB[edge] = x[b] - x[a];
+                screenTriangle.EdgeC[edge] = x[a] * y[b] - y[a] * x[b];
+            }
+
+            const float inverseArea = 1.0f / area;
+            screenTriangle.DepthA = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) * inverseArea;
+            screenTriangle.DepthB = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) * inverseArea;
+            screenTriangle.DepthC = z[0] - screenTriangle.DepthA * x[0] - screenTriangle.DepthB * y[0];
+
+            const uint32_t triangleIndex = static_cast<uint32_t>(outResult.Triangles.size());
+            outResult.Triangles.push_back(screenTriangle);
+            for (uint32_t tileY = screenTriangle.MinY / TileHeight; tileY <= screenTriangle.MaxY / TileHeight; ++tileY)
+            {
+                for (uint32_t tileX = screenTriangle.MinX / TileWidth; tileX <= screenTriangle.MaxX / TileWidth; ++tileX)
+                {
+                    outResult.TileBins[tileY * m_TileCountX + tileX].push_back(triangleIndex);
+                }
+            }
+        }
+    }
+
+    void OcclusionBuffer::RasterizeTile(uint32_t tileIndex)
+    {
+        const int32_t tileMinX = static_cast<int32_t>(tileIndex % m_TileCountX * TileWidth);
+        const int32_t tileMinY = static_cast<int32_t>(tileIndex / m_TileCountX * TileHeight);
+        const int32_t tileMaxX = tileMinX + static_cast<int32_t>(TileWidth) - 1;
+        const int32_t tileMaxY = tileMinY + static_cast<int32_t>(TileHeight) - 1;
+        float* depth = m_HierarchicalZ[0].Depth.data();
+        const size_t width = m_Settings.Width;
+
+        for (int32_t y = tileMinY; y <= tileMaxY; ++y)
+        {
+            std::fill_n(depth + y * width + tileMinX, TileWidth, 1.0f);
+        }
+
+        const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+        const __m128 zero = _mm_setzero_ps();
+        // Job 순서대로 Bin을 읽지만 Pixel마다 최솟값만 남기므로 순서는 결과에 영향을 주지 않음.
+        for (const BinningResult& result : m_BinningResults)
+        {
+            for (const uint32_t triangleIndex : result.TileBins[tileIndex])
+            {
+                const ScreenTriangle& triangle = result.Triangles[triangleIndex];
+                // Tile의 시작은 4의 배수이므로 4 Pixel 단위로 내려 맞춰도 Tile 밖으로 나가지 않음.
+                const int32_t minX = std::max(triangle.MinX, tileMinX) & ~3;
+                const int32_t maxX = std::min(triangle.MaxX, tileMaxX);
+                const int32_t minY = std::max(triangle.MinY, tileMinY);
+                const int32_t maxY = std::min(triangle.MaxY, tileMaxY);
+
+                const __m128 edgeA0 = _mm_set1_ps(triangle.EdgeA[0]);
+                const __m128 edgeA1 = _mm_set1_ps(triangle.EdgeA[1]);
+                const __m128 edgeA2 = _mm_set1_ps(triangle.EdgeA[2]);
+                const __m128 depthA = _mm_set1_ps(triangle.DepthA);
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    const float pixelY = static_cast<float>(y) + 0.5f;
+                    const __m128 rowEdge0 = _mm_set1_ps(triangle.EdgeB[0] * pixelY + triangle.EdgeC[0]);
+                    const __m128 rowEdge1 = _mm_set1_ps(triangle.EdgeB[1] * pixelY + triangle.EdgeC[1]);
+                    const __m128 rowEdge2 = _mm_set1_ps(triangle.EdgeB[2] * pixelY + triangle.EdgeC[2]);
+                    const __m128 rowDepth = _mm_set1_ps(triangle.DepthB * pixelY + triangle.DepthC);
+                    float* row = depth + y * width;
+
+                    for (int32_t x = minX; x <= maxX; x += 4)
+                    {
+                        const __m128 pixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+                        __m128 bIsInside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA0, pixelX), rowEdge0), zero);
+                        bIsInside = _mm_and_ps(bIsInside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA1, pixelX), rowEdge1), zero));
+                        bIsInside = _mm_and_ps(bIsInside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA2, pixelX), rowEdge2), zero));
+                        if (_mm_movemask_ps(bIsInside) == 0)
+                        {
+                            continue;
+                        }
+
+                        // Near 평면 앞의 Vertex는 음수 Depth를 만들 수 있으므로 0으로 자름.
+                        const __m128 triangleDepth = _mm_max_ps(_mm_add_ps(_mm_mul_ps(depthA, pixelX), rowDepth), zero);
+                        const __m128 oldDepth = _mm_loadu_ps(row + x);
+                        const __m128 newDepth = _mm_min_ps(oldDepth, triangleDepth);
+                        _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(bIsInside, newDepth), _mm_andnot_ps(bIsInside, oldDepth)));
+                    }
+                }
+            }
+        }
+    }
+
+    void OcclusionBuffer::BuildHierarchicalZ()
+    {
+        for (size_t level = 1; level < m_HierarchicalZ.size(); ++level)
+        {
+            const DepthLevel& source = m_HierarchicalZ[level - 1];
+            DepthLevel& destination = m_HierarchicalZ[level];
+            for (uint32_t y = 0; y < destination.Height; ++y)
+            {
+                // 홀수 크기의 마지막 Texel은 짝이 없으므로 자기 자신을 한 번 더 읽음.
+                const float* sourceRow0 = source.Depth.data() + static_cast<size_t>(y) * 2 * source.Width;
+                const float* sourceRow1 = source.Depth.data() + static_cast<size_t>(std::min(y * 2 + 1, source.Height - 1)) * source.Width;
+                for (uint32_t x = 0; x < destination.Width; ++x)
+                {
+                    const uint32_t x0 = x * 2;
+                    const uint32_t x1 = std::min(x0 + 1, source.Width - 1);
+                    destination.Depth[static_cast<size_t>(y) * destination.Width + x] = std::max(std::max(sourceRow0[x0], sourceRow0[x1]), std::max(sourceRow1[x0], sourceRow1[x1]));
+                }
+            }
+        }
+    }
+
+    bool OcclusionBuffer::IsVisible(const DirectX::BoundingBox& worldBounds) const
+    {
+        DirectX::XMFLOAT3 corners[DirectX::BoundingBox::CORNER_COUNT];
+        worldBounds.GetCorners(corners);
+
+        float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, minDepth = FLT_MAX;
+        for (const DirectX::XMFLOAT3& corner : corners)
+        {
+            const DirectX::SimpleMath::Vector4 clip = TransformToClip(corner, m_ViewProjection);
+            if (clip.w < MinimumClipW)
+            {
+                return true;
+            }
+
+            const float inverseW = 1.0f / clip.w;
+            const float x = (clip.x * inverseW * 0.5f + 0.5f) * static_cast<float>(m_Settings.Width);
+            const float y = (0.5f - clip.y * inverseW * 0.5f) * static_cast<float>(m_Settings.Height);
+            minX = std::min(minX, x);
+            maxX = std::max(maxX, x);
+            minY = std::min(minY, y);
+            maxY = std::max(maxY, y);
+            minDepth = std::min(minDepth, clip.z * inverseW);
+        }
+
+        // 사각형이 조금이라도 걸치는 Pixel을 모두 포함함.
+        int32_t pixelMinX = std::max(0, static_cast<int32_t>(std::floor(minX)));
+        int32_t pixelMinY = std::max(0, static_cast<int32_t>(std::floor(minY)));
+        int32_t pixelMaxX = std::min(static_cast<int32_t>(m_Settings.Width) - 1, static_cast<int32_t>(std::floor(maxX)));
+        int32_t pixelMaxY = std::min(static_cast<int32_t>(m_Settings.Height) - 1, static_cast<int32_t>(std::floor(maxY)));
+        if (pixelMinX > pixelMaxX || pixelMinY > pixelMaxY)
+        {
+            return false;
+        }
+
+        // 각 축으로 4개 이하의 Texel을 덮는 Level까지 내려가 그 Texel만 검사함.
+        size_t level = 0;
+        while (level + 1 < m_HierarchicalZ.size() && (pixelMaxX - pixelMinX >= 4 || pixelMaxY - pixelMinY >= 4))
+        {
+            ++level;
+            pixelMinX /= 2;
+            pixelMinY /= 2;
+            pixelMaxX /= 2;
+            pixelMaxY /= 2;
+        }
+
+        // Level 크기는 올림하여 줄였으므로 반으로 나눈 Index는 항상 안에 있지만, Level의 실제 크기로 한 번 더 자름.
+        const DepthLevel& levelDepth = m_HierarchicalZ[level];
+        pixelMaxX = std::min(pixelMaxX, static_cast<int32_t>(levelDepth.Width) - 1);
+        pixelMaxY = std::min(pixelMaxY, static_cast<int32_t>(levelDepth.Height) - 1);
+        for (int32_t y = pixelMinY; y <= pixelMaxY; ++y)
+        {
+            for (int32_t x = pixelMinX; x <= pixelMaxX; ++x)
+            {
+                if (minDepth <= levelDepth.Depth[static_cast<size_t>(y) * levelDepth.Width + x])
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void OcclusionBuffer::FilterVisible(JobSystem& jobSystem, const CullingBoundsSoA& bounds, std::span<const uint32_t> candidateIndices, std::vector<uint32_t>& outVisibleIndices) const
+    {
+        const size_t count = candidateIndices.size();
+        const size_t chunkCount = (count + VisibilityChunkSize - 1) / VisibilityChunkSize;
+        // 같은 배열이라면 크기가 그대로이므로 candidateIndices가 무효화되지 않음.
+        outVisibleIndices.resize(count);
+
+        // 각 Chunk는 자기 구간 안에서 읽은 위치보다 앞쪽에만 쓰므로 같은 배열이어도 안전함.
+        std::vector<size_t> visibleCounts(chunkCount);
+        JobSystem::Counter counter;
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            jobSystem.Submit([&, chunk]
+            {
+                const size_t first = chunk * VisibilityChunkSize;
+                const size_t last = std::min(first + VisibilityChunkSize, count);
+                size_t visibleCount = 0;
+                for (size_t i = first; i < last; ++i)
+                {
+                    const uint32_t index = candidateIndices[i];
+                    const DirectX::BoundingBox box({bounds.CenterX[index], bounds.CenterY[index], bounds.CenterZ[index]},
+                                                   {bounds.ExtentX[index], bounds.ExtentY[index], bounds.ExtentZ[index]});
+                    if (IsVisible(box))
+                    {
+                        outVisibleIndices[first + visibleCount++] = index;
+                    }
+                }
+                visibleCounts[chunk] = visibleCount;
+            }, &counter);
+        }
+        jobSystem.Wait(counter);
+
+        size_t visibleCount = 0;
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const uint32_t* chunkIndices = outVisibleIndices.data() + chunk * VisibilityChunkSize;
+            std::copy(chunkIndices, chunkIndices + visibleCounts[chunk], outVisibleIndices.data() + visibleCount);
+            visibleCount += visibleCounts[chunk];
+        }
+        outVisibleIndices.resize(visibleCount);
+    }
+}
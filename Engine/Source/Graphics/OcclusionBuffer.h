@@ -0,0 +1,128 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <SimpleMath.h>
+
+#include "GraphicsTypes.h"
+
+namespace Engine
+{
+    class JobSystem;
+    struct CullingBoundsSoA;
+
+    // Occluder Mesh를 낮은 해상도의 Depth Buffer에 CPU로 그린 뒤, 그 Hierarchical-Z로 AABB가 가려졌는지 검사함.
+    // GPU 없이 동작하며, Pixel마다 가장 가까운 Depth만 남기므로 Job의 실행 순서와 관계없이 결과가 같음.
+    // SimpleMath와 JobSystem 외의 Engine 코드에 의존하지 않으므로 Engine/Tests의 OcclusionBufferTest가 따로 Build하여 검사함.
+    //
+    // Rasterize는 두 단계로 나뉨.
+    // 1. Triangle을 나누어 Job마다 Screen 공간으로 변환하고, 겹치는 Tile의 Bin에 넣음.
+    // 2. Tile마다 Job 하나가 모든 Bin의 Triangle을 SSE로 4 Pixel씩 그림. Tile끼리는 Pixel을 공유하지 않음.
+    class OcclusionBuffer
+    {
+    public:
+        static constexpr uint32_t TileWidth = 32;
+        static constexpr uint32_t TileHeight = 16;
+
+        struct Settings
+        {
+            // TileWidth와 TileHeight의 배수여야 함.
+            uint32_t Width = 256;
+            uint32_t Height = 128;
+            // Job 하나가 변환하고 Binning하는 Triangle 수.
+            uint32_t TrianglesPerBinningJob = 4 * 1024;
+        };
+
+        struct Stats
+        {
+            uint32_t OccluderCount = 0;
+            uint32_t TriangleCount = 0;
+            // Near 평면 뒤에 있거나 넓이가 없어 그리지 않은 Triangle 수.
+            uint32_t SkippedTriangleCount = 0;
+            uint32_t BinnedTriangleCount = 0;
+        };
+
+    public:
+        // GCC와 Clang은 Class 정의 안에서 Settings의 기본 멤버 초기화를 기본 인자로 쓰지 못하므로 기본 생성자를 따로 둠.
+        OcclusionBuffer();
+        explicit OcclusionBuffer(Settings settings);
+
+        // 이전 Frame의 Occluder를 비움. viewProjection은 행 벡터 기준이고 Clip 공간의 z는 [0, w] 범위임.
+        void Begin(const DirectX::SimpleMath::Matrix& viewProjection);
+        // vertices와 indices는 Rasterize가 끝날 때까지 유지되어야 함. 양면을 모두 그림.
+        void AddOccluder(const DirectX::SimpleMath::Matrix& world, std::span<const Vertex> vertices, std::span<const uint32_t> indices);
+        // Depth를 가장 먼 값으로 채운 뒤 Occluder를 그리고 Hierarchical-Z를 만듦.
+        void Rasterize(JobSystem& jobSystem);
+
+        // Rasterize 뒤에 호출해야 함. AABB가 Near 평면에 걸치면 보이는 것으로 봄.
+        bool IsVisible(const DirectX::BoundingBox& worldBounds) const;
+        // candidateIndices 중 보이는 것만 순서대로 outVisibleIndices에 남김. candidateIndices와 outVisibleIndices는 같은 배열이어도 됨.
+        void FilterVisible(JobSystem& jobSystem, const CullingBoundsSoA& bounds, std::span<const uint32_t> candidateIndices, std::vector<uint32_t>& outVisibleIndices) const;
+
+        uint32_t GetWidth() const { return m_Settings.Width; }
+        uint32_t GetHeight() const { return m_Settings.Height; }
+        // 행 우선으로 놓인 Depth. 비어 있는 Pixel은 1임.
+        const std::vector<float>& GetDepth() const { return m_HierarchicalZ[0].Depth; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        struct Occluder
+        {
+            DirectX::SimpleMath::Matrix WorldViewProjection;
+            std::span<const Vertex> Vertices;
+            std::span<const uint32_t> Indices;
+            // 이 Occluder 앞까지의 Triangle 수.
+            uint32_t FirstTriangle = 0;
+        };
+
+        // Pixel 중심 (x + 0.5, y + 0.5)에서 세 Edge 함수가 모두 0 이상이면 안쪽임. Depth는 Screen 공간의 평면으로 보간함.
+        struct ScreenTriangle
+        {
+            float EdgeA[3];
+            float EdgeB[3];
+            float EdgeC[3];
+            float DepthA;
+            float DepthB;
+            float DepthC;
+            // 중심이 Triangle의 AABB 안에 들어오는 Pixel 범위. 양 끝을 포함함.
+            int32_t MinX;
+            int32_t MinY;
+            int32_t MaxX;
+            int32_t MaxY;
+        };
+
+        struct DepthLevel
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            std::vector<float> Depth;
+        };
+
+        // Binning Job 하나의 결과. Tile마다 Triangle Index 목록을 가짐.
+        struct BinningResult
+        {
+            std::vector<ScreenTriangle> Triangles;
+            std::vector<std::vector<uint32_t>> TileBins;
+            uint32_t SkippedTriangleCount = 0;
+        };
+
+        void BinTriangles(uint32_t firstTriangle, uint32_t triangleCount, BinningResult& outResult) const;
+        void RasterizeTile(uint32_t tileIndex);
+        void BuildHierarchicalZ();
+
+    private:
+        Settings m_Settings;
+        uint32_t m_TileCountX = 0;
+        uint32_t m_TileCountY = 0;
+        DirectX::SimpleMath::Matrix m_ViewProjection;
+
+        std::vector<Occluder> m_Occluders;
+        uint32_t m_TriangleCount = 0;
+        std::vector<BinningResult> m_BinningResults;
+
+        // 0번은 Depth Buffer 자체이고, 다음 Level은 이전 Level 2x2 Texel의 최댓값(가장 먼 Depth)임.
+        // 크기가 홀수인 Level의 마지막 행과 열은 다음 Level에서 혼자 한 Texel이 되므로, 각 Level의 크기는 올림하여 반으로 줄임.
+        std::vector<DepthLevel> m_HierarchicalZ;
+        Stats m_Stats;
+    };
+}
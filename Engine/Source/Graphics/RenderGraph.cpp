@@ -0,0 +1,299 @@
+// RenderGraphTest가 Engine 없이 Build하므로 Precompiled Header를 쓰지 않음.
+#include "RenderGraph.h"
+
+#include <algorithm>
+#include <numeric>
+#include <spdlog/spdlog.h>
+
+#include "ResourceStateTracker.h"
+#include "Core/Assert.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // Signature에서 어떤 항목인지 구분하는 값.
+        enum class SignatureTag : uint64_t
+        {
+            ImportedTexture = 1,
+            Texture,
+            Pass,
+        };
+    }
+
+    void RenderGraph::Reset()
+    {
+        m_Resources.clear();
+        m_Passes.clear();
+        m_Accesses.clear();
+        m_Signature.clear();
+    }
+
+    RenderGraphResource RenderGraph::ImportTexture(ID3D12Resource* resource)
+    {
+        EG_CONFIRM(resource);
+        m_Resources.push_back({.Resource = resource, .bIsImported = true, .Desc = {}});
+        m_Signature.push_back(static_cast<uint64_t>(SignatureTag::ImportedTexture));
+        return {static_cast<uint32_t>(m_Resources.size() - 1)};
+    }
+
+    RenderGraphResource RenderGraph::CreateTexture(const RenderGraphTextureDesc& desc)
+    {
+        EG_CONFIRM(desc.Width > 0 && desc.Height > 0 &&
+                   (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0);
+        m_Resources.push_back({.Resource = nullptr, .bIsImported = false, .Desc = desc});
+        m_Signature.push_back(static_cast<uint64_t>(SignatureTag::Texture));
+        m_Signature.push_back(static_cast<uint64_t>(desc.Width) << 32 | desc.Height);
+        m_Signature.push_back(static_cast<uint64_t>(desc.Format) << 32 | static_cast<uint32_t>(desc.Flags));
+        return {static_cast<uint32_t>(m_Resources.size() - 1)};
+    }
+
+    void RenderGraph::AddPass(std::string_view name, std::span<const RenderGraphAccess> accesses, ExecuteFunction execute, bool bHasSideEffects)
+    {
+        PassNode& pass = m_Passes.emplace_back();
+        pass.Name = name;
+        pass.FirstAccess = static_cast<uint32_t>(m_Accesses.size());
+        pass.AccessCount = static_cast<uint32_t>(accesses.size());
+        pass.Execute = std::move(execute);
+        pass.bHasSideEffects = bHasSideEffects;
+
+        m_Signature.push_back(static_cast<uint64_t>(SignatureTag::Pass) | static_cast<uint64_t>(bHasSideEffects) << 8 | static_cast<uint64_t>(pass.AccessCount) << 16);
+        for (const RenderGraphAccess& access : accesses)
+        {
+            EG_CONFIRM(access.Resource.Index < m_Resources.size());
+            m_Accesses.push_back(access);
+            m_Signature.push_back(static_cast<uint64_t>(access.Resource.Index) << 33 | static_cast<uint64_t>(access.bIsWrite) << 32 | static_cast<uint32_t>(access.State));
+        }
+    }
+
+    void RenderGraph::Compile(const AllocationInfoFunction& getAllocationInfo)
+    {
+        m_Stats.PassCount = static_cast<uint32_t>(m_Passes.size());
+        if (m_CompileVersion > 0 && m_Signature == m_CompiledSignature)
+        {
+            m_Stats.bWasCached = true;
+            return;
+        }
+
+        m_Stats = {};
+        m_Stats.PassCount = static_cast<uint32_t>(m_Passes.size());
+        CullPasses();
+        ComputeLifetimes(getAllocationInfo);
+        PlaceTransientTextures();
+        m_CompiledSignature = m_Signature;
+        ++m_CompileVersion;
+    }
+
+    void RenderGraph::BindTexture(RenderGraphResource resource, ID3D12Resource* texture)
+    {
+        EG_CONFIRM(resource.Index < m_Resources.size() && !m_Resources[resource.Index].bIsImported);
+        m_Resources[resource.Index].Resource = texture;
+    }
+
+    void RenderGraph::Execute(const CommandListFunction& getCommandList, ResourceStateTracker& resourceStates)
+    {
+        for (uint32_t position = 0; position < m_ExecutionOrder.size(); ++position)
+        {
+            // 같은 자리를 쓰던 다른 Texture의 내용은 버려지므로, 처음 쓰는 Pass는 Clear 등으로 전체를 다시 써야 함.
+            for (const TransientTexture& texture : m_TransientTextures)
+            {
+                if (texture.bIsAliased && texture.FirstPass == position)
+                {
+                    resourceStates.Alias(m_Resources[texture.Resource.Index].Resource);
+                }
+            }
+
+            const PassNode& pass = m_Passes[m_ExecutionOrder[position]];
+            for (const RenderGraphAccess& access : GetPassAccesses(m_ExecutionOrder[position]))
+            {
+                ID3D12Resource* resource = m_Resources[access.Resource.Index].Resource;
+                EG_CONFIRM(resource);
+                resourceStates.Transition(resource, access.State);
+            }
+
+            ID3D12GraphicsCommandList* commandList = getCommandList();
+            const std::span<const D3D12_RESOURCE_BARRIER> barriers = resourceStates.Flush();
+            if (!barriers.empty())
+            {
+                commandList->ResourceBarrier(static_cast<uint32_t>(barriers.size()), barriers.data());
+            }
+            if (pass.Execute)
+            {
+                pass.Execute(commandList);
+            }
+        }
+    }
+
+    std::span<const RenderGraphAccess> RenderGraph::GetPassAccesses(uint32_t passIndex) const
+    {
+        const PassNode& pass = m_Passes[passIndex];
+        return std::span(m_Accesses).subspan(pass.FirstAccess, pass.AccessCount);
+    }
+
+    void RenderGraph::CullPasses()
+    {
+        const uint32_t passCount = static_cast<uint32_t>(m_Passes.size());
+        std::vector<uint8_t> bIsWritten(m_Resources.size(), 0);
+        for (uint32_t passIndex = 0; passIndex < passCount; ++passIndex)
+        {
+            for (const RenderGraphAccess& access : GetPassAccesses(passIndex))
+            {
+                if (!access.bIsWrite && !m_Resources[access.Resource.Index].bIsImported && !bIsWritten[access.Resource.Index])
+                {
+                    spdlog::error("RenderGraph: pass {} reads resource {} before any pass writes it", m_Passes[passIndex].Name, access.Resource.Index);
+                    EG_CONFIRM(false);
+                }
+            }
+            for (const RenderGraphAccess& access : GetPassAccesses(passIndex))
+            {
+                bIsWritten[access.Resource.Index] |= access.bIsWrite;
+            }
+        }
+
+        // 뒤에서부터 보며, 뒤의 살아 있는 Pass가 읽을 Resource에 쓰는 Pass만 살림.
+        // 살아 있는 Pass가 읽지 않고 쓰는 Transient Texture는 그 앞에서 쓴 내용이 필요 없음.
+        std::vector<uint8_t> bIsNeeded(m_Resources.size(), 0);
+        m_bIsPassCulled.assign(passCount, 1);
+        for (uint32_t passIndex = passCount; passIndex-- > 0;)
+        {
+            bool bIsAlive = m_Passes[passIndex].bHasSideEffects;
+            for (const RenderGraphAccess& access : GetPassAccesses(passIndex))
+            {
+                bIsAlive |= access.bIsWrite && (m_Resources[access.Resource.Index].bIsImported || bIsNeeded[access.Resource.Index]);
+            }
+            if (!bIsAlive)
+            {
+                continue;
+            }
+
+            m_bIsPassCulled[passIndex] = 0;
+            for (const RenderGraphAccess& access : GetPassAccesses(passIndex))
+            {
+                if (access.bIsWrite)
+                {
+                    bIsNeeded[access.Resource.Index] = 0;
+                }
+            }
+            for (const RenderGraphAccess& access : GetPassAccesses(passIndex))
+            {
+                if (!access.bIsWrite)
+                {
+                    bIsNeeded[access.Resource.Index] = 1;
+                }
+            }
+        }
+
+        m_ExecutionOrder.clear();
+        for (uint32_t passIndex = 0; passIndex < passCount; ++passIndex)
+        {
+            if (!m_bIsPassCulled[passIndex])
+            {
+                m_ExecutionOrder.push_back(passIndex);
+            }
+        }
+        m_Stats.CulledPassCount = passCount - static_cast<uint32_t>(m_ExecutionOrder.size());
+    }
+
+    void RenderGraph::ComputeLifetimes(const AllocationInfoFunction& getAllocationInfo)
+    {
+        m_TransientIndices.assign(m_Resources.size(), RenderGraphResource::InvalidIndex);
+        m_TransientTextures.clear();
+        for (uint32_t position = 0; position < m_ExecutionOrder.size(); ++position)
+        {
+            for (const RenderGraphAccess& access : GetPassAccesses(m_ExecutionOrder[position]))
+            {
+                const ResourceNode& resource = m_Resources[access.Resource.Index];
+                if (resource.bIsImported)
+                {
+                    continue;
+                }
+
+                uint32_t& transientIndex = m_TransientIndices[access.Resource.Index];
+                if (transientIndex == RenderGraphResource::InvalidIndex)
+                {
+                    // 처음 쓰는 Pass에서 이전 내용을 읽을 수 없음.
+                    EG_CONFIRM(access.bIsWrite);
+                    const RenderGraphAllocationInfo allocationInfo = getAllocationInfo(resource.Desc);
+                    EG_CONFIRM(allocationInfo.SizeInBytes > 0 && allocationInfo.Alignment > 0 && (allocationInfo.Alignment & (allocationInfo.Alignment - 1)) == 0);
+
+                    transientIndex = static_cast<uint32_t>(m_TransientTextures.size());
+                    TransientTexture& texture = m_TransientTextures.emplace_back();
+                    texture.Resource = access.Resource;
+                    texture.Desc = resource.Desc;
+                    texture.SizeInBytes = allocationInfo.SizeInBytes;
+                    texture.Alignment = allocationInfo.Alignment;
+                    texture.FirstPass = position;
+                }
+                m_TransientTextures[transientIndex].LastPass = position;
+            }
+        }
+    }
+
+    void RenderGraph::PlaceTransientTextures()
+    {
+        // 큰 Texture부터 놓아야 작은 Texture가 남은 틈에 들어가기 쉬움.
+        std::vector<uint32_t> placementOrder(m_TransientTextures.size());
+        std::iota(placementOrder.begin(), placementOrder.end(), 0);
+        std::ranges::sort(placementOrder, [this](uint32_t lhs, uint32_t rhs)
+        {
+            const TransientTexture& left = m_TransientTextures[lhs];
+            const TransientTexture& right = m_TransientTextures[rhs];
+            return left.SizeInBytes != right.SizeInBytes ? left.SizeInBytes > right.SizeInBytes : left.FirstPass < right.FirstPass;
+        });
+
+        const auto isLifetimeOverlapped = [](const TransientTexture& lhs, const TransientTexture& rhs)
+        {
+            return lhs.FirstPass <= rhs.LastPass && rhs.FirstPass <= lhs.LastPass;
+        };
+        const auto isMemoryOverlapped = [](uint64_t offset, uint64_t size, const TransientTexture& texture)
+        {
+            return offset < texture.HeapOffset + texture.SizeInBytes && texture.HeapOffset < offset + size;
+        };
+
+        std::vector<uint32_t> placedIndices;
+        std::vector<uint64_t> candidateOffsets;
+        for (const uint32_t index : placementOrder)
+        {
+            TransientTexture& texture = m_TransientTextures[index];
+            const uint64_t alignment = texture.Alignment;
+
+            // 수명이 겹치는 Texture와 Memory가 겹치지 않는 가장 낮은 자리. 후보는 0과 그런 Texture들의 끝임.
+            candidateOffsets.assign(1, 0);
+            for (const uint32_t placedIndex : placedIndices)
+            {
+                const TransientTexture& placed = m_TransientTextures[placedIndex];
+                if (isLifetimeOverlapped(texture, placed))
+                {
+                    candidateOffsets.push_back((placed.HeapOffset + placed.SizeInBytes + alignment - 1) & ~(alignment - 1));
+                }
+            }
+            std::ranges::sort(candidateOffsets);
+
+            for (const uint64_t offset : candidateOffsets)
+            {
+                const bool bIsFree = std::ranges::none_of(placedIndices, [&](uint32_t placedIndex)
+                {
+                    const TransientTexture& placed = m_TransientTextures[placedIndex];
+                    return isLifetimeOverlapped(texture, placed) && isMemoryOverlapped(offset, texture.SizeInBytes, placed);
+                });
+                if (bIsFree)
+                {
+                    texture.HeapOffset = offset;
+                    break;
+                }
+            }
+            placedIndices.push_back(index);
+            m_Stats.TransientSize += texture.SizeInBytes;
+            m_Stats.HeapSize = std::max(m_Stats.HeapSize, texture.HeapOffset + texture.SizeInBytes);
+        }
+
+        // 이번 Frame에서 앞의 Texture가 쓴 자리를 뒤의 Texture가 쓰고, 다음 Frame에서 다시 앞의 Texture가 쓰므로 양쪽 모두 표시함.
+        for (TransientTexture& texture : m_TransientTextures)
+        {
+            for (const TransientTexture& other : m_TransientTextures)
+            {
+                texture.bIsAliased |= &texture != &other && isMemoryOverlapped(texture.HeapOffset, texture.SizeInBytes, other);
+            }
+        }
+    }
+}
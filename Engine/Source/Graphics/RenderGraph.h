@@ -0,0 +1,163 @@
+#pragma once
+#include <cstdint>
+#include <d3d12.h>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Engine
+{
+    class ResourceStateTracker;
+
+    // Render Graph 안의 Resource. Index는 Reset한 뒤 만든 순서임.
+    struct RenderGraphResource
+    {
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+        uint32_t Index = InvalidIndex;
+
+        bool IsValid() const { return Index != InvalidIndex; }
+    };
+
+    // Graph가 만들고 해제하는 Texture. 지금은 Render Target과 Depth Stencil만 지원함.
+    struct RenderGraphTextureDesc
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        D3D12_RESOURCE_FLAGS Flags = D3D12_RESOURCE_FLAG_NONE;
+
+        bool operator==(const RenderGraphTextureDesc&) const = default;
+    };
+
+    // Heap에 Texture 하나를 놓을 때 필요한 크기와 정렬. Device의 GetResourceAllocationInfo로 구함.
+    struct RenderGraphAllocationInfo
+    {
+        uint64_t SizeInBytes = 0;
+        uint64_t Alignment = 0;
+    };
+
+    // Pass가 Resource를 어떤 State로 읽거나 쓰는지.
+    struct RenderGraphAccess
+    {
+        RenderGraphResource Resource;
+        D3D12_RESOURCE_STATES State = D3D12_RESOURCE_STATE_COMMON;
+        bool bIsWrite = false;
+    };
+
+    // Frame마다 Pass와 각 Pass가 읽고 쓰는 Resource를 선언하면, Compile에서 실행 순서와 수명을 정하고 Execute에서 Barrier와 함께 실행함.
+    //
+    // 1. 결과가 쓰이지 않는 Pass는 빼고 실행함. Import한 Resource에 쓰거나 bHasSideEffects인 Pass가 결과임.
+    // 2. Transient Texture는 처음 쓰는 Pass부터 마지막으로 쓰는 Pass까지만 살아 있으므로, 수명이 겹치지 않으면 Heap의 같은 자리에 놓음.
+    // 3. Pass와 Resource의 구조가 지난 Compile과 같으면 Compile 결과를 그대로 씀. Import한 Resource의 Pointer는 구조에 포함되지 않음.
+    //
+    // Compile은 Device 없이 실행되므로 가짜 AllocationInfo로 검사할 수 있음.
+    class RenderGraph
+    {
+    public:
+        using ExecuteFunction = std::function<void(ID3D12GraphicsCommandList*)>;
+        // Pass가 기록하는 도중 Command List를 나눌 수 있으므로 Pass마다 지금 기록 중인 Command List를 받아 옴.
+        using CommandListFunction = std::function<ID3D12GraphicsCommandList*()>;
+        using AllocationInfoFunction = std::function<RenderGraphAllocationInfo(const RenderGraphTextureDesc&)>;
+
+        // 실행되는 Pass가 쓰는 Transient Texture와 Heap 안의 위치. FirstPass와 LastPass는 실행 순서상의 위치임.
+        struct TransientTexture
+        {
+            RenderGraphResource Resource;
+            RenderGraphTextureDesc Desc;
+            uint64_t HeapOffset = 0;
+            uint64_t SizeInBytes = 0;
+            uint64_t Alignment = 0;
+            uint32_t FirstPass = 0;
+            uint32_t LastPass = 0;
+            // Heap에서 다른 Transient Texture와 겹치는 자리에 있어 처음 쓸 때 Aliasing Barrier가 필요함.
+            bool bIsAliased = false;
+        };
+
+        struct Stats
+        {
+            uint32_t PassCount = 0;
+            uint32_t CulledPassCount = 0;
+            // Aliasing하지 않았을 때의 크기와 실제 Heap 크기.
+            uint64_t TransientSize = 0;
+            uint64_t HeapSize = 0;
+            bool bWasCached = false;
+        };
+
+    public:
+        static RenderGraphAccess Read(RenderGraphResource resource, D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
+        {
+            return {resource, state, false};
+        }
+        static RenderGraphAccess Write(RenderGraphResource resource, D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_RENDER_TARGET)
+        {
+            return {resource, state, true};
+        }
+
+        // Frame을 시작할 때 호출함. Compile 결과는 남겨 두어 다음 Compile에서 재사용함.
+        void Reset();
+        // Graph 밖에서 만들고 State를 관리하는 Resource. Swap Chain Buffer처럼 Frame마다 Pointer가 바뀌어도 됨.
+        RenderGraphResource ImportTexture(ID3D12Resource* resource);
+        RenderGraphResource CreateTexture(const RenderGraphTextureDesc& desc);
+        // accesses는 선언 순서대로 Barrier를 만듦. 앞의 Pass가 쓴 Resource만 읽을 수 있음.
+        void AddPass(std::string_view name, std::span<const RenderGraphAccess> accesses, ExecuteFunction execute, bool bHasSideEffects = false);
+        void AddPass(std::string_view name, std::initializer_list<RenderGraphAccess> accesses, ExecuteFunction execute, bool bHasSideEffects = false)
+        {
+            AddPass(name, std::span(accesses.begin(), accesses.size()), std::move(execute), bHasSideEffects);
+        }
+
+        void Compile(const AllocationInfoFunction& getAllocationInfo);
+        // Compile 뒤에 Transient Texture마다 Heap에 놓은 Resource를 알려 줘야 Execute할 수 있음.
+        void BindTexture(RenderGraphResource resource, ID3D12Resource* texture);
+        // 실행하는 Pass마다 Transient Texture의 Aliasing과 선언한 State로의 Transition을 한 번에 기록한 뒤 Pass를 실행함.
+        void Execute(const CommandListFunction& getCommandList, ResourceStateTracker& resourceStates);
+
+        std::span<const TransientTexture> GetTransientTextures() const { return m_TransientTextures; }
+        // resource가 GetTransientTextures의 몇 번째인지. 실행되는 Pass가 쓰지 않으면 InvalidIndex임.
+        uint32_t GetTransientIndex(RenderGraphResource resource) const { return m_TransientIndices[resource.Index]; }
+        bool IsPassCulled(uint32_t passIndex) const { return m_bIsPassCulled[passIndex]; }
+        uint32_t GetPassCount() const { return static_cast<uint32_t>(m_Passes.size()); }
+        std::span<const RenderGraphAccess> GetPassAccesses(uint32_t passIndex) const;
+        // 실제로 Compile할 때마다 증가함. Transient Texture를 다시 만들어야 하는지 판단하는 데 사용함.
+        uint64_t GetCompileVersion() const { return m_CompileVersion; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        struct ResourceNode
+        {
+            ID3D12Resource* Resource = nullptr;
+            bool bIsImported = false;
+            RenderGraphTextureDesc Desc;
+        };
+
+        struct PassNode
+        {
+            std::string_view Name;
+            uint32_t FirstAccess = 0;
+            uint32_t AccessCount = 0;
+            ExecuteFunction Execute;
+            bool bHasSideEffects = false;
+        };
+
+        void CullPasses();
+        void ComputeLifetimes(const AllocationInfoFunction& getAllocationInfo);
+        void PlaceTransientTextures();
+
+    private:
+        std::vector<ResourceNode> m_Resources;
+        std::vector<PassNode> m_Passes;
+        std::vector<RenderGraphAccess> m_Accesses;
+        // Pass와 Resource의 구조를 나열한 값. 지난 Compile 때와 같으면 Compile을 건너뜀.
+        std::vector<uint64_t> m_Signature;
+        std::vector<uint64_t> m_CompiledSignature;
+
+        // Compile 결과
+        std::vector<uint8_t> m_bIsPassCulled;
+        std::vector<uint32_t> m_ExecutionOrder;
+        std::vector<uint32_t> m_TransientIndices;
+        std::vector<TransientTexture> m_TransientTextures;
+        uint64_t m_CompileVersion = 0;
+        Stats m_Stats;
+    };
+}
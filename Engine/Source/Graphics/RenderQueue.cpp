@@ -0,0 +1,123 @@
+#include "EnginePCH.h"
+#include "RenderQueue.h"
+
+#include "Engine.h"
+#include "Core/JobSystem.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // Job 하나가 세고 흩어 놓는 Packet 수. 이보다 적으면 Job 없이 바로 정렬함.
+        constexpr size_t RadixChunkSize = 16 * 1024;
+    }
+
+    uint64_t RenderQueue::MakeKey(Pass pass, uint32_t pipeline, uint32_t material, uint32_t mesh, uint32_t depthBucket)
+    {
+        EG_CONFIRM(static_cast<uint32_t>(pass) < (1u << PassBits) && pipeline < (1u << PipelineBits) && material < (1u << MaterialBits) &&
+                   mesh < (1u << MeshBits) && depthBucket < (1u << DepthBits));
+        return static_cast<uint64_t>(pass) << PassShift | static_cast<uint64_t>(pipeline) << PipelineShift |
+               static_cast<uint64_t>(material) << MaterialShift | static_cast<uint64_t>(mesh) << MeshShift | depthBucket;
+    }
+
+    uint32_t RenderQueue::QuantizeDepth(float viewDepth, float nearPlane, float farPlane)
+    {
+        // 가까운 곳일수록 정렬 순서가 중요하므로 Cluster의 깊이 Slice처럼 로그 간격으로 나눔.
+        const float normalizedDepth = std::log(std::max(viewDepth, nearPlane) / nearPlane) / std::log(farPlane / nearPlane);
+        constexpr float maximumBucket = static_cast<float>((1u << DepthBits) - 1);
+        return static_cast<uint32_t>(std::clamp(normalizedDepth, 0.0f, 1.0f) * maximumBucket);
+    }
+
+    void RenderQueue::Clear()
+    {
+        m_Packets.clear();
+        m_Stats = {};
+    }
+
+    void RenderQueue::Sort(JobSystem& jobSystem)
+    {
+        m_Stats.PacketCount = static_cast<uint32_t>(m_Packets.size());
+        m_Stats.RadixPassCount = 0;
+        if (m_Packets.size() <= 1)
+        {
+            return;
+        }
+
+        // 모든 Key에서 같은 Byte로 정렬하면 순서가 바뀌지 않음. Pipeline과 Material처럼 종류가 적은 자리는 대부분 건너뜀.
+        uint64_t differentBits = 0;
+        const uint64_t firstKey = m_Packets.front().Key;
+        for (const DrawPacket& packet : m_Packets)
+        {
+            differentBits |= packet.Key ^ firstKey;
+        }
+
+        m_SortBuffer.resize(m_Packets.size());
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            if ((differentBits >> shift & 0xFF) != 0)
+            {
+                RadixPass(jobSystem, shift);
+                ++m_Stats.RadixPassCount;
+            }
+        }
+    }
+
+    void RenderQueue::RadixPass(JobSystem& jobSystem, uint32_t shift)
+    {
+        const size_t count = m_Packets.size();
+        const size_t chunkCount = (count + RadixChunkSize - 1) / RadixChunkSize;
+        m_ChunkHistograms.resize(chunkCount);
+
+        const auto forEachChunk = [&](auto&& function)
+        {
+            if (chunkCount == 1)
+            {
+                function(0, count);
+                return;
+            }
+            JobSystem::Counter counter;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                jobSystem.Submit([&function, chunk, count]
+                {
+                    const size_t first = chunk * RadixChunkSize;
+                    function(chunk, std::min(first + RadixChunkSize, count));
+                }, &counter);
+            }
+            jobSystem.Wait(counter);
+        };
+
+        forEachChunk([&](size_t chunk, size_t last)
+        {
+            Histogram& histogram = m_ChunkHistograms[chunk];
+            histogram.fill(0);
+            for (size_t i = chunk * RadixChunkSize; i < last; ++i)
+            {
+                ++histogram[m_Packets[i].Key >> shift & 0xFF];
+            }
+        });
+
+        // Byte 값이 작은 것부터, 같은 값 안에서는 앞 Chunk부터 자리를 잡아야 안정 정렬이 됨.
+        uint32_t offset = 0;
+        for (uint32_t digit = 0; digit < 256; ++digit)
+        {
+            for (Histogram& histogram : m_ChunkHistograms)
+            {
+                const uint32_t digitCount = histogram[digit];
+                histogram[digit] = offset;
+                offset += digitCount;
+            }
+        }
+
+        forEachChunk([&](size_t chunk, size_t last)
+        {
+            Histogram& writeOffsets = m_ChunkHistograms[chunk];
+            for (size_t i = chunk * RadixChunkSize; i < last; ++i)
+            {
+                m_SortBuffer[writeOffsets[m_Packets[i].Key >> shift & 0xFF]++] = m_Packets[i];
+            }
+        });
+
+        m_Packets.swap(m_SortBuffer);
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Draw 하나. Payload는 Queue를 채운 쪽이 정한 Index이며, 정렬한 뒤 Draw에 필요한 정보를 찾는 데 사용함.
+    struct DrawPacket
+    {
+        uint64_t Key = 0;
+        uint32_t Payload = 0;
+    };
+
+    // 보이는 Mesh의 Draw를 모아 64-bit Key로 정렬한 뒤 순서대로 Submit하기 위한 Queue.
+    // Key는 상위 Bit부터 Pass, Pipeline, Material, Mesh, Depth 순서로 채우므로, 정렬하면 바꾸는 비용이 큰 State끼리 모임.
+    // 정렬은 8-bit씩 나눈 LSD Radix Sort이며 안정 정렬임. 모든 Key에서 같은 자리의 Byte는 건너뜀.
+    class RenderQueue
+    {
+    public:
+        static constexpr uint32_t DepthBits = 16;
+        static constexpr uint32_t MeshBits = 20;
+        static constexpr uint32_t MaterialBits = 16;
+        static constexpr uint32_t PipelineBits = 8;
+        static constexpr uint32_t PassBits = 4;
+        static_assert(DepthBits + MeshBits + MaterialBits + PipelineBits + PassBits == 64);
+
+        static constexpr uint32_t MeshShift = DepthBits;
+        static constexpr uint32_t MaterialShift = MeshShift + MeshBits;
+        static constexpr uint32_t PipelineShift = MaterialShift + MaterialBits;
+        static constexpr uint32_t PassShift = PipelineShift + PipelineBits;
+
+        enum class Pass : uint32_t
+        {
+            Opaque,
+        };
+
+        struct Stats
+        {
+            uint32_t PacketCount = 0;
+            // 8번 중 실제로 실행한 Radix Pass 수.
+            uint32_t RadixPassCount = 0;
+        };
+
+    public:
+        // 각 값은 자기 Bit 수를 넘으면 안 됨. Mesh는 AssetHandle의 Index를 사용하므로 20-bit임.
+        static uint64_t MakeKey(Pass pass, uint32_t pipeline, uint32_t material, uint32_t mesh, uint32_t depthBucket);
+        // View 공간의 깊이를 [nearPlane, farPlane]에서 로그 간격으로 나눈 Bucket. 가까울수록 작음.
+        static uint32_t QuantizeDepth(float viewDepth, float nearPlane, float farPlane);
+
+        static uint32_t GetPipeline(uint64_t key) { return static_cast<uint32_t>(key >> PipelineShift) & ((1u << PipelineBits) - 1); }
+        static uint32_t GetMaterial(uint64_t key) { return static_cast<uint32_t>(key >> MaterialShift) & ((1u << MaterialBits) - 1); }
+        static uint32_t GetMesh(uint64_t key) { return static_cast<uint32_t>(key >> MeshShift) & ((1u << MeshBits) - 1); }
+        // Depth를 뺀 Key. 정렬 뒤 이 값이 같은 연속된 Packet은 같은 State로 그리므로 Instancing할 수 있음.
+        static uint64_t GetStateKey(uint64_t key) { return key >> MeshShift; }
+
+        void Clear();
+        void Push(uint64_t key, uint32_t payload) { m_Packets.push_back({key, payload}); }
+        // Key 순서로 정렬함. Key가 같으면 Push한 순서를 유지함.
+        void Sort(JobSystem& jobSystem);
+
+        std::span<const DrawPacket> GetPackets() const { return m_Packets; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        using Histogram = std::array<uint32_t, 256>;
+
+        // m_Packets의 shift 자리 Byte로 m_SortBuffer에 안정적으로 흩어 놓은 뒤 두 배열을 바꿈.
+        void RadixPass(JobSystem& jobSystem, uint32_t shift);
+
+    private:
+        std::vector<DrawPacket> m_Packets;
+        std::vector<DrawPacket> m_SortBuffer;
+        // Chunk마다 Byte 값별 개수를 세고, 그것을 Chunk가 쓰기 시작할 위치로 바꿈.
+        std::vector<Histogram> m_ChunkHistograms;
+        Stats m_Stats;
+    };
+}
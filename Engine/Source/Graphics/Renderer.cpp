@@ -1,21 +1,46 @@
 #include "EnginePCH.h"
 #include "Renderer.h"
 
+#include "AssetLoadProfiler.h"
 #include "AssetManager.h"
 #include "d3dx12.h"
 #include "Engine.h"
 #include "GraphicsHelper.h"
 #include "Mesh.h"
 #include "Shader.h"
+#include "Texture.h"
 #include "Core/Core.h"
 #include "ECS/Components.h"
 #include "ECS/Entity.h"
+#include "ECS/SceneSnapshot.h"
 
 
 namespace Engine
 {
     struct TransformComponent;
 
+    namespace
+    {
+        constexpr std::string_view SceneCameraName = "SceneCamera";
+        // 진행 중인 모든 Frame의 Constant와 Instance Data를 담을 만큼 크게 잡음. 넘치는 할당은 따로 만든 Buffer를 사용함.
+        constexpr uint64_t UploadRingCapacity = 64 * 1024 * 1024;
+        // Texture와 Material 수천 개를 넣을 수 있게 잡음. Transient는 진행 중인 모든 Frame의 Descriptor Table을 담을 만큼임.
+        constexpr uint32_t PersistentDescriptorCount = 16 * 1024;
+        constexpr uint32_t TransientDescriptorCount = 16 * 1024;
+        constexpr uint32_t RenderTargetDescriptorCount = 64;
+        constexpr uint32_t DepthStencilDescriptorCount = 16;
+        // 큰 Mesh 몇 개가 한 Page에 들어가는 크기. Batch가 이만큼 쌓이면 Frame 끝을 기다리지 않고 바로 Copy Queue에 보냄.
+        constexpr uint64_t UploadPageSize = 4 * 1024 * 1024;
+        constexpr uint64_t MaxUploadBatchSize = 32 * 1024 * 1024;
+        // Command List 하나를 열고 State를 다시 설정하는 비용보다 기록할 Draw가 충분히 많을 때만 나눔.
+        constexpr uint32_t MinimumDrawGroupsPerCommandList = 256;
+
+        CD3DX12_RESOURCE_DESC GetTransientTextureResourceDesc(const RenderGraphTextureDesc& desc)
+        {
+            return CD3DX12_RESOURCE_DESC::Tex2D(desc.Format, desc.Width, desc.Height, 1, 1, 1, 0, desc.Flags);
+        }
+    }
+
     void Renderer::Initialize(HWND windowHandle, uint32_t width, uint32_t height)
     {
         m_Width = width;
@@ -25,60 +50,82 @@ namespace Engine
         m_ScissorRect = CD3DX12_RECT(0, 0, static_cast<int32_t>(m_Width), static_cast<int32_t>(m_Height));
         m_FieldOfView = DirectX::XMConvertToRadians(60.0f);
         InitDirectX(windowHandle);
+        m_Scene = std::make_unique<Scene>();
         Prepare();
+
+        AssetLoadProfiler::LogSummary();
+        AssetLoadProfiler::WriteChromeTrace("StartupTrace.json");
+        AssetManager::LogDeduplicationReport("Default");
     }
 
     void Renderer::InitDirectX(HWND windowHandle)
     {
         CreateCommandQueue(D3D12_COMMAND_LIST_TYPE_DIRECT, m_DirectCommandQueue);
-        CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, m_DirectCommandAllocator);
-        CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, m_DirectCommandList);
+        m_Frames.resize(m_FrameCount);
 
         CreateCommandQueue(D3D12_COMMAND_LIST_TYPE_COPY, m_CopyCommandQueue);
-        CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, m_CopyCommandAllocator);
-        CreateCommandList(D3D12_COMMAND_LIST_TYPE_COPY, m_CopyCommandList);
+        m_UploadManager.Initialize(m_CopyCommandQueue, UploadPageSize, MaxUploadBatchSize);
 
-        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, 10, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]);
-        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, 1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER]);
-        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_RTV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, 4, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]);
-        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_DSV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, 1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV]);
+        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, PersistentDescriptorCount, TransientDescriptorCount, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]);
+        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, 1, 0, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER]);
+        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_RTV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, RenderTargetDescriptorCount, 0, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]);
+        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_DSV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, DepthStencilDescriptorCount, 0, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV]);
+        CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, PersistentDescriptorCount, 0, m_StagingDescriptorHeap);
 
         CreateSwapChain(m_Width, m_Height, windowHandle);
         CreateRenderTarget(m_Width, m_Height);
-        CreateSceneTextures(m_Width, m_Height);
+        // Editor의 Viewport가 ImGui로 그리므로 Shader Visible Heap에 Slot마다 자리를 둠.
+        for (uint32_t i = 0; i < m_FrameCount; ++i)
+        {
+            m_SceneColorSRVs.push_back(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].Allocate());
+        }
         CreateFence();
+        CreateUploadRing();
     }
 
 
     void Renderer::Prepare()
     {
-        CD3DX12_ROOT_PARAMETER rootParameters[3];
-        // MVP Matrix
-        rootParameters[0].InitAsConstants(48, 0, 0, D3D12_SHADER_VISIBILITY_VERTEX);
-        // Light
-        rootParameters[1].InitAsConstants(12, 1, 0, D3D12_SHADER_VISIBILITY_PIXEL);
+        CD3DX12_ROOT_PARAMETER rootParameters[7];
+        // View-Projection Matrix와 Draw의 첫 Instance 위치
+        rootParameters[0].InitAsConstants(17, 0, 0, D3D12_SHADER_VISIBILITY_VERTEX);
+        // Light. Root Signature는 64 DWORD까지이므로 Constant 대신 Upload Buffer를 가리킴.
+        rootParameters[1].InitAsConstantBufferView(1, 0, D3D12_SHADER_VISIBILITY_PIXEL);
         // Texture
         CD3DX12_DESCRIPTOR_RANGE descriptorRange{D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0};
         rootParameters[2].InitAsDescriptorTable(1, &descriptorRange, D3D12_SHADER_VISIBILITY_PIXEL);
+        // Lights, Clusters, LightIndices
+        rootParameters[3].InitAsShaderResourceView(1, 0, D3D12_SHADER_VISIBILITY_PIXEL);
+        rootParameters[4].InitAsShaderResourceView(2, 0, D3D12_SHADER_VISIBILITY_PIXEL);
+        rootParameters[5].InitAsShaderResourceView(3, 0, D3D12_SHADER_VISIBILITY_PIXEL);
+        // Instance마다의 World Matrix
+        rootParameters[6].InitAsShaderResourceView(4, 0, D3D12_SHADER_VISIBILITY_VERTEX);
         CreateRootSignature(_countof(rootParameters), rootParameters, m_RootSignature);
 
 
         CreatePipelineState();
         LoadAssets();
 
+        entt::registry& registry = m_Scene->GetRegistry();
+        registry.on_destroy<MeshRenderComponent>().connect<&Renderer::ReleaseMeshRenderComponent>(*this);
+
+        m_Scene->RegisterSystem("LightSystem", SystemAccess{}.Read<TransformComponent>().Write<LightComponent>(), [](entt::registry& registry, float deltaSeconds)
         {
-            m_CameraEntity = m_Registry.create();
-            auto& displayName = m_Registry.emplace<DisplayNameComponent>(m_CameraEntity);
-            auto& transform = m_Registry.emplace<TransformComponent>(m_CameraEntity);
-            displayName.Name = "SceneCamera";
-        }
+            for (const auto [entity, transform, light] : registry.view<const TransformComponent, LightComponent>().each())
+            {
+                const DirectX::SimpleMath::Quaternion q = DirectX::SimpleMath::Quaternion::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(transform.Rotation.y), DirectX::XMConvertToRadians(transform.Rotation.x), DirectX::XMConvertToRadians(transform.Rotation.z));
+                light.Direction = DirectX::SimpleMath::Vector3::Transform(DirectX::SimpleMath::Vector3::UnitZ, q);
+            }
+        });
+
+        CreateSceneCamera();
 
 
         {
-            const auto lightEntity = m_Registry.create();
-            auto& displayName = m_Registry.emplace<DisplayNameComponent>(lightEntity);
-            auto& transform = m_Registry.emplace<TransformComponent>(lightEntity);
-            auto& light = m_Registry.emplace<LightComponent>(lightEntity);
+            const auto lightEntity = registry.create();
+            auto& displayName = registry.emplace<DisplayNameComponent>(lightEntity);
+            auto& transform = registry.emplace<TransformComponent>(lightEntity);
+            auto& light = registry.emplace<LightComponent>(lightEntity);
 
             displayName.Name = "Light";
             transform.Rotation = DirectX::SimpleMath::Vector3{0.0f, 0.0f, 0.0f};
@@ -86,155 +133,708 @@ namespace Engine
         }
 
         {
-            const auto meshEntity = m_Registry.create();
-            auto& displayName = m_Registry.emplace<DisplayNameComponent>(meshEntity);
-            auto& meshRenderComponent = m_Registry.emplace<MeshRenderComponent>(meshEntity);
+            // Transform이 없으므로 BVH와 Culling에서 빠지고, Editor Gizmo가 조작하는 m_Model로 그려짐.
+            const auto meshEntity = registry.create();
+            auto& displayName = registry.emplace<DisplayNameComponent>(meshEntity);
+            auto& meshRenderComponent = registry.emplace<MeshRenderComponent>(meshEntity);
             displayName.Name = "Mesh";
 
             using namespace entt::literals;
-            meshRenderComponent.Mesh = AssetManager::LoadMesh("teapot"_hs, "Content/teapot.obj");
+            meshRenderComponent.Mesh = AssetManager::AcquireMesh("teapot"_hs, "Content/teapot.obj");
         }
+        UploadMissingMeshes();
     }
 
-    void Renderer::Render()
+    void Renderer::CreateSceneCamera()
     {
-        const uint32_t currentBackBufferIndex = m_SwapChain->GetCurrentBackBufferIndex();
+        entt::registry& registry = m_Scene->GetRegistry();
+        m_CameraEntity = registry.create();
+        auto& displayName = registry.emplace<DisplayNameComponent>(m_CameraEntity);
+        registry.emplace<TransformComponent>(m_CameraEntity);
+        displayName.Name = SceneCameraName;
+    }
 
+    bool Renderer::SaveScene(const std::filesystem::path& filePath) const
+    {
+        return SceneSnapshot::Save(*m_Scene, filePath);
+    }
 
-        m_DirectCommandAllocator->Reset();
-        m_DirectCommandList->Reset(m_DirectCommandAllocator.Get(), nullptr);
-        m_DirectCommandList->RSSetViewports(1, &m_Viewport);
-        m_DirectCommandList->RSSetScissorRects(1, &m_ScissorRect);
+    bool Renderer::LoadScene(const std::filesystem::path& filePath)
+    {
+        // 이전 Scene의 Mesh를 GPU가 아직 사용하고 있을 수 있음.
+        WaitForGPU();
+        if (!SceneSnapshot::Load(*m_Scene, filePath))
+        {
+            return false;
+        }
+        // 새 Scene에는 이전 Cell의 Entity가 없으므로 Streaming을 멈춤.
+        m_WorldPartition.reset();
+        UploadMissingMeshes();
+
+        // Camera는 이름으로 찾고, 저장된 Camera가 없다면 새로 만듦.
+        entt::registry& registry = m_Scene->GetRegistry();
+        m_CameraEntity = entt::null;
+        for (const auto [entity, displayName] : registry.view<DisplayNameComponent>().each())
+        {
+            if (displayName.Name == SceneCameraName && registry.all_of<TransformComponent>(entity))
+            {
+                m_CameraEntity = entity;
+                break;
+            }
+        }
+        if (m_CameraEntity == entt::null)
+        {
+            CreateSceneCamera();
+        }
+        return true;
+    }
 
+    void Renderer::ReleaseMeshRenderComponent(entt::registry& registry, entt::entity entity)
+    {
+        const auto& meshRenderComponent = registry.get<MeshRenderComponent>(entity);
+        if (!meshRenderComponent.Mesh)
+        {
+            return;
+        }
 
-        m_DirectCommandList->SetPipelineState(m_PipelineState.Get());
-        m_DirectCommandList->SetGraphicsRootSignature(m_RootSignature.Get());
+        // 마지막 참조라면 Mesh와 함께 GPU Buffer도 해제되지만, 아직 끝나지 않은 Frame이 그 Buffer로 그리고 있을 수 있음.
+        const Mesh& mesh = AssetManager::GetPool<Mesh>().Get(meshRenderComponent.Mesh);
+        // 같은 Cell의 Entity는 대개 같은 Mesh를 쓰므로 바로 앞과 같은 Buffer는 다시 넣지 않음.
+        if (mesh.VertexBuffer && (m_PendingReleases.empty() || m_PendingReleases.back().Resource != mesh.IndexBuffer))
+        {
+            DeferRelease(mesh.VertexBuffer);
+            DeferRelease(mesh.IndexBuffer);
+        }
+        AssetManager::Release(meshRenderComponent.Mesh);
+    }
 
-        static float angle = 0.0f;
-        angle += 0.05f;
+    void Renderer::UploadMissingMeshes()
+    {
+        // 처음 불러온 Mesh는 아직 GPU Buffer가 없음.
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        for (const auto [entity, meshRender] : m_Scene->GetRegistry().view<MeshRenderComponent>().each())
+        {
+            Mesh& mesh = meshPool.Get(meshRender.Mesh);
+            if (!mesh.VertexBuffer)
+            {
+                mesh.UploadFenceValue = CreateVertexAndIndexBufferView(mesh.Vertices, mesh.Indices, mesh.VertexBuffer, mesh.IndexBuffer, mesh.VertexBufferView, mesh.IndexBufferView);
+            }
+        }
+        // 모은 Upload를 바로 보내 다음 Frame을 기록하는 동안 Copy Queue가 복사하게 함.
+        m_UploadManager.Submit();
+    }
 
+    void Renderer::ReloadMesh(const entt::id_type id, std::string_view filePath)
+    {
+        const entt::resource<Mesh> previousMesh = AssetManager::Find<Mesh>(id);
+        entt::resource<Mesh> mesh = AssetManager::ReloadMesh(id, filePath);
+        if (!mesh)
+        {
+            return;
+        }
 
-        DirectX::SimpleMath::Matrix modelScale = DirectX::SimpleMath::Matrix::CreateScale(1.0f);
-        DirectX::SimpleMath::Matrix modelRotation = DirectX::SimpleMath::Matrix::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(angle), 0.0f, 0.0f);
-        DirectX::SimpleMath::Matrix modelTranslation = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 0.0f, 0.0f);
-        m_Model = modelScale * modelRotation * modelTranslation;
+        // 같은 내용의 Mesh가 이미 Upload되었다면 그 Buffer를 그대로 사용함.
+        if (!mesh->VertexBuffer)
+        {
+            AssetLoadProfiler::AssetScope assetScope(filePath);
+            mesh->UploadFenceValue = CreateVertexAndIndexBufferView(mesh->Vertices, mesh->Indices, mesh->VertexBuffer, mesh->IndexBuffer, mesh->VertexBufferView, mesh->IndexBufferView);
+            m_UploadManager.Submit();
+        }
 
-        //m_Model = DirectX::SimpleMath::Matrix::CreateBillboard(m_Model.Translation(), m_CameraTransform.Translation(), m_CameraTransform.Up());
+        // Rebind로 이전 Mesh가 해제되더라도, 아직 끝나지 않은 Frame이 그 Buffer로 그리고 있을 수 있음.
+        if (previousMesh && previousMesh->VertexBuffer && previousMesh->VertexBuffer != mesh->VertexBuffer)
+        {
+            DeferRelease(previousMesh->VertexBuffer);
+            DeferRelease(previousMesh->IndexBuffer);
+        }
+        AssetManager::GetPool<Mesh>().Rebind(id, std::move(mesh));
+    }
 
+    void Renderer::ReloadTexture(const entt::id_type id, std::string_view filePath)
+    {
+        const entt::resource<Texture> previousTexture = AssetManager::Find<Texture>(id);
+        entt::resource<Texture> texture = AssetManager::ReloadTexture(id, filePath);
+        if (!texture)
+        {
+            return;
+        }
 
-        const auto& cameraTransform = m_Registry.get<TransformComponent>(m_CameraEntity);
-        DirectX::SimpleMath::Matrix cameraScale = DirectX::SimpleMath::Matrix::CreateScale(1.0f);
-        DirectX::SimpleMath::Matrix cameraRotation = DirectX::SimpleMath::Matrix::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(cameraTransform.Rotation.y), DirectX::XMConvertToRadians(cameraTransform.Rotation.x), DirectX::XMConvertToRadians(cameraTransform.Rotation.z));
-        DirectX::SimpleMath::Matrix cameraTranslation = DirectX::SimpleMath::Matrix::CreateTranslation(cameraTransform.Position);
-        m_CameraTransform = cameraScale * cameraRotation * cameraTranslation;
+        if (!texture->Resource)
+        {
+            AssetLoadProfiler::AssetScope assetScope(filePath);
+            texture->UploadFenceValue = GraphicsHelper::CreateTextureResource(texture, m_UploadManager, m_ResourceStates, texture->Resource);
+            m_UploadManager.Submit();
+        }
 
+        if (previousTexture && previousTexture->Resource && previousTexture->Resource != texture->Resource)
+        {
+            // Staging Descriptor는 기록할 때 Transient Table로 복사하므로, 진행 중인 Frame에 영향 없이 바로 고쳐 써도 됨.
+            if (previousTexture->Resource == m_Texture)
+            {
+                m_Texture = texture->Resource;
+                m_TextureUploadFenceValue = texture->UploadFenceValue;
+                CreateTextureView();
+            }
+            DeferRelease(previousTexture->Resource);
+        }
+        AssetManager::GetPool<Texture>().Rebind(id, std::move(texture));
+    }
 
-        constexpr float nearPlane = 0.1f;
-        constexpr float farPlane = 1000.0f;
-        m_Projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(m_FieldOfView, m_AspectRatio, nearPlane, farPlane);
-        DirectX::SimpleMath::Matrix viewProjection = m_CameraTransform.Invert() * m_Projection;
+    bool Renderer::BuildWorldPartition(const std::filesystem::path& directory)
+    {
+        const WorldPartition::Settings settings{};
+        std::vector<entt::entity> partitionedEntities;
+        m_WorldPartition.reset();
+        if (!WorldPartition::Build(*m_Scene, directory, settings.CellSize, {m_CameraEntity}, partitionedEntities))
+        {
+            return false;
+        }
+
+        // Cell에 저장된 Entity는 Streaming으로 다시 올라옴.
+        WaitForGPU();
+        m_Scene->DestroyEntities(partitionedEntities);
+        m_WorldPartition = std::make_unique<WorldPartition>(*m_Scene, Core::GetJobSystem(), directory, settings);
+        return true;
+    }
+
+    void Renderer::UpdateWorldPartition()
+    {
+        if (!m_WorldPartition)
+        {
+            return;
+        }
 
+        const entt::registry& registry = m_Scene->GetRegistry();
+        m_WorldPartition->Update(registry.get<TransformComponent>(m_CameraEntity).Position);
+        if (m_WorldPartition->GetStats().ActivatedCellCount > 0)
+        {
+            UploadMissingMeshes();
+        }
+    }
 
-        struct TransformData
+    void Renderer::CullMeshes(const DirectX::SimpleMath::Matrix& viewProjection)
+    {
+        const entt::registry& registry = m_Scene->GetRegistry();
+        const SceneBVH& bvh = m_Scene->GetBVH();
+
+        m_CullingEntities.clear();
+        m_VisibleEntities.clear();
+        for (const entt::entity entity : registry.view<MeshRenderComponent>())
+        {
+            // BVH에 없는 Mesh는 Editor Gizmo가 조작하는 m_Model로 그리므로 검사하지 않음.
+            if (bvh.GetBounds(entity))
+            {
+                m_CullingEntities.push_back(entity);
+            }
+            else
+            {
+                m_VisibleEntities.push_back(entity);
+            }
+        }
+
+        // BVH의 Leaf는 이미 World AABB를 가지고 있으므로 Mesh Bounds를 다시 변환하지 않음.
+        m_CullingBounds.Resize(m_CullingEntities.size());
+        for (size_t i = 0; i < m_CullingEntities.size(); ++i)
+        {
+            m_CullingBounds.Set(i, bvh.GetBounds(m_CullingEntities[i])->ToBoundingBox());
+        }
+
+        JobSystem& jobSystem = Core::GetJobSystem();
+        FrustumCulling::CullParallel(jobSystem, FrustumCulling::ExtractPlanes(viewProjection), m_CullingBounds, m_VisibleIndices);
+
+        // Frustum 안의 Occluder만 그리고, 나머지는 Occluder에 가려졌는지 검사함.
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        m_OcclusionBuffer.Begin(viewProjection);
+        m_OccludeeIndices.clear();
+        for (const uint32_t index : m_VisibleIndices)
+        {
+            const entt::entity entity = m_CullingEntities[index];
+            if (!registry.all_of<OccluderComponent>(entity))
+            {
+                m_OccludeeIndices.push_back(index);
+                continue;
+            }
+
+            const Mesh& mesh = meshPool.Get(registry.get<MeshRenderComponent>(entity).Mesh);
+            m_OcclusionBuffer.AddOccluder(registry.get<WorldTransformComponent>(entity).World, mesh.Vertices, mesh.Indices);
+            m_VisibleEntities.push_back(entity);
+        }
+
+        // Occluder가 하나도 없다면 가려지는 것도 없음.
+        if (m_OccludeeIndices.size() < m_VisibleIndices.size())
+        {
+            m_OcclusionBuffer.Rasterize(jobSystem);
+            m_OcclusionBuffer.FilterVisible(jobSystem, m_CullingBounds, m_OccludeeIndices, m_OccludeeIndices);
+        }
+        for (const uint32_t index : m_OccludeeIndices)
         {
-            DirectX::SimpleMath::Matrix MatGeo;
-            DirectX::SimpleMath::Matrix MatGeoInvert;
-            DirectX::SimpleMath::Matrix MatVP;
-        } transformData;
+            m_VisibleEntities.push_back(m_CullingEntities[index]);
+        }
+    }
 
-        transformData.MatGeo = m_Model.Transpose();
-        transformData.MatGeoInvert = m_Model.Invert().Transpose();
-        transformData.MatVP = viewProjection.Transpose();
+    void Renderer::UpdateLights(const DirectX::SimpleMath::Matrix& view, float nearPlane, float farPlane)
+    {
+        const entt::registry& registry = m_Scene->GetRegistry();
+        m_ShaderLights.clear();
+        for (const auto [entity, light] : registry.view<LightComponent>().each())
+        {
+            ShaderLight& shaderLight = m_ShaderLights.emplace_back();
+            if (const auto* worldTransform = registry.try_get<WorldTransformComponent>(entity))
+            {
+                shaderLight.Position = worldTransform->World.Translation();
+            }
+            shaderLight.Range = light.Range;
+            shaderLight.Color = DirectX::SimpleMath::Vector3(light.LightColor.x, light.LightColor.y, light.LightColor.z) * light.Intensity;
+            shaderLight.Type = light.Type;
+            shaderLight.Direction = light.Direction;
+            shaderLight.CosOuterCone = std::cos(DirectX::XMConvertToRadians(light.OuterConeAngle));
+            shaderLight.CosInnerCone = std::cos(DirectX::XMConvertToRadians(std::min(light.InnerConeAngle, light.OuterConeAngle)));
+        }
 
-        m_DirectCommandList->SetGraphicsRoot32BitConstants(0, 48, &transformData, 0);
+        // Shader는 앞쪽의 Directional Light를 모든 Pixel에 적용하고, 나머지는 Cluster의 목록으로만 찾음.
+        const auto firstLocalLight = std::stable_partition(m_ShaderLights.begin(), m_ShaderLights.end(), [](const ShaderLight& light)
+        {
+            return light.Type == LightType::Directional;
+        });
+        m_LightClusterGrid.Build(Core::GetJobSystem(), view, m_Projection, nearPlane, farPlane, m_ShaderLights);
 
         struct LightData
         {
-            DirectX::SimpleMath::Vector4 LightDirection;
-            DirectX::SimpleMath::Color LightColor;
             DirectX::SimpleMath::Vector4 CameraPosition;
+            DirectX::SimpleMath::Vector2 ClusterTileSize;
+            float DepthSliceScale;
+            float DepthSliceBias;
+            float NearPlane;
+            float FarPlane;
+            uint32_t DirectionalLightCount;
+            uint32_t Padding;
+            uint32_t ClusterCount[3];
         } lightData;
 
-        auto lightSystem = m_Registry.view<TransformComponent, LightComponent>();
-        for (const auto [entity, transform, light] : lightSystem.each())
+        const LightClusterGrid::Settings& clusterSettings = m_LightClusterGrid.GetSettings();
+        const DirectX::SimpleMath::Vector3 cameraPosition = m_CameraTransform.Translation();
+        lightData.CameraPosition = DirectX::SimpleMath::Vector4(cameraPosition.x, cameraPosition.y, cameraPosition.z, 1.0f);
+        lightData.ClusterTileSize = {m_Viewport.Width / static_cast<float>(clusterSettings.ClusterCountX), m_Viewport.Height / static_cast<float>(clusterSettings.ClusterCountY)};
+        lightData.DepthSliceScale = m_LightClusterGrid.GetDepthSliceScale();
+        lightData.DepthSliceBias = m_LightClusterGrid.GetDepthSliceBias();
+        lightData.NearPlane = nearPlane;
+        lightData.FarPlane = farPlane;
+        lightData.DirectionalLightCount = static_cast<uint32_t>(firstLocalLight - m_ShaderLights.begin());
+        lightData.Padding = 0;
+        lightData.ClusterCount[0] = clusterSettings.ClusterCountX;
+        lightData.ClusterCount[1] = clusterSettings.ClusterCountY;
+        lightData.ClusterCount[2] = clusterSettings.ClusterCountZ;
+
+        // 한 Buffer에 모두 기록하고 Root Descriptor로 각 구간을 가리킴. Root CBV는 256 Byte 정렬이 필요함.
+        const auto align = [](uint64_t offset) { return (offset + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~static_cast<uint64_t>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1); };
+        const std::vector<LightClusterGrid::ClusterRange>& clusters = m_LightClusterGrid.GetClusters();
+        const std::vector<uint32_t>& lightIndices = m_LightClusterGrid.GetLightIndices();
+        const uint64_t lightsOffset = align(sizeof(LightData));
+        const uint64_t clustersOffset = align(lightsOffset + m_ShaderLights.size() * sizeof(ShaderLight));
+        const uint64_t lightIndicesOffset = align(clustersOffset + clusters.size() * sizeof(LightClusterGrid::ClusterRange));
+        const UploadAllocation allocation = AllocateUpload(lightIndicesOffset + std::max<size_t>(lightIndices.size(), 1) * sizeof(uint32_t));
+
+        std::memcpy(allocation.CPUAddress, &lightData, sizeof(LightData));
+        std::memcpy(allocation.CPUAddress + lightsOffset, m_ShaderLights.data(), m_ShaderLights.size() * sizeof(ShaderLight));
+        std::memcpy(allocation.CPUAddress + clustersOffset, clusters.data(), clusters.size() * sizeof(LightClusterGrid::ClusterRange));
+        std::memcpy(allocation.CPUAddress + lightIndicesOffset, lightIndices.data(), lightIndices.size() * sizeof(uint32_t));
+
+        const D3D12_GPU_VIRTUAL_ADDRESS bufferAddress = allocation.GPUAddress;
+        m_SceneRootArguments.LightData = bufferAddress;
+        m_SceneRootArguments.Lights = bufferAddress + lightsOffset;
+        m_SceneRootArguments.Clusters = bufferAddress + clustersOffset;
+        m_SceneRootArguments.LightIndices = bufferAddress + lightIndicesOffset;
+    }
+
+    const DirectX::SimpleMath::Matrix& Renderer::GetDrawWorldTransform(entt::entity entity) const
+    {
+        // Transform이 없는 Mesh는 Editor Gizmo가 조작하는 m_Model을 사용함.
+        const auto* worldTransform = m_Scene->GetRegistry().try_get<WorldTransformComponent>(entity);
+        return worldTransform ? worldTransform->World : m_Model;
+    }
+
+    void Renderer::UploadInstances()
+    {
+        // 정렬된 Packet 순서대로 쓰므로 같은 State의 Instance는 Buffer에서도 연속으로 놓임. 마지막 하나는 Billboard용임.
+        const std::span<const DrawPacket> packets = m_RenderQueue.GetPackets();
+        const UploadAllocation allocation = AllocateUpload((packets.size() + 1) * sizeof(InstanceData));
+        auto* instances = reinterpret_cast<InstanceData*>(allocation.CPUAddress);
+        for (size_t i = 0; i < packets.size(); ++i)
         {
-            DirectX::SimpleMath::Quaternion q = DirectX::SimpleMath::Quaternion::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(transform.Rotation.y), DirectX::XMConvertToRadians(transform.Rotation.x), DirectX::XMConvertToRadians(transform.Rotation.z));
-            DirectX::SimpleMath::Vector3 direction = DirectX::SimpleMath::Vector3::Transform(DirectX::SimpleMath::Vector3::UnitZ, q);
-            lightData.LightDirection = DirectX::SimpleMath::Vector4{direction.x, direction.y, direction.z, 1.0f};
-            lightData.LightColor = light.LightColor;
+            const DirectX::SimpleMath::Matrix& world = GetDrawWorldTransform(m_VisibleEntities[packets[i].Payload]);
+            instances[i].World = world.Transpose();
+            // 전치는 Shader가 열 우선으로 읽으며 대신함.
+            instances[i].WorldInverseTranspose = world.Invert();
         }
-        lightData.CameraPosition = DirectX::SimpleMath::Vector4(cameraTransform.Position.x, cameraTransform.Position.y, cameraTransform.Position.z, 1.0f);
+        instances[packets.size()].World = DirectX::SimpleMath::Matrix::Identity;
+        instances[packets.size()].WorldInverseTranspose = DirectX::SimpleMath::Matrix::Identity;
 
+        m_SceneRootArguments.Instances = allocation.GPUAddress;
+    }
 
-        m_DirectCommandList->SetGraphicsRoot32BitConstants(1, 12, &lightData, 0);
-        m_DirectCommandList->SetDescriptorHeaps(1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].GetAddressOf());
-        CD3DX12_GPU_DESCRIPTOR_HANDLE gpuHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]->GetGPUDescriptorHandleForHeapStart(), 3, Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
-        m_DirectCommandList->SetGraphicsRootDescriptorTable(2, gpuHandle);
+    void Renderer::BuildDrawGroups()
+    {
+        // Depth를 뺀 Key가 같은 연속된 Packet은 같은 Pipeline, Material, Mesh이므로 DrawIndexedInstanced 한 번으로 그림.
+        // 지금은 PSO와 Material이 하나뿐이라 Group이 바뀔 때 Mesh Buffer만 바꿈.
+        const entt::registry& registry = m_Scene->GetRegistry();
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        const std::span<const DrawPacket> packets = m_RenderQueue.GetPackets();
+        const uint32_t packetCount = static_cast<uint32_t>(packets.size());
+        m_DrawGroups.clear();
+        for (uint32_t first = 0; first < packetCount;)
+        {
+            const uint64_t stateKey = RenderQueue::GetStateKey(packets[first].Key);
+            uint32_t last = first + 1;
+            while (last < packetCount && RenderQueue::GetStateKey(packets[last].Key) == stateKey)
+            {
+                ++last;
+            }
 
-        m_DirectCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        m_DirectCommandList->IASetVertexBuffers(0, 1, &m_VertexBufferView);
-        m_DirectCommandList->IASetIndexBuffer(&m_IndexBufferView);
-        
+            const Mesh& mesh = meshPool.Get(registry.get<MeshRenderComponent>(m_VisibleEntities[packets[first].Payload]).Mesh);
+            m_DrawGroups.push_back({mesh.VertexBufferView, mesh.IndexBufferView, static_cast<uint32_t>(mesh.Indices.size()), first, last - first});
+            m_RequiredUploadFenceValue = std::max(m_RequiredUploadFenceValue, mesh.UploadFenceValue);
+            first = last;
+        }
 
-        CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV]->GetCPUDescriptorHandleForHeapStart(), 0);
-        m_DirectCommandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+        m_DrawGroups.push_back({m_BillboardVertexBufferView, m_BillboardIndexBufferView, static_cast<uint32_t>(m_BillboardIndexBufferView.SizeInBytes / sizeof(uint32_t)), packetCount, 1});
+        m_RequiredUploadFenceValue = std::max(m_RequiredUploadFenceValue, m_BillboardUploadFenceValue);
+    }
+
+    void Renderer::RecordDrawGroups(ID3D12GraphicsCommandList* commandList, uint32_t firstGroup, uint32_t lastGroup) const
+    {
+        const SceneRootArguments& arguments = m_SceneRootArguments;
+        commandList->RSSetViewports(1, &m_Viewport);
+        commandList->RSSetScissorRects(1, &m_ScissorRect);
+        commandList->SetDescriptorHeaps(1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].GetAddressOf());
+        commandList->SetPipelineState(m_PipelineState.Get());
+        commandList->SetGraphicsRootSignature(m_RootSignature.Get());
+        commandList->SetGraphicsRoot32BitConstants(0, 16, &arguments.TransposedViewProjection, 0);
+        commandList->SetGraphicsRootConstantBufferView(1, arguments.LightData);
+        commandList->SetGraphicsRootDescriptorTable(2, arguments.MaterialTable);
+        commandList->SetGraphicsRootShaderResourceView(3, arguments.Lights);
+        commandList->SetGraphicsRootShaderResourceView(4, arguments.Clusters);
+        commandList->SetGraphicsRootShaderResourceView(5, arguments.LightIndices);
+        commandList->SetGraphicsRootShaderResourceView(6, arguments.Instances);
+        commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        commandList->OMSetRenderTargets(1, &arguments.RenderTarget, true, &arguments.DepthStencil);
+
+        // SV_InstanceID는 StartInstanceLocation을 더하지 않으므로 첫 Instance의 위치는 Root Constant로 넘김.
+        for (uint32_t i = firstGroup; i < lastGroup; ++i)
         {
-            CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]->GetCPUDescriptorHandleForHeapStart(), currentBackBufferIndex + 2, Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV));
-            m_DirectCommandList->OMSetRenderTargets(1, &rtvHandle, true, &dsvHandle);
+            const DrawGroup& group = m_DrawGroups[i];
+            commandList->SetGraphicsRoot32BitConstant(0, group.FirstInstance, 16);
+            commandList->IASetVertexBuffers(0, 1, &group.VertexBufferView);
+            commandList->IASetIndexBuffer(&group.IndexBufferView);
+            commandList->DrawIndexedInstanced(group.IndexCount, group.InstanceCount, 0, 0, 0);
+        }
+    }
+
+    void Renderer::BuildRenderQueue(const DirectX::SimpleMath::Matrix& view, float nearPlane, float farPlane)
+    {
+        entt::registry& registry = m_Scene->GetRegistry();
+        const AssetPool<Mesh>& meshPool = AssetManager::GetPool<Mesh>();
+        m_RenderQueue.Clear();
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_VisibleEntities.size()); ++i)
+        {
+            // Streaming 중인 Cell의 Mesh는 Cell이 모두 올라온 뒤에 Upload됨.
+            const AssetHandle<Mesh> meshHandle = registry.get<MeshRenderComponent>(m_VisibleEntities[i]).Mesh;
+            if (!meshPool.Get(meshHandle).VertexBuffer)
             {
-                const auto& resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(m_SceneColorBuffers[currentBackBufferIndex].Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET);
-                m_DirectCommandList->ResourceBarrier(1, &resourceBarrier);
+                continue;
             }
 
-            m_DirectCommandList->ClearRenderTargetView(rtvHandle, DirectX::Colors::DarkSlateGray, 0, nullptr);
+            // 불투명한 Mesh는 같은 Mesh 안에서 가까운 것부터 그려 Depth Test로 Pixel Shader를 줄임.
+            const float viewDepth = -DirectX::SimpleMath::Vector3::Transform(GetDrawWorldTransform(m_VisibleEntities[i]).Translation(), view).z;
+            const uint64_t key = RenderQueue::MakeKey(RenderQueue::Pass::Opaque, 0, 0, meshHandle.GetIndex(), RenderQueue::QuantizeDepth(viewDepth, nearPlane, farPlane));
+            m_RenderQueue.Push(key, i);
         }
-        //m_DirectCommandList->DrawIndexedInstanced(static_cast<uint32_t>(m_IndexBufferView.SizeInBytes / sizeof(uint32_t)), 1, 0, 0, 0);
+        m_RenderQueue.Sort(Core::GetJobSystem());
+    }
 
+    void Renderer::CreateUploadRing()
+    {
+        const CD3DX12_HEAP_PROPERTIES uploadHeapProperty(D3D12_HEAP_TYPE_UPLOAD);
+        const D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(UploadRingCapacity);
+        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&uploadHeapProperty, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_UploadBuffer))));
+        m_UploadBuffer->SetName(L"UploadRing");
+
+        // Upload Heap은 계속 Map해 두어도 됨. CPU는 읽지 않으므로 읽기 범위는 비움.
+        const CD3DX12_RANGE readRange(0, 0);
+        EG_CONFIRM(SUCCEEDED(m_UploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&m_MappedUploadBuffer))));
+        m_UploadRing = UploadRing(UploadRingCapacity);
+    }
 
-        
-        transformData.MatGeo = DirectX::SimpleMath::Matrix::Identity;
-        transformData.MatGeoInvert = DirectX::SimpleMath::Matrix::Identity; 
-        m_DirectCommandList->SetGraphicsRoot32BitConstants(0, 48, &transformData, 0);
-        m_DirectCommandList->IASetVertexBuffers(0, 1, &m_BillboardVertexBufferView);
-        m_DirectCommandList->IASetIndexBuffer(&m_BillboardIndexBufferView);
-        m_DirectCommandList->DrawIndexedInstanced(static_cast<uint32_t>(m_BillboardIndexBufferView.SizeInBytes / sizeof(uint32_t)), 1, 0, 0, 0);
-        
+    Renderer::UploadAllocation Renderer::AllocateUpload(uint64_t sizeInBytes, uint64_t alignment)
+    {
+        std::optional<uint64_t> offset = m_UploadRing.Allocate(sizeInBytes, alignment);
+        while (!offset && m_UploadRing.HasRetiredRegions())
         {
-            const auto& resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(m_SceneColorBuffers[currentBackBufferIndex].Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
-            m_DirectCommandList->ResourceBarrier(1, &resourceBarrier);
+            // 가장 오래된 Frame이 끝날 때까지 기다리면 그 Frame이 쓰던 구간이 비워짐.
+            WaitForFrameFence(m_UploadRing.GetOldestRetiredFenceValue());
+            m_UploadRing.Reclaim(m_FrameFence->GetCompletedValue());
+            offset = m_UploadRing.Allocate(sizeInBytes, alignment);
+        }
+        if (offset)
+        {
+            return {m_MappedUploadBuffer + *offset, m_UploadBuffer->GetGPUVirtualAddress() + *offset, m_UploadBuffer.Get(), *offset};
         }
 
+        // 이번 Frame의 할당만으로 Ring이 가득 찬 경우에는 이 할당만을 위한 Buffer를 만들고, Frame이 끝나면 해제함.
+        Microsoft::WRL::ComPtr<ID3D12Resource> buffer = nullptr;
+        const CD3DX12_HEAP_PROPERTIES uploadHeapProperty(D3D12_HEAP_TYPE_UPLOAD);
+        const D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(sizeInBytes);
+        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&uploadHeapProperty, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&buffer))));
+        uint8_t* mappedData = nullptr;
+        const CD3DX12_RANGE readRange(0, 0);
+        EG_CONFIRM(SUCCEEDED(buffer->Map(0, &readRange, reinterpret_cast<void**>(&mappedData))));
+        DeferRelease(buffer);
+        return {mappedData, buffer->GetGPUVirtualAddress(), buffer.Get(), 0};
+    }
+
+    void Renderer::DeferRelease(Microsoft::WRL::ComPtr<ID3D12Resource> resource)
+    {
+        // 지금 기록 중이거나 다음에 Submit할 Frame이 끝나면 그 전에 Submit된 Frame도 모두 끝난 것임.
+        m_PendingReleases.push_back({m_LastFrameFenceValue + 1, std::move(resource)});
+    }
 
-        m_DirectCommandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+    void Renderer::WaitForFrameFence(uint64_t fenceValue)
+    {
+        if (m_FrameFence->GetCompletedValue() < fenceValue)
         {
-            CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]->GetCPUDescriptorHandleForHeapStart(), Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV) * currentBackBufferIndex);
-            m_DirectCommandList->OMSetRenderTargets(1, &rtvHandle, true, &dsvHandle);
-            {
-                const auto& resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(m_SwapChainBuffers[currentBackBufferIndex].Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET);
-                m_DirectCommandList->ResourceBarrier(1, &resourceBarrier);
-            }
+            EG_CONFIRM(SUCCEEDED(m_FrameFence->SetEventOnCompletion(fenceValue, m_FrameFenceEvent.Get())));
+            WaitForSingleObject(m_FrameFenceEvent.Get(), INFINITE);
+        }
+    }
 
-            m_DirectCommandList->ClearRenderTargetView(rtvHandle, DirectX::Colors::DarkSlateGray, 0, nullptr);
+    void Renderer::FlushBarriers()
+    {
+        const std::span<const D3D12_RESOURCE_BARRIER> barriers = m_ResourceStates.Flush();
+        if (!barriers.empty())
+        {
+            m_DirectCommandList->ResourceBarrier(static_cast<uint32_t>(barriers.size()), barriers.data());
         }
-        for (const auto& renderCommand : m_RenderCommands)
+    }
+
+    DescriptorHandle Renderer::AllocateTransientDescriptors(uint32_t count)
+    {
+        DescriptorHeap& descriptorHeap = m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+        std::optional<DescriptorHandle> descriptors = descriptorHeap.AllocateTransient(count);
+        while (!descriptors && descriptorHeap.GetTransientRing().HasRetiredRegions())
+        {
+            WaitForFrameFence(descriptorHeap.GetTransientRing().GetOldestRetiredFenceValue());
+            descriptorHeap.Reclaim(m_FrameFence->GetCompletedValue());
+            descriptors = descriptorHeap.AllocateTransient(count);
+        }
+        // Upload와 달리 다른 Heap으로 대신할 수 없으므로 한 Frame의 Table이 Ring을 넘으면 TransientDescriptorCount를 늘려야 함.
+        EG_CONFIRM(descriptors.has_value());
+        return *descriptors;
+    }
+
+    DescriptorHandle Renderer::CopyToTransientTable(std::span<const D3D12_CPU_DESCRIPTOR_HANDLE> sourceDescriptors)
+    {
+        const uint32_t count = static_cast<uint32_t>(sourceDescriptors.size());
+        const DescriptorHandle table = AllocateTransientDescriptors(count);
+        // 원본은 Heap 여기저기에 흩어져 있으므로 원본은 1개짜리 구간 count개, 대상은 count개짜리 구간 하나로 넘김.
+        std::vector<uint32_t> sourceRangeSizes(count, 1);
+        Core::GetRenderContext().GetDevice()->CopyDescriptors(1, &table.CPU, &count, count, sourceDescriptors.data(), sourceRangeSizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        return table;
+    }
+
+    void Renderer::BeginFrame()
+    {
+        // 이 Slot을 마지막으로 쓴 Frame만 기다리므로, 그 뒤에 Submit된 Frame은 GPU에서 계속 실행됨.
+        FrameContext& frame = m_Frames[m_FrameIndex];
+        WaitForFrameFence(frame.FenceValue);
+
+        const uint64_t completedFenceValue = m_FrameFence->GetCompletedValue();
+        m_UploadRing.Reclaim(completedFenceValue);
+        m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].Reclaim(completedFenceValue);
+        while (!m_PendingReleases.empty() && m_PendingReleases.front().FenceValue <= completedFenceValue)
         {
-            renderCommand(m_DirectCommandList.Get());
+            m_PendingReleases.pop_front();
         }
+
+        // 끝난 Upload의 Page만 돌려받고 기다리지는 않음.
+        m_UploadManager.Poll();
+        m_RequiredUploadFenceValue = 0;
+
+        frame.UsedCommandListCount = 0;
+        m_ClosedCommandLists.clear();
+        m_DirectCommandList = AcquireCommandList();
+    }
+
+    void Renderer::EndFrame()
+    {
+        CloseDirectCommandList();
+        // 이번 Frame이 쓰지 않는 Upload는 기다리지 않으므로, Streaming 중인 Mesh의 복사가 Frame을 막지 않음.
+        m_UploadManager.Submit();
+        if (!m_UploadManager.IsComplete(m_RequiredUploadFenceValue))
+        {
+            EG_CONFIRM(SUCCEEDED(m_DirectCommandQueue->Wait(m_UploadManager.GetFence(), m_RequiredUploadFenceValue)));
+        }
+        m_DirectCommandQueue->ExecuteCommandLists(static_cast<uint32_t>(m_ClosedCommandLists.size()), m_ClosedCommandLists.data());
+        m_SwapChain->Present(0, 0);
+
+        FrameContext& frame = m_Frames[m_FrameIndex];
+        frame.FenceValue = ++m_LastFrameFenceValue;
+        EG_CONFIRM(SUCCEEDED(m_DirectCommandQueue->Signal(m_FrameFence.Get(), frame.FenceValue)));
+        // 이 Frame이 기록하는 동안 할당한 구간은 이 Fence 값이 완료되면 다시 쓸 수 있음.
+        m_UploadRing.Retire(frame.FenceValue);
+        m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].Retire(frame.FenceValue);
+        m_FrameIndex = (m_FrameIndex + 1) % m_FrameCount;
+    }
+
+    void Renderer::Render()
+    {
+        const uint32_t currentBackBufferIndex = m_SwapChain->GetCurrentBackBufferIndex();
+
+
+        BeginFrame();
+        m_DirectCommandList->RSSetViewports(1, &m_Viewport);
+        m_DirectCommandList->RSSetScissorRects(1, &m_ScissorRect);
+        m_DirectCommandList->SetDescriptorHeaps(1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].GetAddressOf());
+
+        static float angle = 0.0f;
+        angle += 0.05f;
+
+
+        DirectX::SimpleMath::Matrix modelScale = DirectX::SimpleMath::Matrix::CreateScale(1.0f);
+        DirectX::SimpleMath::Matrix modelRotation = DirectX::SimpleMath::Matrix::CreateFromYawPitchRoll(DirectX::XMConvertToRadians(angle), 0.0f, 0.0f);
+        DirectX::SimpleMath::Matrix modelTranslation = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 0.0f, 0.0f);
+        m_Model = modelScale * modelRotation * modelTranslation;
+
+        //m_Model = DirectX::SimpleMath::Matrix::CreateBillboard(m_Model.Translation(), m_CameraTransform.Translation(), m_CameraTransform.Up());
+
+
+        entt::registry& registry = m_Scene->GetRegistry();
+        m_Scene->UpdateWorldTransforms();
+
+        m_CameraTransform = registry.get<WorldTransformComponent>(m_CameraEntity).World;
+
+
+        constexpr float nearPlane = 0.1f;
+        constexpr float farPlane = 1000.0f;
+        m_Projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(m_FieldOfView, m_AspectRatio, nearPlane, farPlane);
+        const DirectX::SimpleMath::Matrix view = m_CameraTransform.Invert();
+        DirectX::SimpleMath::Matrix viewProjection = view * m_Projection;
+
+
+        // Scene Color와 Depth는 이 Frame 안에서만 쓰므로 Graph가 Slot의 Heap에 놓음. Depth는 읽는 Pass가 없어 SRV를 막아 Depth 압축을 유지함.
+        m_RenderGraph.Reset();
+        ID3D12Resource* backBuffer = m_SwapChainBuffers[currentBackBufferIndex].Get();
+        const RenderGraphResource backBufferResource = m_RenderGraph.ImportTexture(backBuffer);
+        const RenderGraphResource textureResource = m_RenderGraph.ImportTexture(m_Texture.Get());
+        const RenderGraphResource sceneColorResource = m_RenderGraph.CreateTexture({m_Width, m_Height, DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET});
+        const RenderGraphResource sceneDepthResource = m_RenderGraph.CreateTexture({m_Width, m_Height, DXGI_FORMAT_D32_FLOAT, D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE});
+
+        m_RenderGraph.AddPass("Scene", {RenderGraph::Write(sceneColorResource), RenderGraph::Write(sceneDepthResource, D3D12_RESOURCE_STATE_DEPTH_WRITE), RenderGraph::Read(textureResource)},
+                              [&](ID3D12GraphicsCommandList*)
+        {
+            RenderScene(GetTransientTexture(sceneColorResource), GetTransientTexture(sceneDepthResource), view, viewProjection, nearPlane, farPlane);
+        });
+
+        // Scene Color는 ImGui가 Viewport에 Texture로 그림.
+        m_RenderGraph.AddPass("Editor", {RenderGraph::Read(sceneColorResource), RenderGraph::Write(backBufferResource)}, [&](ID3D12GraphicsCommandList* commandList)
+        {
+            Core::GetRenderContext().GetDevice()->CopyDescriptorsSimple(1, m_SceneColorSRVs[m_FrameIndex].CPU, GetTransientTexture(sceneColorResource).SRV.CPU, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+            const D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_SwapChainRTVs[currentBackBufferIndex].CPU;
+            commandList->OMSetRenderTargets(1, &rtvHandle, true, nullptr);
+            commandList->ClearRenderTargetView(rtvHandle, DirectX::Colors::DarkSlateGray, 0, nullptr);
+            for (const auto& renderCommand : m_RenderCommands)
+            {
+                renderCommand(commandList);
+            }
+        });
+
+        CompileRenderGraph();
+        m_RenderGraph.Execute([this] { return m_DirectCommandList.Get(); }, m_ResourceStates);
         m_RenderCommands.clear();
 
 
+        m_ResourceStates.Transition(backBuffer, D3D12_RESOURCE_STATE_PRESENT);
+        FlushBarriers();
+
+
+        EndFrame();
+    }
+
+    void Renderer::RenderScene(const TransientTextureResource& sceneColor, const TransientTextureResource& sceneDepth, const DirectX::SimpleMath::Matrix& view,
+                               const DirectX::SimpleMath::Matrix& viewProjection, float nearPlane, float farPlane)
+    {
+        m_SceneRootArguments.TransposedViewProjection = viewProjection.Transpose();
+        m_SceneRootArguments.RenderTarget = sceneColor.RTV.CPU;
+        m_SceneRootArguments.DepthStencil = sceneDepth.DSV.CPU;
+        UpdateLights(view, nearPlane, farPlane);
+        m_SceneRootArguments.MaterialTable = CopyToTransientTable({&m_TextureSRV.CPU, 1}).GPU;
+        m_RequiredUploadFenceValue = std::max(m_RequiredUploadFenceValue, m_TextureUploadFenceValue);
+
+        m_DirectCommandList->ClearDepthStencilView(m_SceneRootArguments.DepthStencil, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+        m_DirectCommandList->ClearRenderTargetView(m_SceneRootArguments.RenderTarget, DirectX::Colors::DarkSlateGray, 0, nullptr);
+
+        CullMeshes(viewProjection);
+
+        BuildRenderQueue(view, nearPlane, farPlane);
+        UploadInstances();
+        BuildDrawGroups();
+
+        // Wait하는 Thread도 Job을 실행하므로 Worker 수보다 하나 많이 나눔.
+        const auto startTime = std::chrono::steady_clock::now();
+        JobSystem& jobSystem = Core::GetJobSystem();
+        const uint32_t groupCount = static_cast<uint32_t>(m_DrawGroups.size());
+        const uint32_t commandListCount = std::clamp(groupCount / MinimumDrawGroupsPerCommandList, 1u, jobSystem.GetWorkerCount() + 1);
+        if (commandListCount == 1)
         {
-            const auto& resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(m_SwapChainBuffers[currentBackBufferIndex].Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
-            m_DirectCommandList->ResourceBarrier(1, &resourceBarrier);
+            RecordDrawGroups(m_DirectCommandList.Get(), 0, groupCount);
         }
+        else
+        {
+            // Worker의 Command List는 지금까지 기록한 Barrier와 Clear 뒤, 이어서 기록할 Command List 앞에 Submit됨.
+            CloseDirectCommandList();
+            JobSystem::Counter counter;
+            for (uint32_t i = 0; i < commandListCount; ++i)
+            {
+                ID3D12GraphicsCommandList* commandList = AcquireCommandList().Get();
+                m_ClosedCommandLists.push_back(commandList);
+                const uint32_t firstGroup = groupCount * i / commandListCount;
+                const uint32_t lastGroup = groupCount * (i + 1) / commandListCount;
+                jobSystem.Submit([this, commandList, firstGroup, lastGroup]
+                {
+                    RecordDrawGroups(commandList, firstGroup, lastGroup);
+                    EG_CONFIRM(SUCCEEDED(commandList->Close()));
+                }, &counter);
+            }
+            jobSystem.Wait(counter);
 
+            m_DirectCommandList = AcquireCommandList();
+            m_DirectCommandList->RSSetViewports(1, &m_Viewport);
+            m_DirectCommandList->RSSetScissorRects(1, &m_ScissorRect);
+            m_DirectCommandList->SetDescriptorHeaps(1, m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].GetAddressOf());
+        }
+        m_SceneRecordingStats = {groupCount, commandListCount, std::chrono::steady_clock::now() - startTime};
+    }
 
-        m_DirectCommandList->Close();
-        m_DirectCommandQueue->ExecuteCommandLists(1, CommandListCast(m_DirectCommandList.GetAddressOf()));
+    const Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>& Renderer::AcquireCommandList()
+    {
+        // BeginFrame에서 이 Slot의 이전 Frame을 기다렸으므로 Pool의 Allocator는 모두 Reset해도 됨.
+        FrameContext& frame = m_Frames[m_FrameIndex];
+        if (frame.UsedCommandListCount == frame.CommandLists.size())
+        {
+            FrameCommandList& newCommandList = frame.CommandLists.emplace_back();
+            CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, newCommandList.CommandAllocator);
+            CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, newCommandList.CommandList);
+        }
 
+        const FrameCommandList& commandList = frame.CommandLists[frame.UsedCommandListCount++];
+        EG_CONFIRM(SUCCEEDED(commandList.CommandAllocator->Reset()));
+        EG_CONFIRM(SUCCEEDED(commandList.CommandList->Reset(commandList.CommandAllocator.Get(), nullptr)));
+        return commandList.CommandList;
+    }
 
-        m_SwapChain->Present(0, 0);
-        WaitForGPU();
+    void Renderer::CloseDirectCommandList()
+    {
+        EG_CONFIRM(SUCCEEDED(m_DirectCommandList->Close()));
+        m_ClosedCommandLists.push_back(m_DirectCommandList.Get());
     }
 
     void Renderer::CreateCommandQueue(D3D12_COMMAND_LIST_TYPE commandListType, Microsoft::WRL::ComPtr<ID3D12CommandQueue>& outCommandQueue)
@@ -257,15 +857,17 @@ namespace Engine
         EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommandList1(0, commandListType, D3D12_COMMAND_LIST_FLAG_NONE, IID_PPV_ARGS(outCommandList.GetAddressOf()))));
     }
 
-    void Renderer::CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType, D3D12_DESCRIPTOR_HEAP_FLAGS descriptorHeapFlag, uint32_t maximumDescriptorsCount, Microsoft::WRL::ComPtr<ID3D12DescriptorHeap>& outDescriptorHeap)
+    void Renderer::CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType, D3D12_DESCRIPTOR_HEAP_FLAGS descriptorHeapFlag, uint32_t persistentDescriptorsCount, uint32_t transientDescriptorsCount, DescriptorHeap& outDescriptorHeap)
     {
-        EG_CONFIRM(maximumDescriptorsCount > 0);
+        EG_CONFIRM(persistentDescriptorsCount > 0);
         D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {};
         descriptorHeapDesc.Type = descriptorHeapType;
-        descriptorHeapDesc.NumDescriptors = maximumDescriptorsCount;
+        descriptorHeapDesc.NumDescriptors = persistentDescriptorsCount + transientDescriptorsCount;
         descriptorHeapDesc.Flags = descriptorHeapFlag;
         descriptorHeapDesc.NodeMask = 0;
-        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateDescriptorHeap(&descriptorHeapDesc, IID_PPV_ARGS(outDescriptorHeap.GetAddressOf()))));
+        Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> descriptorHeap = nullptr;
+        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateDescriptorHeap(&descriptorHeapDesc, IID_PPV_ARGS(descriptorHeap.GetAddressOf()))));
+        outDescriptorHeap.Initialize(std::move(descriptorHeap), transientDescriptorsCount);
     }
 
     void Renderer::CreateSwapChain(uint32_t width, uint32_t height, HWND windowHandle)
@@ -291,52 +893,110 @@ namespace Engine
 
     void Renderer::CreateRenderTarget(uint32_t width, uint32_t height)
     {
-        CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHeapHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]->GetCPUDescriptorHandleForHeapStart(), 0);
+        // Resize할 때 다시 호출되므로 Descriptor는 처음 한 번만 할당하고 그 자리에 View를 다시 만듦.
         m_SwapChainBuffers.resize(m_FrameCount);
+        while (m_SwapChainRTVs.size() < m_FrameCount)
+        {
+            m_SwapChainRTVs.push_back(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV].Allocate());
+        }
         for (uint32_t i = 0; i < m_FrameCount; ++i)
         {
             EG_CONFIRM(SUCCEEDED(m_SwapChain->GetBuffer(i, IID_PPV_ARGS(&m_SwapChainBuffers[i]))));
+            m_ResourceStates.Register(m_SwapChainBuffers[i].Get(), 1, D3D12_RESOURCE_STATE_PRESENT);
+            Core::GetRenderContext().GetDevice()->CreateRenderTargetView(m_SwapChainBuffers[i].Get(), nullptr, m_SwapChainRTVs[i].CPU);
         }
+    }
 
-        for (const auto& buffer : m_SwapChainBuffers)
+    void Renderer::CompileRenderGraph()
+    {
+        m_RenderGraph.Compile([](const RenderGraphTextureDesc& desc)
+        {
+            const D3D12_RESOURCE_DESC resourceDesc = GetTransientTextureResourceDesc(desc);
+            const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = Core::GetRenderContext().GetDevice()->GetResourceAllocationInfo(0, 1, &resourceDesc);
+            return RenderGraphAllocationInfo{allocationInfo.SizeInBytes, allocationInfo.Alignment};
+        });
+
+        // 다른 Slot은 자기 차례가 되어 BeginFrame에서 이전 Frame이 끝난 뒤에 다시 만듦.
+        FrameContext& frame = m_Frames[m_FrameIndex];
+        if (frame.TransientCompileVersion != m_RenderGraph.GetCompileVersion())
         {
-            Core::GetRenderContext().GetDevice()->CreateRenderTargetView(buffer.Get(), nullptr, rtvHeapHandle);
-            rtvHeapHandle.Offset(Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV));
+            CreateTransientTextures(frame);
         }
 
-        const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
-        CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_D32_FLOAT, m_Width, m_Height);
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
-        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, D3D12_RESOURCE_STATE_DEPTH_WRITE, nullptr, IID_PPV_ARGS(&m_DepthStencilBuffer))));
-
-        CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHeapHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV]->GetCPUDescriptorHandleForHeapStart(), 0);
-        Core::GetRenderContext().GetDevice()->CreateDepthStencilView(m_DepthStencilBuffer.Get(), nullptr, dsvHeapHandle);
+        const std::span<const RenderGraph::TransientTexture> transientTextures = m_RenderGraph.GetTransientTextures();
+        for (uint32_t i = 0; i < transientTextures.size(); ++i)
+        {
+            m_RenderGraph.BindTexture(transientTextures[i].Resource, frame.TransientTextures[i].Resource.Get());
+        }
     }
 
-    void Renderer::CreateSceneTextures(uint64_t width, uint32_t height)
+    void Renderer::CreateTransientTextures(FrameContext& frame)
     {
-        m_SceneColorBuffers.resize(m_FrameCount);
+        // BeginFrame에서 이 Slot의 이전 Frame을 기다렸으므로 바로 해제해도 됨.
+        ReleaseTransientTextures(frame);
 
-        for (int i = 0; i < m_SwapChainBuffers.size(); ++i)
+        const Microsoft::WRL::ComPtr<ID3D12Device4> device = Core::GetRenderContext().GetDevice();
+        const uint64_t heapSize = m_RenderGraph.GetStats().HeapSize;
+        if (heapSize > 0 && (!frame.TransientHeap || frame.TransientHeap->GetDesc().SizeInBytes < heapSize))
         {
-            auto textureDesc = m_SwapChainBuffers[i]->GetDesc();
-            textureDesc.Width = width;
-            textureDesc.Height = height;
-            const auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
-
-            D3D12_CLEAR_VALUE clearValue;
-            clearValue.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-            EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &textureDesc, D3D12_RESOURCE_STATE_COMMON, & clearValue, IID_PPV_ARGS(&m_SceneColorBuffers[i]))));
-            std::wstring name = L"SceneColor_" + std::to_wstring(i);
-            m_SceneColorBuffers[i]->SetName(name.c_str());
-
+            // Render Target과 Depth Stencil만 놓으므로 Resource Heap Tier 1에서도 한 Heap에 함께 둘 수 있음.
+            const CD3DX12_HEAP_DESC heapDesc(heapSize, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES);
+            frame.TransientHeap.Reset();
+            EG_CONFIRM(SUCCEEDED(device->CreateHeap(&heapDesc, IID_PPV_ARGS(&frame.TransientHeap))));
+        }
 
-            CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHeapHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV]->GetCPUDescriptorHandleForHeapStart(), i + 2, Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV));
-            Core::GetRenderContext().GetDevice()->CreateRenderTargetView(m_SceneColorBuffers[i].Get(), nullptr, rtvHeapHandle);
+        for (const RenderGraph::TransientTexture& texture : m_RenderGraph.GetTransientTextures())
+        {
+            TransientTextureResource& resource = frame.TransientTextures.emplace_back();
+            const D3D12_RESOURCE_DESC resourceDesc = GetTransientTextureResourceDesc(texture.Desc);
+            const bool bIsDepthStencil = (texture.Desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL) != 0;
+            const D3D12_RESOURCE_STATES initialState = bIsDepthStencil ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_RENDER_TARGET;
+            EG_CONFIRM(SUCCEEDED(device->CreatePlacedResource(frame.TransientHeap.Get(), texture.HeapOffset, &resourceDesc, initialState, nullptr, IID_PPV_ARGS(&resource.Resource))));
+            m_ResourceStates.Register(resource.Resource.Get(), 1, initialState);
+
+            if (bIsDepthStencil)
+            {
+                resource.DSV = m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV].Allocate();
+                device->CreateDepthStencilView(resource.Resource.Get(), nullptr, resource.DSV.CPU);
+            }
+            else
+            {
+                resource.RTV = m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV].Allocate();
+                device->CreateRenderTargetView(resource.Resource.Get(), nullptr, resource.RTV.CPU);
+            }
+            if ((texture.Desc.Flags & D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE) == 0)
+            {
+                resource.SRV = m_StagingDescriptorHeap.Allocate();
+                device->CreateShaderResourceView(resource.Resource.Get(), nullptr, resource.SRV.CPU);
+            }
+        }
+        frame.TransientCompileVersion = m_RenderGraph.GetCompileVersion();
+    }
 
-            CD3DX12_CPU_DESCRIPTOR_HANDLE srvHeapHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]->GetCPUDescriptorHandleForHeapStart(), i + 1, Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
-            Core::GetRenderContext().GetDevice()->CreateShaderResourceView(m_SceneColorBuffers[i].Get(), nullptr, srvHeapHandle);
+    void Renderer::ReleaseTransientTextures(FrameContext& frame)
+    {
+        for (TransientTextureResource& resource : frame.TransientTextures)
+        {
+            m_ResourceStates.Unregister(resource.Resource.Get());
+            if (resource.RTV.IsValid())
+            {
+                m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_RTV].Free(resource.RTV);
+            }
+            if (resource.DSV.IsValid())
+            {
+                m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_DSV].Free(resource.DSV);
+            }
+            if (resource.SRV.IsValid())
+            {
+                m_StagingDescriptorHeap.Free(resource.SRV);
+            }
         }
+        frame.TransientTextures.clear();
+    }
+
+    const Renderer::TransientTextureResource& Renderer::GetTransientTexture(RenderGraphResource resource) const
+    {
+        return m_Frames[m_FrameIndex].TransientTextures[m_RenderGraph.GetTransientIndex(resource)];
     }
 
     void Renderer::CreateFence()
@@ -344,53 +1004,39 @@ namespace Engine
         EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_Fence))));
         m_FenceEvent.Attach(CreateEvent(nullptr, false, false, nullptr));
         EG_CONFIRM(m_FenceEvent.IsValid());
+
+        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_FrameFence))));
+        m_FrameFenceEvent.Attach(CreateEvent(nullptr, false, false, nullptr));
+        EG_CONFIRM(m_FrameFenceEvent.IsValid());
     }
 
     void Renderer::WaitForGPU()
     {
-        EG_CONFIRM(SUCCEEDED(m_DirectCommandQueue->Signal(m_Fence.Get(), m_FenceValue)));
-        if (m_Fence->GetCompletedValue() < m_FenceValue)
+        m_UploadManager.WaitForIdle();
+        // Fence는 0에서 시작하므로 먼저 값을 올려야 함. 0을 Signal하면 이미 완료된 것으로 보여 기다리지 않음.
+        const uint64_t fenceValue = ++m_FenceValue;
+        EG_CONFIRM(SUCCEEDED(m_DirectCommandQueue->Signal(m_Fence.Get(), fenceValue)));
+        if (m_Fence->GetCompletedValue() < fenceValue)
         {
-            EG_CONFIRM(SUCCEEDED(m_Fence->SetEventOnCompletion(m_FenceValue, m_FenceEvent.Get())));
+            EG_CONFIRM(SUCCEEDED(m_Fence->SetEventOnCompletion(fenceValue, m_FenceEvent.Get())));
             WaitForSingleObject(m_FenceEvent.Get(), INFINITE);
         }
-        m_FenceValue++;
     }
 
-    void Renderer::CreateVertexAndIndexBufferView(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, Microsoft::WRL::ComPtr<ID3D12Resource>& outVertexBuffer, Microsoft::WRL::ComPtr<ID3D12Resource>& outIndexBuffer, D3D12_VERTEX_BUFFER_VIEW& outVertexBufferView, D3D12_INDEX_BUFFER_VIEW& outIndexBufferView)
+    uint64_t Renderer::CreateVertexAndIndexBufferView(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, Microsoft::WRL::ComPtr<ID3D12Resource>& outVertexBuffer, Microsoft::WRL::ComPtr<ID3D12Resource>& outIndexBuffer, D3D12_VERTEX_BUFFER_VIEW& outVertexBufferView, D3D12_INDEX_BUFFER_VIEW& outIndexBufferView)
     {
+        AssetLoadProfiler::StageScope uploadStageScope(AssetLoadStage::Upload);
         const CD3DX12_HEAP_PROPERTIES heapProperty(D3D12_HEAP_TYPE_DEFAULT);
-        const CD3DX12_HEAP_PROPERTIES uploadHeapProperty(D3D12_HEAP_TYPE_UPLOAD);
         const D3D12_RESOURCE_DESC vertexBufferResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(vertices.size() * sizeof(Vertex));
-
         EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&heapProperty, D3D12_HEAP_FLAG_NONE, &vertexBufferResourceDesc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(outVertexBuffer.GetAddressOf()))));
-        Microsoft::WRL::ComPtr<ID3D12Resource> vertexIntermediateBuffer = nullptr;
-        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&uploadHeapProperty, D3D12_HEAP_FLAG_NONE, &vertexBufferResourceDesc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&vertexIntermediateBuffer))));
-
 
         const D3D12_RESOURCE_DESC indexBufferResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(indices.size() * sizeof(uint32_t));
         EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&heapProperty, D3D12_HEAP_FLAG_NONE, &indexBufferResourceDesc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(outIndexBuffer.GetAddressOf()))));
-        Microsoft::WRL::ComPtr<ID3D12Resource> indexIntermediateBuffer = nullptr;
-        EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&uploadHeapProperty, D3D12_HEAP_FLAG_NONE, &indexBufferResourceDesc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&indexIntermediateBuffer))));
-
-        D3D12_SUBRESOURCE_DATA vertexSubresourceData{};
-        vertexSubresourceData.pData = vertices.data();
-        vertexSubresourceData.RowPitch = vertices.size() * sizeof(Vertex);
-        vertexSubresourceData.SlicePitch = vertices.size() * sizeof(Vertex);
-
-        D3D12_SUBRESOURCE_DATA indexSubresourceData{};
-        indexSubresourceData.pData = indices.data();
-        indexSubresourceData.RowPitch = indices.size() * sizeof(uint32_t);
-        indexSubresourceData.SlicePitch = indices.size() * sizeof(uint32_t);
-
-
-        m_CopyCommandList->Reset(m_CopyCommandAllocator.Get(), nullptr);
-        UpdateSubresources(m_CopyCommandList.Get(), outVertexBuffer.Get(), vertexIntermediateBuffer.Get(), 0, 0, 1, &vertexSubresourceData);
-        UpdateSubresources(m_CopyCommandList.Get(), outIndexBuffer.Get(), indexIntermediateBuffer.Get(), 0, 0, 1, &indexSubresourceData);
-        m_CopyCommandList->Close();
-        m_CopyCommandQueue->ExecuteCommandLists(1, CommandListCast(m_CopyCommandList.GetAddressOf()));
-        GraphicsHelper::WaitForGPU(m_CopyCommandQueue, m_Fence, m_FenceValue);
 
+        // 복사가 끝나기를 기다리지 않고, 그리는 Frame이 GPU에서 기다림. Index Buffer의 Ticket은 Vertex Buffer의 것보다 작지 않음.
+        m_UploadManager.UploadBuffer(outVertexBuffer.Get(), 0, vertices.data(), vertexBufferResourceDesc.Width);
+        const uint64_t ticket = m_UploadManager.UploadBuffer(outIndexBuffer.Get(), 0, indices.data(), indexBufferResourceDesc.Width);
+        AssetLoadProfiler::AddBytesUploaded(vertexBufferResourceDesc.Width + indexBufferResourceDesc.Width);
 
         outVertexBufferView.BufferLocation = outVertexBuffer->GetGPUVirtualAddress();
         outVertexBufferView.SizeInBytes = static_cast<uint32_t>(vertices.size() * sizeof(Vertex));
@@ -399,6 +1045,7 @@ namespace Engine
         outIndexBufferView.BufferLocation = outIndexBuffer->GetGPUVirtualAddress();
         outIndexBufferView.SizeInBytes = static_cast<uint32_t>(indices.size() * sizeof(uint32_t));
         outIndexBufferView.Format = DXGI_FORMAT_R32_UINT;
+        return ticket;
     }
 
 
@@ -479,7 +1126,12 @@ namespace Engine
         using namespace entt::literals;
         auto meshHandle = AssetManager::LoadMesh("teapot"_hs, "Content/teapot.obj");
 
-        CreateVertexAndIndexBufferView(meshHandle->Vertices, meshHandle->Indices, m_VertexBuffer, m_IndexBuffer, m_VertexBufferView, m_IndexBufferView);
+        // 같은 내용의 Mesh가 이미 Upload되었다면 그 Buffer를 그대로 사용함.
+        if (!meshHandle->VertexBuffer)
+        {
+            AssetLoadProfiler::AssetScope assetScope("Content/teapot.obj");
+            meshHandle->UploadFenceValue = CreateVertexAndIndexBufferView(meshHandle->Vertices, meshHandle->Indices, meshHandle->VertexBuffer, meshHandle->IndexBuffer, meshHandle->VertexBufferView, meshHandle->IndexBufferView);
+        }
 
         auto a = sizeof(Vertex);
         std::vector<Vertex> vertices = {
@@ -495,19 +1147,34 @@ namespace Engine
         };
         
         
-        CreateVertexAndIndexBufferView(vertices, indices, m_BillboardVertexBuffer, m_BillboardIndexBuffer, m_BillboardVertexBufferView, m_BillboardIndexBufferView);
+        {
+            AssetLoadProfiler::AssetScope assetScope("Billboard");
+            m_BillboardUploadFenceValue = CreateVertexAndIndexBufferView(vertices, indices, m_BillboardVertexBuffer, m_BillboardIndexBuffer, m_BillboardVertexBufferView, m_BillboardIndexBufferView);
+        }
 
 
         const auto textureHandle = Engine::AssetManager::LoadTexture("yoimiya_texture"_hs, "Content/sticker_6.png");
-        m_DirectCommandList->Reset(m_DirectCommandAllocator.Get(), nullptr);
-        GraphicsHelper::CreateTextureResource(textureHandle, m_DirectCommandQueue, m_Fence, m_FenceValue, m_DirectCommandList, m_Texture);
+        EG_CONFIRM(textureHandle);
+        if (!textureHandle->Resource)
+        {
+            AssetLoadProfiler::AssetScope assetScope("Content/sticker_6.png");
+            textureHandle->UploadFenceValue = GraphicsHelper::CreateTextureResource(textureHandle, m_UploadManager, m_ResourceStates, textureHandle->Resource);
+        }
+        m_Texture = textureHandle->Resource;
+        m_TextureUploadFenceValue = textureHandle->UploadFenceValue;
+        // Shader Visible Heap에는 그릴 때 Material Table로 복사함.
+        m_TextureSRV = m_StagingDescriptorHeap.Allocate();
+        CreateTextureView();
+    }
+
+    void Renderer::CreateTextureView()
+    {
         D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
         srvDesc.Format = m_Texture->GetDesc().Format;
         srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
         srvDesc.Texture2D.MipLevels = 1;
-        CD3DX12_CPU_DESCRIPTOR_HANDLE srvHeapHandle(m_DescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]->GetCPUDescriptorHandleForHeapStart(), 3, Core::GetRenderContext().GetIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
-        Core::GetRenderContext().GetDevice()->CreateShaderResourceView(m_Texture.Get(), &srvDesc, srvHeapHandle);
+        Core::GetRenderContext().GetDevice()->CreateShaderResourceView(m_Texture.Get(), &srvDesc, m_TextureSRV.CPU);
     }
 
     void Renderer::SubmitGraphicsCommand(const RenderCommand& renderCommand)
@@ -1,14 +1,26 @@
 #pragma once
 #include <array>
+#include <chrono>
 #include <d3d12.h>
+#include <deque>
 #include <dxgi1_5.h>
 #include <vector>
 #include <wrl.h>
 
 #include "AssetManager.h"
+#include "DescriptorHeap.h"
+#include "FrustumCulling.h"
+#include "LightClusterGrid.h"
+#include "OcclusionBuffer.h"
+#include "RenderGraph.h"
+#include "RenderQueue.h"
+#include "ResourceStateTracker.h"
+#include "UploadManager.h"
+#include "UploadRing.h"
 #include "GraphicsTypes.h"
 #include "SimpleMath.h"
 #include "ECS/Scene.h"
+#include "ECS/WorldPartition.h"
 
 struct CD3DX12_ROOT_PARAMETER;
 namespace Engine
@@ -16,11 +28,100 @@ namespace Engine
     struct DisplayNameComponent;
 
 
+    // Vertex Shader의 Instance 구조체와 같은 배치. Shader는 열 우선으로 읽으므로 World는 전치하여 넣음.
+    // WorldInverseTranspose에는 역행렬을 전치하지 않고 넣음. 열 우선으로 읽히면서 전치되므로 Shader에서는 역행렬의 전치가 됨.
+    struct InstanceData
+    {
+        DirectX::SimpleMath::Matrix World;
+        DirectX::SimpleMath::Matrix WorldInverseTranspose;
+    };
+
     class Renderer
     {
         // TEMP
         friend class Application;
 
+        // Render Graph의 Transient Texture를 Heap에 놓은 Resource와 View.
+        struct TransientTextureResource
+        {
+            Microsoft::WRL::ComPtr<ID3D12Resource> Resource = nullptr;
+            DescriptorHandle RTV;
+            DescriptorHandle DSV;
+            // Staging Heap에 있음.
+            DescriptorHandle SRV;
+        };
+
+        // Allocator는 한 번에 한 Thread만 기록할 수 있으므로 Command List마다 따로 둠.
+        struct FrameCommandList
+        {
+            Microsoft::WRL::ComPtr<ID3D12CommandAllocator> CommandAllocator = nullptr;
+            Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> CommandList = nullptr;
+        };
+
+        // CPU가 다음 Frame을 기록하는 동안 GPU가 이전 Frame을 실행하도록, 진행 중인 Frame마다 따로 가지는 것.
+        struct FrameContext
+        {
+            // 이 Frame에 기록하는 Command List의 Pool. 앞에서부터 필요한 만큼 꺼내 쓰고 모자라면 늘림.
+            std::vector<FrameCommandList> CommandLists;
+            uint32_t UsedCommandListCount = 0;
+            // 이 Slot의 마지막 Frame이 끝나면 m_FrameFence가 도달하는 값. 0이면 아직 Submit한 적이 없음.
+            uint64_t FenceValue = 0;
+            // GPU가 다른 Slot의 Frame을 실행하는 동안 덮어쓰지 않도록 Transient Texture의 Heap도 Slot마다 둠.
+            Microsoft::WRL::ComPtr<ID3D12Heap> TransientHeap = nullptr;
+            std::vector<TransientTextureResource> TransientTextures;
+            // TransientTextures를 만든 Render Graph의 Compile Version.
+            uint64_t TransientCompileVersion = 0;
+        };
+
+        // GPU가 아직 쓰고 있을 수 있어 m_FrameFence가 FenceValue에 도달할 때까지 붙잡아 두는 Resource.
+        struct PendingRelease
+        {
+            uint64_t FenceValue = 0;
+            Microsoft::WRL::ComPtr<ID3D12Resource> Resource = nullptr;
+        };
+
+        // Scene Pass의 Command List마다 다시 설정하는 Root Argument와 Render Target. Command List끼리는 State를 물려받지 않음.
+        struct SceneRootArguments
+        {
+            DirectX::SimpleMath::Matrix TransposedViewProjection;
+            D3D12_GPU_VIRTUAL_ADDRESS LightData = 0;
+            D3D12_GPU_VIRTUAL_ADDRESS Lights = 0;
+            D3D12_GPU_VIRTUAL_ADDRESS Clusters = 0;
+            D3D12_GPU_VIRTUAL_ADDRESS LightIndices = 0;
+            D3D12_GPU_VIRTUAL_ADDRESS Instances = 0;
+            D3D12_GPU_DESCRIPTOR_HANDLE MaterialTable{};
+            D3D12_CPU_DESCRIPTOR_HANDLE RenderTarget{};
+            D3D12_CPU_DESCRIPTOR_HANDLE DepthStencil{};
+        };
+
+        // DrawIndexedInstanced 한 번. Worker가 Registry를 건드리지 않도록 Mesh의 View를 복사해 둠.
+        struct DrawGroup
+        {
+            D3D12_VERTEX_BUFFER_VIEW VertexBufferView{};
+            D3D12_INDEX_BUFFER_VIEW IndexBufferView{};
+            uint32_t IndexCount = 0;
+            uint32_t FirstInstance = 0;
+            uint32_t InstanceCount = 0;
+        };
+
+    public:
+        struct SceneRecordingStats
+        {
+            uint32_t DrawCount = 0;
+            uint32_t CommandListCount = 0;
+            // Draw를 나누어 기록하고 모두 끝날 때까지 걸린 시간.
+            std::chrono::nanoseconds Duration{};
+        };
+
+        // Upload Heap의 한 구간. 이번 Frame이 끝날 때까지만 유효함.
+        struct UploadAllocation
+        {
+            uint8_t* CPUAddress = nullptr;
+            D3D12_GPU_VIRTUAL_ADDRESS GPUAddress = 0;
+            ID3D12Resource* Resource = nullptr;
+            uint64_t Offset = 0;
+        };
+
     public:
         using RenderCommand = std::function<void(ID3D12GraphicsCommandList*)>;
 
@@ -35,65 +136,138 @@ namespace Engine
         void CreateCommandQueue(D3D12_COMMAND_LIST_TYPE commandListType, Microsoft::WRL::ComPtr<ID3D12CommandQueue>& outCommandQueue);
         void CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE commandListType, Microsoft::WRL::ComPtr<ID3D12CommandAllocator>& outCommandAllocator);
         void CreateCommandList(D3D12_COMMAND_LIST_TYPE commandListType, Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>& outCommandList);
-        void CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType, D3D12_DESCRIPTOR_HEAP_FLAGS descriptorHeapFlag, uint32_t maximumDescriptorsCount, Microsoft::WRL::ComPtr<ID3D12DescriptorHeap>& outDescriptorHeap);
+        // 마지막 transientDescriptorsCount개는 Frame마다 쓰고 버리는 Table을 위한 Ring으로 사용함.
+        void CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType, D3D12_DESCRIPTOR_HEAP_FLAGS descriptorHeapFlag, uint32_t persistentDescriptorsCount, uint32_t transientDescriptorsCount, DescriptorHeap& outDescriptorHeap);
 
         
         void CreateSwapChain(uint32_t width, uint32_t height, HWND windowHandle);
         void CreateRenderTarget(uint32_t width, uint32_t height);
-        void CreateSceneTextures(uint64_t width, uint32_t height);
         void CreateFence();
+        // Direct Queue와 Copy Queue에 Submit된 모든 작업을 기다림. Scene 교체나 Resize처럼 진행 중인 Frame이 쓰는 Resource를 바꿀 때만 사용함.
         void WaitForGPU();
-
-
-        void CreateVertexAndIndexBufferView(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
-                                            Microsoft::WRL::ComPtr<ID3D12Resource>& outVertexBuffer, Microsoft::WRL::ComPtr<ID3D12Resource>& outIndexBuffer,
-                                            D3D12_VERTEX_BUFFER_VIEW& outVertexBufferView, D3D12_INDEX_BUFFER_VIEW& outIndexBufferView);
+        // 현재 Frame Slot을 마지막으로 쓴 Frame이 끝날 때까지만 기다린 뒤 그 Slot의 Pool에서 Command List를 엶.
+        void BeginFrame();
+        // 모아 둔 Upload를 Submit하고, 이번 Frame이 쓰는 Upload가 끝나지 않았다면 Direct Queue가 GPU에서 기다리게 함.
+        // 그 뒤 이번 Frame의 Command List를 기록한 순서대로 ExecuteCommandLists 한 번으로 Submit하고 Present한 뒤 다음 Slot으로 넘어감.
+        void EndFrame();
+        // 현재 Slot의 Pool에서 Command List를 꺼내 엶. Render Thread에서만 호출하며, Worker에는 미리 꺼내 넘김.
+        const Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>& AcquireCommandList();
+        // m_DirectCommandList를 닫아 Submit 순서에 넣음. 이어서 기록하려면 새 Command List를 꺼내야 함.
+        void CloseDirectCommandList();
+
+
+        // Buffer를 만들고 Upload를 m_UploadManager의 Batch에 넣음. 반환한 Ticket이 끝나기 전에는 Buffer를 읽으면 안 됨.
+        uint64_t CreateVertexAndIndexBufferView(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                                Microsoft::WRL::ComPtr<ID3D12Resource>& outVertexBuffer, Microsoft::WRL::ComPtr<ID3D12Resource>& outIndexBuffer,
+                                                D3D12_VERTEX_BUFFER_VIEW& outVertexBufferView, D3D12_INDEX_BUFFER_VIEW& outIndexBufferView);
         void CreateRootSignature(uint32_t rootParameterCount, CD3DX12_ROOT_PARAMETER* rootParameters, Microsoft::WRL::ComPtr<ID3D12RootSignature>& outRootSignature);
         void CreatePipelineState();
 
         
         void LoadAssets();
+        // m_Texture의 SRV를 Staging Heap의 m_TextureSRV 자리에 만듦.
+        void CreateTextureView();
         void SubmitGraphicsCommand(const RenderCommand& renderCommand);
 
-        Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE DescHeapType) const
+        void CreateSceneCamera();
+        bool SaveScene(const std::filesystem::path& filePath) const;
+        // 현재 Scene을 파일의 Scene으로 교체함. 실패하면 현재 Scene은 그대로 남음.
+        bool LoadScene(const std::filesystem::path& filePath);
+        void UploadMissingMeshes();
+        // 파일을 다시 불러와 새 GPU Resource를 Upload한 뒤 Pool의 Handle이 가리키도록 교체함. 이전 Resource는 진행 중인 Frame이 끝난 뒤에 놓음.
+        void ReloadMesh(entt::id_type id, std::string_view filePath);
+        void ReloadTexture(entt::id_type id, std::string_view filePath);
+        void ReleaseMeshRenderComponent(entt::registry& registry, entt::entity entity);
+
+        // Camera를 제외한 Scene을 Cell로 나누어 directory에 저장하고, 그 뒤로는 Camera 주변의 Cell만 Streaming함.
+        bool BuildWorldPartition(const std::filesystem::path& directory);
+        void UpdateWorldPartition();
+
+        // Camera Frustum과 겹치고 Occluder에 가려지지 않은 Mesh Entity만 m_VisibleEntities에 모음. World Transform이 없는 Mesh는 항상 포함함.
+        void CullMeshes(const DirectX::SimpleMath::Matrix& viewProjection);
+        // m_VisibleEntities 중 Upload된 Mesh의 Draw를 Queue에 넣고 State 순서로 정렬함.
+        void BuildRenderQueue(const DirectX::SimpleMath::Matrix& view, float nearPlane, float farPlane);
+        const DirectX::SimpleMath::Matrix& GetDrawWorldTransform(entt::entity entity) const;
+        // 정렬된 Packet 순서로 Instance Data를 Upload하여 m_SceneRootArguments에 기록함.
+        void UploadInstances();
+        // 정렬된 Packet을 DrawIndexedInstanced 단위로 묶어 m_DrawGroups에 모음. 마지막은 Billboard임.
+        // 그리는 Mesh의 Upload Ticket도 m_RequiredUploadFenceValue에 모음.
+        void BuildDrawGroups();
+        // Scene Pass의 State를 설정하고 m_DrawGroups의 [firstGroup, lastGroup)를 그림. 서로 다른 Command List라면 여러 Thread에서 동시에 호출해도 됨.
+        void RecordDrawGroups(ID3D12GraphicsCommandList* commandList, uint32_t firstGroup, uint32_t lastGroup) const;
+        // Light를 모아 Cluster에 배정하고, 그 결과를 Upload하여 m_SceneRootArguments에 기록함.
+        void UpdateLights(const DirectX::SimpleMath::Matrix& view, float nearPlane, float farPlane);
+        void CreateUploadRing();
+        // Constant, Instance Data처럼 GPU가 이번 Frame 안에 읽고 버리는 Data를 쓸 곳을 Upload Ring에서 잘라 줌.
+        // 기본 정렬은 Root CBV가 요구하는 256 Byte임.
+        UploadAllocation AllocateUpload(uint64_t sizeInBytes, uint64_t alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        // 지금까지 Submit했거나 기록 중인 Frame이 모두 끝난 뒤에 resource를 놓음.
+        void DeferRelease(Microsoft::WRL::ComPtr<ID3D12Resource> resource);
+        void WaitForFrameFence(uint64_t fenceValue);
+        // Render Graph를 Compile하고, 결과가 바뀌었으면 현재 Slot의 Transient Texture를 다시 만들어 Graph에 연결함.
+        void CompileRenderGraph();
+        void CreateTransientTextures(FrameContext& frame);
+        void ReleaseTransientTextures(FrameContext& frame);
+        const TransientTextureResource& GetTransientTexture(RenderGraphResource resource) const;
+        // Render Graph의 Scene Pass. Scene Color와 Depth에 보이는 Mesh를 그림.
+        void RenderScene(const TransientTextureResource& sceneColor, const TransientTextureResource& sceneDepth, const DirectX::SimpleMath::Matrix& view,
+                         const DirectX::SimpleMath::Matrix& viewProjection, float nearPlane, float farPlane);
+        // 모아 둔 Resource Barrier를 Direct Command List에 한 번에 기록함. Clear, Draw, Copy 직전에 호출함.
+        void FlushBarriers();
+        // Shader Visible Heap의 Ring에서 이번 Frame 동안만 쓸 연속된 Descriptor를 잘라 줌. 가득 차면 가장 오래된 Frame을 기다림.
+        DescriptorHandle AllocateTransientDescriptors(uint32_t count);
+        // Staging Heap에 만들어 둔 Descriptor들을 CopyDescriptors 한 번으로 연속된 Transient Table에 모음.
+        DescriptorHandle CopyToTransientTable(std::span<const D3D12_CPU_DESCRIPTOR_HANDLE> sourceDescriptors);
+
+        DescriptorHeap& GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE DescHeapType)
         {
             return m_DescriptorHeaps[DescHeapType];
         }
 
+        // 이번 Frame의 Scene Color. Scene Color는 Render Graph의 Transient Texture이므로 Render에서 이 자리에 SRV를 복사함.
+        const DescriptorHandle& GetSceneColorDescriptor() const
+        {
+            return m_SceneColorSRVs[m_FrameIndex];
+        }
+
 
         uint32_t GetCurrentBackBufferIndex() const
         {
             return m_SwapChain->GetCurrentBackBufferIndex();
         }
 
-        entt::registry& GetRegister() { return m_Registry; }
+        const SceneRecordingStats& GetSceneRecordingStats() const { return m_SceneRecordingStats; }
+        const UploadManager::Stats& GetUploadStats() const { return m_UploadManager.GetStats(); }
+
+        entt::registry& GetRegister() { return m_Scene->GetRegistry(); }
+        Scene& GetScene() { return *m_Scene; }
 
     public:
         Microsoft::WRL::ComPtr<ID3D12Fence> m_Fence = nullptr;
         Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_DirectCommandQueue = nullptr;
-        Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_DirectCommandAllocator = nullptr;
+        // Render Thread가 지금 기록 중인 Command List. 현재 Slot의 Pool에서 꺼낸 것임.
         Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_DirectCommandList = nullptr;
         Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_CopyCommandQueue = nullptr;
-        Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_CopyCommandAllocator = nullptr;
-        Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_CopyCommandList = nullptr;
+        // Mesh와 Texture의 Upload를 Copy Queue에 모아 보냄.
+        UploadManager m_UploadManager;
+        // 이번 Frame이 그리는 Resource의 Upload Ticket 중 가장 큰 값. EndFrame에서 Direct Queue가 이 값까지 기다림.
+        uint64_t m_RequiredUploadFenceValue = 0;
 
         Microsoft::WRL::ComPtr<IDXGISwapChain3> m_SwapChain = nullptr;
         std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> m_SwapChainBuffers;
-        std::array<Microsoft::WRL::ComPtr<ID3D12DescriptorHeap>, D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES> m_DescriptorHeaps;
+        std::array<DescriptorHeap, D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES> m_DescriptorHeaps;
+        // Shader가 보지 않는 CBV/SRV/UAV Heap. View를 여기에 한 번 만들어 두고, 그릴 때 필요한 것만 Transient Table로 복사함.
+        DescriptorHeap m_StagingDescriptorHeap;
+        std::vector<DescriptorHandle> m_SwapChainRTVs;
 
         Microsoft::WRL::ComPtr<ID3D12RootSignature> m_RootSignature = nullptr;
         Microsoft::WRL::ComPtr<ID3D12PipelineState> m_PipelineState = nullptr;
 
-        Microsoft::WRL::ComPtr<ID3D12Resource> m_DepthStencilBuffer = nullptr;
-        Microsoft::WRL::ComPtr<ID3D12Resource> m_VertexBuffer = nullptr;
-        Microsoft::WRL::ComPtr<ID3D12Resource> m_IndexBuffer = nullptr;
-        D3D12_VERTEX_BUFFER_VIEW m_VertexBufferView{};
-        D3D12_INDEX_BUFFER_VIEW m_IndexBufferView{};
-
         Microsoft::WRL::ComPtr<ID3D12Resource> m_BillboardVertexBuffer = nullptr;
         Microsoft::WRL::ComPtr<ID3D12Resource> m_BillboardIndexBuffer = nullptr;
         D3D12_VERTEX_BUFFER_VIEW m_BillboardVertexBufferView{};
         D3D12_INDEX_BUFFER_VIEW m_BillboardIndexBufferView{};
+        uint64_t m_BillboardUploadFenceValue = 0;
 
         
 
@@ -110,15 +284,33 @@ namespace Engine
 
 
         Microsoft::WRL::ComPtr<ID3D12Resource> m_Texture;
+        DescriptorHandle m_TextureSRV;
+        uint64_t m_TextureUploadFenceValue = 0;
 
         std::vector<RenderCommand> m_RenderCommands;
 
-        std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> m_SceneColorBuffers;
-
+        std::vector<DescriptorHandle> m_SceneColorSRVs;
+        RenderGraph m_RenderGraph;
 
-        entt::registry m_Registry;
 
+        // Swap Chain Buffer 수이자 동시에 진행할 수 있는 Frame 수.
         const uint32_t m_FrameCount = 2;
+        std::vector<FrameContext> m_Frames;
+        uint32_t m_FrameIndex = 0;
+        // 이번 Frame에 닫은 순서대로의 Command List.
+        std::vector<ID3D12CommandList*> m_ClosedCommandLists;
+        // Frame 완료만 기록하는 Fence. m_Fence는 WaitForGPU가 따로 Signal하므로 Frame 완료 여부를 판단하는 데 쓸 수 없음.
+        Microsoft::WRL::ComPtr<ID3D12Fence> m_FrameFence = nullptr;
+        Microsoft::WRL::Wrappers::Event m_FrameFenceEvent;
+        uint64_t m_LastFrameFenceValue = 0;
+        std::deque<PendingRelease> m_PendingReleases;
+
+        // Direct Command List에 기록한 순서대로의 Resource State. Barrier는 이것을 통해서만 기록함.
+        ResourceStateTracker m_ResourceStates;
+
+        Microsoft::WRL::ComPtr<ID3D12Resource> m_UploadBuffer = nullptr;
+        uint8_t* m_MappedUploadBuffer = nullptr;
+        UploadRing m_UploadRing;
 
         DirectX::SimpleMath::Matrix m_Model = DirectX::SimpleMath::Matrix::Identity;
         DirectX::SimpleMath::Matrix m_CameraTransform;
@@ -130,8 +322,24 @@ namespace Engine
         float m_FieldOfView;
 
         std::unique_ptr<Scene> m_Scene;
+        std::unique_ptr<WorldPartition> m_WorldPartition;
 
         entt::entity m_CameraEntity;
+
+        // Frame마다 다시 채우지만 할당은 재사용함.
+        CullingBoundsSoA m_CullingBounds;
+        std::vector<entt::entity> m_CullingEntities;
+        std::vector<uint32_t> m_VisibleIndices;
+        std::vector<entt::entity> m_VisibleEntities;
+        OcclusionBuffer m_OcclusionBuffer;
+        std::vector<uint32_t> m_OccludeeIndices;
+        RenderQueue m_RenderQueue;
+        SceneRootArguments m_SceneRootArguments;
+        std::vector<DrawGroup> m_DrawGroups;
+        SceneRecordingStats m_SceneRecordingStats;
+
+        std::vector<ShaderLight> m_ShaderLights;
+        LightClusterGrid m_LightClusterGrid;
         
     };
     
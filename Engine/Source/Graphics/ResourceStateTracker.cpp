@@ -0,0 +1,156 @@
+// ResourceStateTrackerTest가 Engine 없이 Build하므로 Precompiled Header를 쓰지 않음.
+#include "ResourceStateTracker.h"
+
+#include <iterator>
+
+#include "Core/Assert.h"
+
+namespace Engine
+{
+    void ResourceStateTracker::Register(ID3D12Resource* resource, uint32_t subresourceCount, D3D12_RESOURCE_STATES state)
+    {
+        EG_CONFIRM(resource && subresourceCount > 0);
+        m_Resources[resource] = {.State = state, .SubresourceStates = {}, .SubresourceCount = subresourceCount};
+    }
+
+    void ResourceStateTracker::Unregister(ID3D12Resource* resource)
+    {
+        m_Resources.erase(resource);
+        std::erase_if(m_PendingBarriers, [resource](const D3D12_RESOURCE_BARRIER& barrier)
+        {
+            return barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION ? barrier.Transition.pResource == resource : barrier.Aliasing.pResourceAfter == resource;
+        });
+    }
+
+    void ResourceStateTracker::Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES state, uint32_t subresource)
+    {
+        const auto it = m_Resources.find(resource);
+        EG_CONFIRM(it != m_Resources.end());
+        TrackedResource& tracked = it->second;
+        ++m_Stats.TransitionCount;
+
+        if (subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+        {
+            if (tracked.SubresourceStates.empty())
+            {
+                if (tracked.State != state)
+                {
+                    AddBarrier(resource, subresource, tracked.State, state);
+                }
+            }
+            else
+            {
+                // Subresource마다 이전 State가 다르므로 Barrier 하나로 묶을 수 없음.
+                for (uint32_t i = 0; i < tracked.SubresourceCount; ++i)
+                {
+                    if (tracked.SubresourceStates[i] != state)
+                    {
+                        AddBarrier(resource, i, tracked.SubresourceStates[i], state);
+                    }
+                }
+                tracked.SubresourceStates.clear();
+            }
+            tracked.State = state;
+            return;
+        }
+
+        EG_CONFIRM(subresource < tracked.SubresourceCount);
+        if (tracked.SubresourceStates.empty())
+        {
+            if (tracked.State == state)
+            {
+                return;
+            }
+            tracked.SubresourceStates.assign(tracked.SubresourceCount, tracked.State);
+        }
+        if (tracked.SubresourceStates[subresource] != state)
+        {
+            AddBarrier(resource, subresource, tracked.SubresourceStates[subresource], state);
+            tracked.SubresourceStates[subresource] = state;
+        }
+    }
+
+    D3D12_RESOURCE_STATES ResourceStateTracker::GetState(ID3D12Resource* resource, uint32_t subresource) const
+    {
+        const auto it = m_Resources.find(resource);
+        EG_CONFIRM(it != m_Resources.end());
+        const TrackedResource& tracked = it->second;
+        if (tracked.SubresourceStates.empty())
+        {
+            return tracked.State;
+        }
+        EG_CONFIRM(subresource < tracked.SubresourceCount);
+        return tracked.SubresourceStates[subresource];
+    }
+
+    void ResourceStateTracker::Alias(ID3D12Resource* resourceAfter)
+    {
+        EG_CONFIRM(m_Resources.contains(resourceAfter));
+        // 이전 Resource를 지정하지 않으면 Heap에서 겹치는 모든 Placed Resource가 대상이 됨.
+        D3D12_RESOURCE_BARRIER barrier{};
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+        barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+        barrier.Aliasing.pResourceBefore = nullptr;
+        barrier.Aliasing.pResourceAfter = resourceAfter;
+        m_PendingBarriers.push_back(barrier);
+    }
+
+    std::span<const D3D12_RESOURCE_BARRIER> ResourceStateTracker::Flush()
+    {
+        m_FlushedBarriers.swap(m_PendingBarriers);
+        m_PendingBarriers.clear();
+        if (!m_FlushedBarriers.empty())
+        {
+            m_Stats.BarrierCount += static_cast<uint32_t>(m_FlushedBarriers.size());
+            ++m_Stats.FlushCount;
+        }
+        return m_FlushedBarriers;
+    }
+
+    void ResourceStateTracker::AddBarrier(ID3D12Resource* resource, uint32_t subresource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter)
+    {
+        // 이 Subresource를 건드리는 가장 최근 Barrier가 같은 범위라면 그 Barrier의 StateAfter만 바꿔도 결과가 같음.
+        // 범위가 다르면(전체와 일부) 순서가 중요하므로 새로 추가함.
+        for (auto it = m_PendingBarriers.rbegin(); it != m_PendingBarriers.rend(); ++it)
+        {
+            if (it->Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING)
+            {
+                // Aliasing 앞뒤의 Transition은 합치면 순서가 바뀜.
+                if (it->Aliasing.pResourceAfter == resource)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            D3D12_RESOURCE_TRANSITION_BARRIER& pending = it->Transition;
+            const bool bIsOverlapped = pending.Subresource == subresource || pending.Subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES ||
+                                       subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            if (pending.pResource != resource || !bIsOverlapped)
+            {
+                continue;
+            }
+            if (pending.Subresource != subresource)
+            {
+                break;
+            }
+
+            EG_CONFIRM(pending.StateAfter == stateBefore);
+            pending.StateAfter = stateAfter;
+            if (pending.StateBefore == pending.StateAfter)
+            {
+                m_PendingBarriers.erase(std::next(it).base());
+            }
+            return;
+        }
+
+        D3D12_RESOURCE_BARRIER barrier{};
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+        barrier.Transition.pResource = resource;
+        barrier.Transition.Subresource = subresource;
+        barrier.Transition.StateBefore = stateBefore;
+        barrier.Transition.StateAfter = stateAfter;
+        m_PendingBarriers.push_back(barrier);
+    }
+}
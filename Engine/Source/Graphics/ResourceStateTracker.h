@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <d3d12.h>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    // Resource마다, 필요하면 Subresource마다 현재 State를 기억하고, 원하는 State만 알려 주면 필요한 Barrier를 만들어 모아 둠.
+    // 모아 둔 Barrier는 Draw, Dispatch, Copy 직전에 Flush로 꺼내 ResourceBarrier 한 번으로 기록함.
+    // Resource는 Key로만 쓰고 호출하지 않으므로 Device 없이 가짜 Pointer로도 검사할 수 있음.
+    //
+    // 1. 이미 원하는 State라면 Barrier를 만들지 않음.
+    // 2. Flush 전에 같은 Subresource를 다시 바꾸면 앞의 Barrier의 StateAfter만 고치며, 원래 State로 돌아오면 Barrier를 없앰.
+    class ResourceStateTracker
+    {
+    public:
+        struct Stats
+        {
+            uint32_t TransitionCount = 0;
+            // 실제로 기록한 Barrier 수와 ResourceBarrier 호출 수.
+            uint32_t BarrierCount = 0;
+            uint32_t FlushCount = 0;
+        };
+
+    public:
+        // Resource를 만든 직후 생성할 때 넘긴 State로 한 번 등록함.
+        void Register(ID3D12Resource* resource, uint32_t subresourceCount, D3D12_RESOURCE_STATES state);
+        // Resource를 해제하기 전에 호출함. 아직 Flush하지 않은 이 Resource의 Barrier도 버림.
+        void Unregister(ID3D12Resource* resource);
+        bool IsRegistered(ID3D12Resource* resource) const { return m_Resources.contains(resource); }
+
+        // 다음 Flush 뒤에는 resource의 subresource가 state에 있도록 함. Pass는 시작할 때 쓰는 Resource마다 이것을 호출함.
+        void Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES state, uint32_t subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+        // 아직 Flush하지 않은 Barrier까지 반영한 State. Subresource마다 State가 다르면 subresource를 지정해야 함.
+        D3D12_RESOURCE_STATES GetState(ID3D12Resource* resource, uint32_t subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES) const;
+        // 같은 Heap Memory를 쓰는 다른 Placed Resource 대신 resourceAfter를 쓰기 시작함을 알림. Flush할 때 Aliasing Barrier로 기록됨.
+        void Alias(ID3D12Resource* resourceAfter);
+
+        // 모아 둔 Barrier를 꺼냄. 반환한 Span은 다음 Transition이나 Flush 전까지 유효하며, 호출한 쪽이 Command List에 기록해야 함.
+        std::span<const D3D12_RESOURCE_BARRIER> Flush();
+        std::span<const D3D12_RESOURCE_BARRIER> GetPendingBarriers() const { return m_PendingBarriers; }
+
+        const Stats& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = {}; }
+
+    private:
+        struct TrackedResource
+        {
+            D3D12_RESOURCE_STATES State = D3D12_RESOURCE_STATE_COMMON;
+            // 비어 있으면 모든 Subresource가 State에 있음. Subresource 하나만 바꾸면 그때 펼침.
+            std::vector<D3D12_RESOURCE_STATES> SubresourceStates;
+            uint32_t SubresourceCount = 1;
+        };
+
+        void AddBarrier(ID3D12Resource* resource, uint32_t subresource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter);
+
+    private:
+        std::unordered_map<ID3D12Resource*, TrackedResource> m_Resources;
+        std::vector<D3D12_RESOURCE_BARRIER> m_PendingBarriers;
+        std::vector<D3D12_RESOURCE_BARRIER> m_FlushedBarriers;
+        Stats m_Stats;
+    };
+}
@@ -1,7 +1,9 @@
 #include "EnginePCH.h"
 #include "Shader.h"
 
+#include "AssetLoadProfiler.h"
 #include "Engine.h"
+#include "Core/FileHelper.h"
 
 namespace Engine
 {
@@ -26,9 +28,24 @@ namespace Engine
 #endif
 
 
+        AssetLoadProfiler::AssetScope assetScope(std::filesystem::path(filePath).string());
+
+        std::vector<uint8_t> fileData;
+        {
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::FileRead);
+            EG_CONFIRM(FileHelper::ReadFile(filePath, fileData));
+            AssetLoadProfiler::AddBytesRead(fileData.size());
+        }
+
         Microsoft::WRL::ComPtr<ID3D10Blob> dataBlob = nullptr;
         Microsoft::WRL::ComPtr<ID3D10Blob> errorBlob = nullptr;
-        const bool bCompileSucceeded = SUCCEEDED(D3DCompileFromFile(filePath.data(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, "main", shaderTypeString.c_str(), compileFlags, 0, dataBlob.GetAddressOf(), errorBlob.GetAddressOf()));
+        bool bCompileSucceeded = false;
+        {
+            // SourceName을 파일 경로로 지정해야 Standard Include가 Shader 파일 기준으로 동작함.
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::Decode);
+            const std::string sourceName = std::filesystem::path(filePath).string();
+            bCompileSucceeded = SUCCEEDED(D3DCompile(fileData.data(), fileData.size(), sourceName.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, "main", shaderTypeString.c_str(), compileFlags, 0, dataBlob.GetAddressOf(), errorBlob.GetAddressOf()));
+        }
         const bool bHasError = errorBlob && errorBlob->GetBufferSize() > 0;
         if (bHasError || !bCompileSucceeded)
         {
@@ -37,6 +54,8 @@ namespace Engine
             EG_CONFIRM(bCompileSucceeded);
         }
 
-        return std::make_shared<Shader>(dataBlob);
+        auto shader = std::make_shared<Shader>(dataBlob);
+        AssetLoadProfiler::AddBytesResident(shader->GetSizeInBytes());
+        return shader;
     }
 }
@@ -1,4 +1,7 @@
 #pragma once
+#include <cstring>
+
+#include "Core/HashHelper.h"
 
 namespace Engine
 {
@@ -11,6 +14,15 @@ namespace Engine
     struct Shader
     {
         Microsoft::WRL::ComPtr<ID3D10Blob> Blob = nullptr;
+
+        uint64_t GetSizeInBytes() const { return Blob ? Blob->GetBufferSize() : 0; }
+        uint64_t GetContentHash() const { return Blob ? HashHelper::HashBytes(Blob->GetBufferPointer(), Blob->GetBufferSize()) : 0; }
+        // Hash가 같을 때 실제로 같은 내용인지 Byte 단위로 확인함.
+        bool HasSameContent(const Shader& other) const
+        {
+            return GetSizeInBytes() == other.GetSizeInBytes() &&
+                (GetSizeInBytes() == 0 || std::memcmp(Blob->GetBufferPointer(), other.Blob->GetBufferPointer(), GetSizeInBytes()) == 0);
+        }
     };
 
     class ShaderLoader
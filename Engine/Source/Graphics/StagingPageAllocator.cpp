@@ -0,0 +1,102 @@
+#include "EnginePCH.h"
+#include "StagingPageAllocator.h"
+
+#include "Engine.h"
+
+namespace Engine
+{
+    StagingPageAllocator::StagingPageAllocator(uint64_t pageSize)
+        : m_PageSize(pageSize)
+    {
+    }
+
+    StagingPageAllocator::Allocation StagingPageAllocator::Allocate(uint64_t sizeInBytes, uint64_t alignment)
+    {
+        EG_CONFIRM(sizeInBytes > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= m_PageSize);
+        if (sizeInBytes > m_PageSize)
+        {
+            // 열린 Page는 그대로 두어 뒤의 작은 Upload가 이어서 씀.
+            const uint32_t page = CreatePage(sizeInBytes);
+            m_Pages[page].UsedSize = sizeInBytes;
+            m_PendingPages.push_back(page);
+            return {page, 0};
+        }
+
+        if (m_OpenPage != InvalidPage)
+        {
+            Page& openPage = m_Pages[m_OpenPage];
+            const uint64_t offset = (openPage.UsedSize + alignment - 1) & ~(alignment - 1);
+            if (offset + sizeInBytes <= openPage.Size)
+            {
+                openPage.UsedSize = offset + sizeInBytes;
+                return {m_OpenPage, offset};
+            }
+        }
+
+        // 열린 Page는 이미 m_PendingPages에 있으므로 닫기만 함.
+        if (m_FreePages.empty())
+        {
+            m_OpenPage = CreatePage(m_PageSize);
+        }
+        else
+        {
+            m_OpenPage = m_FreePages.back();
+            m_FreePages.pop_back();
+        }
+        m_Pages[m_OpenPage].UsedSize = sizeInBytes;
+        m_PendingPages.push_back(m_OpenPage);
+        return {m_OpenPage, 0};
+    }
+
+    void StagingPageAllocator::Retire(uint64_t fenceValue)
+    {
+        if (m_PendingPages.empty())
+        {
+            return;
+        }
+        EG_CONFIRM(m_RetiredPages.empty() || m_RetiredPages.back().FenceValue < fenceValue);
+        for (const uint32_t page : m_PendingPages)
+        {
+            m_RetiredPages.push_back({fenceValue, page});
+        }
+        m_PendingPages.clear();
+        m_OpenPage = InvalidPage;
+    }
+
+    void StagingPageAllocator::Reclaim(uint64_t completedFenceValue)
+    {
+        while (!m_RetiredPages.empty() && m_RetiredPages.front().FenceValue <= completedFenceValue)
+        {
+            const uint32_t pageIndex = m_RetiredPages.front().Page;
+            m_RetiredPages.pop_front();
+
+            Page& page = m_Pages[pageIndex];
+            if (page.Size == m_PageSize)
+            {
+                page.UsedSize = 0;
+                m_FreePages.push_back(pageIndex);
+            }
+            else
+            {
+                page = {};
+                m_ReleasedPages.push_back(pageIndex);
+            }
+        }
+    }
+
+    uint32_t StagingPageAllocator::CreatePage(uint64_t sizeInBytes)
+    {
+        uint32_t page = static_cast<uint32_t>(m_Pages.size());
+        if (m_ReleasedPages.empty())
+        {
+            m_Pages.emplace_back();
+        }
+        else
+        {
+            page = m_ReleasedPages.back();
+            m_ReleasedPages.pop_back();
+        }
+        m_Pages[page].Size = sizeInBytes;
+        return page;
+    }
+}
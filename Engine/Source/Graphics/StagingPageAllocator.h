@@ -0,0 +1,67 @@
+#pragma once
+#include <deque>
+#include <vector>
+
+namespace Engine
+{
+    // Copy Queue로 보낼 Data를 쓸 Upload Page를 나누어 주는 할당기의 Offset 계산 부분.
+    // UploadRing처럼 완료 여부는 호출하는 쪽이 넘기는 Fence 값으로만 판단하므로 가짜 Fence로도 검사할 수 있음.
+    //
+    // 1. Allocate는 열린 Page의 앞에서부터 잘라 주고, 맞지 않으면 빈 Page를 꺼내거나 새로 만들어 엶. 실패하지 않음.
+    // 2. Page 크기보다 큰 Upload는 그 Upload만을 위한 Page를 따로 만들고, 완료되면 Page를 없앰.
+    // 3. Batch를 Submit할 때 Retire로 그동안 쓴 Page에 Fence 값을 붙이고 열린 Page를 닫음.
+    // 4. Reclaim에 완료된 Fence 값을 넘기면 그 값 이하로 Retire된 Page를 다시 쓸 수 있게 됨.
+    class StagingPageAllocator
+    {
+    public:
+        static constexpr uint32_t InvalidPage = UINT32_MAX;
+
+        struct Allocation
+        {
+            uint32_t Page = InvalidPage;
+            uint64_t Offset = 0;
+        };
+
+    public:
+        explicit StagingPageAllocator(uint64_t pageSize = 0);
+
+        // alignment는 2의 거듭제곱이어야 함. Page를 새로 만들었는지는 GetPageSize로 확인함.
+        Allocation Allocate(uint64_t sizeInBytes, uint64_t alignment);
+        // 아직 Retire하지 않은 모든 Page는 fenceValue가 완료된 뒤에 다시 쓸 수 있음. fenceValue는 증가하는 순서로 넘겨야 함.
+        void Retire(uint64_t fenceValue);
+        void Reclaim(uint64_t completedFenceValue);
+
+        // 없앤 Page의 번호는 다음에 만드는 큰 Page가 다시 씀.
+        uint32_t GetPageCount() const { return static_cast<uint32_t>(m_Pages.size()); }
+        // 없앤 Page는 0임.
+        uint64_t GetPageSize(uint32_t page) const { return m_Pages[page].Size; }
+        uint64_t GetDefaultPageSize() const { return m_PageSize; }
+        uint32_t GetFreePageCount() const { return static_cast<uint32_t>(m_FreePages.size()); }
+        bool HasRetiredPages() const { return !m_RetiredPages.empty(); }
+
+    private:
+        struct Page
+        {
+            uint64_t Size = 0;
+            uint64_t UsedSize = 0;
+        };
+
+        struct RetiredPage
+        {
+            uint64_t FenceValue = 0;
+            uint32_t Page = InvalidPage;
+        };
+
+        uint32_t CreatePage(uint64_t sizeInBytes);
+
+    private:
+        uint64_t m_PageSize = 0;
+        std::vector<Page> m_Pages;
+        uint32_t m_OpenPage = InvalidPage;
+        // 아직 Retire하지 않은, 이번 Batch가 쓴 Page.
+        std::vector<uint32_t> m_PendingPages;
+        std::deque<RetiredPage> m_RetiredPages;
+        std::vector<uint32_t> m_FreePages;
+        std::vector<uint32_t> m_ReleasedPages;
+    };
+}
@@ -3,15 +3,48 @@
 #include <stb_image.h>
 #include <entt/entt.hpp>
 
+#include "AssetLoadProfiler.h"
+#include "Core/FileHelper.h"
+
 namespace Engine
 {
+    void TextureDataDeleter::operator()(uint8_t* data) const
+    {
+        stbi_image_free(data);
+    }
+
     TextureLoader::result_type TextureLoader::operator()(std::string_view filePath) const
     {
+        AssetLoadProfiler::AssetScope assetScope(filePath);
+
+        std::vector<uint8_t> fileData;
+        {
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::FileRead);
+            if (!FileHelper::ReadFile(filePath, fileData))
+            {
+                spdlog::debug("Failed to read {}", filePath);
+                return nullptr;
+            }
+            AssetLoadProfiler::AddBytesRead(fileData.size());
+        }
+
         int width = 0;
         int height = 0;
         int channelCount = 0;
-        uint8_t* data = stbi_load(filePath.data(), &width, &height, &channelCount, 0);
-        return std::make_shared<Texture>(data, width, height, channelCount);
+        uint8_t* data = nullptr;
+        {
+            AssetLoadProfiler::StageScope stageScope(AssetLoadStage::Decode);
+            data = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &width, &height, &channelCount, 0);
+        }
+        if (!data)
+        {
+            spdlog::debug("Failed to decode {}: {}", filePath, stbi_failure_reason());
+            return nullptr;
+        }
+
+        auto texture = std::make_shared<Texture>(TextureData(data), width, height, channelCount);
+        AssetLoadProfiler::AddBytesResident(texture->GetSizeInBytes());
+        return texture;
     }
 
 }
@@ -1,18 +1,45 @@
 #pragma once
+#include <cstring>
 #include <memory>
 
+#include "Core/HashHelper.h"
+
 namespace Engine
 {
+    struct TextureDataDeleter
+    {
+        void operator()(uint8_t* data) const;
+    };
+
+    using TextureData = std::unique_ptr<uint8_t, TextureDataDeleter>;
+
     struct Texture
     {
-        uint8_t* Data;
+        TextureData Data;
         uint32_t Width;
         uint32_t Height;
         uint32_t channelCount;
 
         Microsoft::WRL::ComPtr<ID3D12Resource> Resource = nullptr;
+        // Resource의 Upload가 끝나면 UploadManager의 Fence가 도달하는 값.
+        uint64_t UploadFenceValue = 0;
         D3D12_CPU_DESCRIPTOR_HANDLE CPUDescriptorHandle;
         D3D12_GPU_DESCRIPTOR_HANDLE GPUDescriptorHandle;
+
+        uint64_t GetSizeInBytes() const { return Data ? static_cast<uint64_t>(Width) * Height * channelCount : 0; }
+
+        uint64_t GetContentHash() const
+        {
+            const uint32_t dimensions[] = {Width, Height, channelCount};
+            return HashHelper::HashBytes(Data.get(), GetSizeInBytes(), HashHelper::HashBytes(dimensions, sizeof(dimensions)));
+        }
+
+        // Hash가 같을 때 실제로 같은 내용인지 Byte 단위로 확인함.
+        bool HasSameContent(const Texture& other) const
+        {
+            return Width == other.Width && Height == other.Height && channelCount == other.channelCount &&
+                GetSizeInBytes() == other.GetSizeInBytes() && (GetSizeInBytes() == 0 || std::memcmp(Data.get(), other.Data.get(), GetSizeInBytes()) == 0);
+        }
     };
 
     class TextureLoader
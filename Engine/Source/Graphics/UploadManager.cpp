@@ -0,0 +1,191 @@
+#include "EnginePCH.h"
+#include "UploadManager.h"
+
+#include "Engine.h"
+#include "Core/Core.h"
+
+namespace Engine
+{
+    namespace
+    {
+        // 한 번에 불러오는 Level이 많으면 Batch가 계속 쌓이므로, 진행 중인 Batch가 이만큼을 넘으면 가장 오래된 Batch를 기다림.
+        constexpr uint64_t MaxInFlightBatchCount = 4;
+    }
+
+    void UploadManager::Initialize(Microsoft::WRL::ComPtr<ID3D12CommandQueue> copyCommandQueue, uint64_t pageSize, uint64_t maxBatchSize)
+    {
+        EG_CONFIRM(copyCommandQueue->GetDesc().Type == D3D12_COMMAND_LIST_TYPE_COPY && pageSize >= D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        const Microsoft::WRL::ComPtr<ID3D12Device4> device = Core::GetRenderContext().GetDevice();
+        m_CommandQueue = std::move(copyCommandQueue);
+        EG_CONFIRM(SUCCEEDED(device->CreateCommandList1(0, D3D12_COMMAND_LIST_TYPE_COPY, D3D12_COMMAND_LIST_FLAG_NONE, IID_PPV_ARGS(&m_CommandList))));
+        EG_CONFIRM(SUCCEEDED(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_Fence))));
+        m_FenceEvent.Attach(CreateEvent(nullptr, false, false, nullptr));
+        EG_CONFIRM(m_FenceEvent.IsValid());
+
+        m_Pages = StagingPageAllocator(pageSize);
+        m_MaxBatchSize = maxBatchSize;
+    }
+
+    uint64_t UploadManager::UploadBuffer(ID3D12Resource* destination, uint64_t destinationOffset, const void* data, uint64_t sizeInBytes)
+    {
+        const StagingPageAllocator::Allocation allocation = Allocate(sizeInBytes, 16);
+        const PageBuffer& page = m_PageBuffers[allocation.Page];
+        std::memcpy(page.CPUAddress + allocation.Offset, data, sizeInBytes);
+        m_CommandList->CopyBufferRegion(destination, destinationOffset, page.Resource.Get(), allocation.Offset, sizeInBytes);
+        return AddToBatch(destination, sizeInBytes);
+    }
+
+    uint64_t UploadManager::UploadTexture(ID3D12Resource* destination, const D3D12_SUBRESOURCE_DATA& data, uint32_t subresource)
+    {
+        const D3D12_RESOURCE_DESC desc = destination->GetDesc();
+        D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint{};
+        uint32_t rowCount = 0;
+        uint64_t rowSize = 0;
+        uint64_t totalSize = 0;
+        Core::GetRenderContext().GetDevice()->GetCopyableFootprints(&desc, subresource, 1, 0, &footprint, &rowCount, &rowSize, &totalSize);
+
+        // Page 안의 Texture Data는 512 Byte에 맞춰 놓고, 각 Row는 256 Byte Pitch로 펼쳐야 함.
+        const StagingPageAllocator::Allocation allocation = Allocate(totalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        const PageBuffer& page = m_PageBuffers[allocation.Page];
+        uint8_t* destinationData = page.CPUAddress + allocation.Offset;
+        const uint8_t* sourceData = static_cast<const uint8_t*>(data.pData);
+        for (uint32_t z = 0; z < footprint.Footprint.Depth; ++z)
+        {
+            for (uint32_t y = 0; y < rowCount; ++y)
+            {
+                std::memcpy(destinationData + (static_cast<uint64_t>(z) * rowCount + y) * footprint.Footprint.RowPitch,
+                            sourceData + z * data.SlicePitch + y * data.RowPitch, rowSize);
+            }
+        }
+
+        footprint.Offset = allocation.Offset;
+        const CD3DX12_TEXTURE_COPY_LOCATION destinationLocation(destination, subresource);
+        const CD3DX12_TEXTURE_COPY_LOCATION sourceLocation(page.Resource.Get(), footprint);
+        m_CommandList->CopyTextureRegion(&destinationLocation, 0, 0, 0, &sourceLocation, nullptr);
+        return AddToBatch(destination, totalSize);
+    }
+
+    void UploadManager::Submit()
+    {
+        if (!m_bIsBatchOpen)
+        {
+            return;
+        }
+
+        EG_CONFIRM(SUCCEEDED(m_CommandList->Close()));
+        m_CommandQueue->ExecuteCommandLists(1, CommandListCast(m_CommandList.GetAddressOf()));
+        EG_CONFIRM(SUCCEEDED(m_CommandQueue->Signal(m_Fence.Get(), m_NextFenceValue)));
+        m_Pages.Retire(m_NextFenceValue);
+
+        m_OpenBatch.FenceValue = m_NextFenceValue++;
+        m_InFlightSize += m_OpenBatch.SizeInBytes;
+        m_InFlightBatches.push_back(std::move(m_OpenBatch));
+        m_OpenBatch = {};
+        m_bIsBatchOpen = false;
+        ++m_Stats.SubmitCount;
+
+        // Upload하는 속도를 GPU가 따라가지 못하면 Page가 끝없이 늘어나므로 여기서만 CPU가 기다림.
+        while (m_InFlightSize > MaxInFlightBatchCount * m_MaxBatchSize)
+        {
+            ++m_Stats.WaitCount;
+            WaitForFence(m_InFlightBatches.front().FenceValue);
+            Poll();
+        }
+    }
+
+    void UploadManager::Poll()
+    {
+        const uint64_t completedFenceValue = m_Fence->GetCompletedValue();
+        while (!m_InFlightBatches.empty() && m_InFlightBatches.front().FenceValue <= completedFenceValue)
+        {
+            InFlightBatch& batch = m_InFlightBatches.front();
+            m_InFlightSize -= batch.SizeInBytes;
+            m_FreeCommandAllocators.push_back(std::move(batch.CommandAllocator));
+            m_InFlightBatches.pop_front();
+        }
+
+        // 크기가 달라 다시 쓰지 않는 Page는 여기서 해제함.
+        m_Pages.Reclaim(completedFenceValue);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_PageBuffers.size()); ++i)
+        {
+            if (m_PageBuffers[i].Resource && m_Pages.GetPageSize(i) == 0)
+            {
+                m_PageBuffers[i] = {};
+            }
+        }
+    }
+
+    void UploadManager::WaitForIdle()
+    {
+        Submit();
+        if (!m_InFlightBatches.empty())
+        {
+            WaitForFence(m_InFlightBatches.back().FenceValue);
+        }
+        Poll();
+    }
+
+    StagingPageAllocator::Allocation UploadManager::Allocate(uint64_t sizeInBytes, uint64_t alignment)
+    {
+        if (!m_bIsBatchOpen)
+        {
+            Poll();
+            if (m_FreeCommandAllocators.empty())
+            {
+                EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&m_OpenBatch.CommandAllocator))));
+            }
+            else
+            {
+                m_OpenBatch.CommandAllocator = std::move(m_FreeCommandAllocators.back());
+                m_FreeCommandAllocators.pop_back();
+            }
+            EG_CONFIRM(SUCCEEDED(m_OpenBatch.CommandAllocator->Reset()));
+            EG_CONFIRM(SUCCEEDED(m_CommandList->Reset(m_OpenBatch.CommandAllocator.Get(), nullptr)));
+            m_bIsBatchOpen = true;
+        }
+
+        const StagingPageAllocator::Allocation allocation = m_Pages.Allocate(sizeInBytes, alignment);
+        if (allocation.Page >= m_PageBuffers.size())
+        {
+            m_PageBuffers.resize(allocation.Page + 1);
+        }
+
+        PageBuffer& page = m_PageBuffers[allocation.Page];
+        if (!page.Resource)
+        {
+            const CD3DX12_HEAP_PROPERTIES uploadHeapProperty(D3D12_HEAP_TYPE_UPLOAD);
+            const D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(m_Pages.GetPageSize(allocation.Page));
+            EG_CONFIRM(SUCCEEDED(Core::GetRenderContext().GetDevice()->CreateCommittedResource(&uploadHeapProperty, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&page.Resource))));
+            page.Resource->SetName(L"UploadManagerPage");
+
+            // CPU는 읽지 않으므로 읽기 범위는 비움.
+            const CD3DX12_RANGE readRange(0, 0);
+            EG_CONFIRM(SUCCEEDED(page.Resource->Map(0, &readRange, reinterpret_cast<void**>(&page.CPUAddress))));
+        }
+        return allocation;
+    }
+
+    uint64_t UploadManager::AddToBatch(ID3D12Resource* destination, uint64_t sizeInBytes)
+    {
+        m_OpenBatch.Destinations.emplace_back(destination);
+        m_OpenBatch.SizeInBytes += sizeInBytes;
+        ++m_Stats.UploadCount;
+        m_Stats.UploadedBytes += sizeInBytes;
+
+        const uint64_t ticket = m_NextFenceValue;
+        if (m_OpenBatch.SizeInBytes >= m_MaxBatchSize)
+        {
+            Submit();
+        }
+        return ticket;
+    }
+
+    void UploadManager::WaitForFence(uint64_t fenceValue)
+    {
+        if (m_Fence->GetCompletedValue() < fenceValue)
+        {
+            EG_CONFIRM(SUCCEEDED(m_Fence->SetEventOnCompletion(fenceValue, m_FenceEvent.Get())));
+            WaitForSingleObject(m_FenceEvent.Get(), INFINITE);
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <d3d12.h>
+#include <deque>
+#include <vector>
+#include <wrl.h>
+
+#include "StagingPageAllocator.h"
+
+namespace Engine
+{
+    // Mesh와 Texture의 Upload를 Staging Page에 모아 Copy Queue에 한 번에 Submit함. Render Thread에서만 호출함.
+    //
+    // 1. Upload는 열린 Batch의 Copy Command List에 기록만 하고, 그 Batch가 Signal할 Fence 값을 Ticket으로 돌려줌.
+    // 2. Submit은 열린 Batch를 ExecuteCommandLists 한 번으로 보냄. 열린 Batch가 maxBatchSize를 넘으면 Upload하며 바로 Submit함.
+    // 3. Poll은 기다리지 않고 끝난 Batch의 Page와 Allocator만 돌려받음.
+    // 4. Resource를 쓰는 Queue는 Ticket이 끝나지 않았을 때만 GetFence를 GPU에서 Wait함. CPU는 기다리지 않음.
+    //
+    // Copy Queue는 Buffer와 Texture를 COMMON에서 COPY_DEST로 암묵적으로 바꾸고, 끝나면 다시 COMMON으로 되돌림.
+    // 따라서 대상은 COMMON으로 만들어야 하며, 다른 Queue에서는 COMMON으로 등록하여 사용함.
+    class UploadManager
+    {
+    public:
+        struct Stats
+        {
+            uint32_t UploadCount = 0;
+            uint32_t SubmitCount = 0;
+            uint64_t UploadedBytes = 0;
+            // 진행 중인 Batch가 너무 많아 CPU가 기다린 횟수.
+            uint32_t WaitCount = 0;
+        };
+
+    public:
+        UploadManager() = default;
+        UploadManager(const UploadManager&) = delete;
+        UploadManager& operator=(const UploadManager&) = delete;
+
+        void Initialize(Microsoft::WRL::ComPtr<ID3D12CommandQueue> copyCommandQueue, uint64_t pageSize, uint64_t maxBatchSize);
+
+        // 반환한 Ticket이 끝나기 전에는 destination을 읽으면 안 됨. destination은 Batch가 끝날 때까지 여기서 붙잡아 둠.
+        uint64_t UploadBuffer(ID3D12Resource* destination, uint64_t destinationOffset, const void* data, uint64_t sizeInBytes);
+        uint64_t UploadTexture(ID3D12Resource* destination, const D3D12_SUBRESOURCE_DATA& data, uint32_t subresource = 0);
+
+        void Submit();
+        void Poll();
+        // 0은 Upload하지 않은 Resource의 Ticket이므로 항상 끝난 것임.
+        bool IsComplete(uint64_t ticket) const { return ticket <= m_Fence->GetCompletedValue(); }
+        // 열린 Batch도 Submit한 뒤 모두 끝날 때까지 기다림. Resource를 해제하기 전에 호출함.
+        void WaitForIdle();
+
+        ID3D12Fence* GetFence() const { return m_Fence.Get(); }
+        const StagingPageAllocator& GetPages() const { return m_Pages; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        // Batch를 기록한 Allocator와 Copy가 끝날 때까지 붙잡아 둘 Resource.
+        struct InFlightBatch
+        {
+            uint64_t FenceValue = 0;
+            uint64_t SizeInBytes = 0;
+            Microsoft::WRL::ComPtr<ID3D12CommandAllocator> CommandAllocator = nullptr;
+            std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> Destinations;
+        };
+
+        struct PageBuffer
+        {
+            Microsoft::WRL::ComPtr<ID3D12Resource> Resource = nullptr;
+            uint8_t* CPUAddress = nullptr;
+        };
+
+        // 열린 Batch가 없으면 엶. Upload한 Data를 쓸 Page를 잘라 줌.
+        StagingPageAllocator::Allocation Allocate(uint64_t sizeInBytes, uint64_t alignment);
+        // 기록을 마친 Upload를 Batch에 넣고 Ticket을 돌려줌.
+        uint64_t AddToBatch(ID3D12Resource* destination, uint64_t sizeInBytes);
+        void WaitForFence(uint64_t fenceValue);
+
+    private:
+        Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_CommandQueue = nullptr;
+        Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_CommandList = nullptr;
+        Microsoft::WRL::ComPtr<ID3D12Fence> m_Fence = nullptr;
+        Microsoft::WRL::Wrappers::Event m_FenceEvent;
+        // 열린 Batch가 Submit할 때 Signal할 값.
+        uint64_t m_NextFenceValue = 1;
+        uint64_t m_MaxBatchSize = 0;
+
+        bool m_bIsBatchOpen = false;
+        InFlightBatch m_OpenBatch;
+        std::deque<InFlightBatch> m_InFlightBatches;
+        uint64_t m_InFlightSize = 0;
+        std::vector<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>> m_FreeCommandAllocators;
+
+        StagingPageAllocator m_Pages;
+        // StagingPageAllocator의 Page 번호 순서임.
+        std::vector<PageBuffer> m_PageBuffers;
+        Stats m_Stats;
+    };
+}
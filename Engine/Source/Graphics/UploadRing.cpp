@@ -0,0 +1,72 @@
+// UploadRingTest가 Engine 없이 Build하므로 Precompiled Header를 쓰지 않음.
+#include "UploadRing.h"
+
+#include "Core/Assert.h"
+
+namespace Engine
+{
+    UploadRing::UploadRing(uint64_t capacity)
+        : m_Capacity(capacity)
+    {
+    }
+
+    std::optional<uint64_t> UploadRing::Allocate(uint64_t sizeInBytes, uint64_t alignment)
+    {
+        EG_CONFIRM(sizeInBytes > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0);
+        const uint64_t usedSize = GetUsedSize();
+        if (usedSize == 0)
+        {
+            // 사용 중인 구간이 없으면 앞에서부터 다시 씀. 버려지는 꼬리가 줄어듦.
+            m_Head = 0;
+            m_Tail = 0;
+        }
+
+        // Head == Tail이면서 사용 중인 Byte가 있다면 가득 찬 것임.
+        const bool bHasWrapped = m_Head < m_Tail || (m_Head == m_Tail && usedSize > 0);
+        const uint64_t alignedHead = (m_Head + alignment - 1) & ~(alignment - 1);
+        uint64_t offset = alignedHead;
+        if (bHasWrapped)
+        {
+            // 빈 곳은 [Head, Tail)뿐임.
+            if (alignedHead + sizeInBytes > m_Tail)
+            {
+                return std::nullopt;
+            }
+        }
+        else if (alignedHead + sizeInBytes > m_Capacity)
+        {
+            // 끝에 맞지 않으면 [Head, Capacity)를 버리고 [0, Tail)에 넣음.
+            if (sizeInBytes > m_Tail)
+            {
+                return std::nullopt;
+            }
+            offset = 0;
+        }
+
+        const uint64_t end = offset + sizeInBytes;
+        m_AllocatedSize += offset >= m_Head ? end - m_Head : m_Capacity - m_Head + end;
+        m_Head = end == m_Capacity ? 0 : end;
+        return offset;
+    }
+
+    void UploadRing::Retire(uint64_t fenceValue)
+    {
+        const uint64_t retiredSize = m_RetiredRegions.empty() ? m_ReclaimedSize : m_RetiredRegions.back().AllocatedSize;
+        if (m_AllocatedSize == retiredSize)
+        {
+            return;
+        }
+        EG_CONFIRM(m_RetiredRegions.empty() || m_RetiredRegions.back().FenceValue < fenceValue);
+        m_RetiredRegions.push_back({.FenceValue = fenceValue, .End = m_Head, .AllocatedSize = m_AllocatedSize});
+    }
+
+    void UploadRing::Reclaim(uint64_t completedFenceValue)
+    {
+        while (!m_RetiredRegions.empty() && m_RetiredRegions.front().FenceValue <= completedFenceValue)
+        {
+            m_Tail = m_RetiredRegions.front().End;
+            m_ReclaimedSize = m_RetiredRegions.front().AllocatedSize;
+            m_RetiredRegions.pop_front();
+        }
+    }
+}
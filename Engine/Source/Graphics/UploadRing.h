@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace Engine
+{
+    // 하나의 큰 Upload Buffer를 원형으로 쓰며 앞에서부터 잘라 주는 할당기의 Offset 계산 부분.
+    // GPU Resource나 Fence를 직접 다루지 않고, 완료 여부는 호출하는 쪽이 넘기는 Fence 값으로만 판단하므로 가짜 Fence로도 검사할 수 있음.
+    //
+    // 1. Allocate로 Head에서 정렬된 구간을 잘라 줌. 끝에 맞지 않으면 남은 꼬리를 버리고 0으로 돌아감.
+    // 2. Frame을 Submit할 때 Retire로 지금까지 할당한 구간에 그 Frame의 Fence 값을 붙임.
+    // 3. Reclaim에 완료된 Fence 값을 넘기면 그 값 이하로 Retire된 구간을 다시 쓸 수 있게 됨.
+    class UploadRing
+    {
+    public:
+        explicit UploadRing(uint64_t capacity = 0);
+
+        // 자리가 없으면 std::nullopt를 반환함. alignment는 2의 거듭제곱이어야 함.
+        std::optional<uint64_t> Allocate(uint64_t sizeInBytes, uint64_t alignment);
+        // 아직 Retire하지 않은 모든 할당은 fenceValue가 완료된 뒤에 다시 쓸 수 있음. fenceValue는 증가하는 순서로 넘겨야 함.
+        void Retire(uint64_t fenceValue);
+        void Reclaim(uint64_t completedFenceValue);
+
+        bool HasRetiredRegions() const { return !m_RetiredRegions.empty(); }
+        // 가장 오래된 Retire 구간의 Fence 값. 가득 찼을 때 이 값까지 기다리면 자리가 생길 수 있음.
+        uint64_t GetOldestRetiredFenceValue() const { return m_RetiredRegions.front().FenceValue; }
+        uint64_t GetCapacity() const { return m_Capacity; }
+        // 정렬과 끝에서 버린 꼬리까지 포함하여 아직 돌려받지 못한 Byte 수.
+        uint64_t GetUsedSize() const { return m_AllocatedSize - m_ReclaimedSize; }
+
+    private:
+        struct RetiredRegion
+        {
+            uint64_t FenceValue = 0;
+            // 이 구간까지 돌려받으면 Tail이 놓이는 위치.
+            uint64_t End = 0;
+            // 이 구간까지 돌려받았을 때의 m_ReclaimedSize.
+            uint64_t AllocatedSize = 0;
+        };
+
+    private:
+        uint64_t m_Capacity = 0;
+        uint64_t m_Head = 0;
+        uint64_t m_Tail = 0;
+        // 처음부터 할당하거나 돌려받은 Byte 수의 누적. 둘의 차이가 사용 중인 크기임.
+        uint64_t m_AllocatedSize = 0;
+        uint64_t m_ReclaimedSize = 0;
+        std::deque<RetiredRegion> m_RetiredRegions;
+    };
+}
@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Core/JobSystem.h"
+#include "Graphics/FrustumCulling.h"
+#include "Graphics/OcclusionBuffer.h"
+
+// Editor의 Occlusion Culling Benchmark와 같은 장면을 Engine 없이 그려 결과를 검사하고 시간을 측정함.
+// 검사에 실패하면 1을 반환함. Depth의 Hash는 같은 Build라면 Worker 수나 실행 횟수와 관계없이 같아야 함.
+namespace
+{
+    constexpr uint32_t OccluderCount = 2'000;
+    constexpr size_t OccludeeCount = 100'000;
+    constexpr uint32_t MeasureCount = 10;
+
+    // std::uniform_real_distribution은 표준 Library마다 결과가 다르므로 mt19937의 출력을 직접 바꿈.
+    class RandomRange
+    {
+    public:
+        float operator()(float min, float max)
+        {
+            return min + (max - min) * static_cast<float>(m_Random() >> 8) * (1.0f / 16'777'216.0f);
+        }
+
+    private:
+        std::mt19937 m_Random{42};
+    };
+
+    struct Cube
+    {
+        std::vector<Engine::Vertex> Vertices;
+        std::vector<uint32_t> Indices;
+    };
+
+    Cube CreateCube()
+    {
+        Cube cube;
+        for (const float x : {-0.5f, 0.5f})
+        {
+            for (const float y : {-0.5f, 0.5f})
+            {
+                for (const float z : {-0.5f, 0.5f})
+                {
+                    cube.Vertices.push_back({.Position = {x, y, z}});
+                }
+            }
+        }
+        // Vertex Index는 x * 4 + y * 2 + z이며, 각 면의 네 Vertex를 둘레 순서로 나열함.
+        constexpr uint32_t faces[6][4] = {{0, 1, 3, 2}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 3, 7, 5}};
+        for (const auto& face : faces)
+        {
+            cube.Indices.insert(cube.Indices.end(), {face[0], face[1], face[2], face[0], face[2], face[3]});
+        }
+        return cube;
+    }
+
+    // 한 번 실행하는 데 걸린 가장 짧은 시간을 ms 단위로 반환함.
+    template <typename Function>
+    double MeasureBestMilliseconds(Function&& function)
+    {
+        std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+        for (uint32_t i = 0; i < MeasureCount; ++i)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            function();
+            bestTime = std::min(bestTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+        }
+        return std::chrono::duration<double, std::milli>(bestTime).count();
+    }
+
+    uint64_t HashDepth(const std::vector<float>& depth)
+    {
+        uint64_t hash = 14'695'981'039'346'656'037ull;
+        for (const float value : depth)
+        {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            hash = (hash ^ bits) * 1'099'511'628'211ull;
+        }
+        return hash;
+    }
+
+    // CullingBoundsSoA::Set은 FrustumCulling.cpp에 있으므로 Test는 성분 배열을 직접 채움.
+    void AddBounds(Engine::CullingBoundsSoA& bounds, const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extents)
+    {
+        bounds.CenterX.push_back(center.x);
+        bounds.CenterY.push_back(center.y);
+        bounds.CenterZ.push_back(center.z);
+        bounds.ExtentX.push_back(extents.x);
+        bounds.ExtentY.push_back(extents.y);
+        bounds.ExtentZ.push_back(extents.z);
+    }
+}
+
+int main()
+{
+    using namespace Engine;
+
+    const Cube cube = CreateCube();
+    const DirectX::SimpleMath::Matrix camera = DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 2.0f, 0.0f);
+    const DirectX::SimpleMath::Matrix projection = DirectX::SimpleMath::Matrix::CreatePerspectiveFieldOfView(DirectX::XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    const DirectX::SimpleMath::Matrix viewProjection = camera.Invert() * projection;
+    // Core가 CPU 하나인 곳에서도 Worker 하나로 실행한 결과와 비교할 수 있도록 Worker를 적어도 4개 둠.
+    JobSystem jobSystem(std::max(4u, std::thread::hardware_concurrency()));
+    bool bHasFailed = false;
+
+    // 벽 바로 뒤의 상자는 가려지고, 벽 앞이나 옆의 상자는 보여야 함.
+    OcclusionBuffer wallBuffer;
+    wallBuffer.Begin(viewProjection);
+    wallBuffer.AddOccluder(DirectX::SimpleMath::Matrix::CreateScale(10.0f, 10.0f, 1.0f) * DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 2.0f, -20.0f),
+                           cube.Vertices, cube.Indices);
+    wallBuffer.Rasterize(jobSystem);
+    const DirectX::SimpleMath::Vector3 boxExtents(1.0f);
+    if (wallBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -40.0f}, boxExtents))
+        || !wallBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -10.0f}, boxExtents))
+        || !wallBuffer.IsVisible(DirectX::BoundingBox({30.0f, 2.0f, -40.0f}, boxExtents)))
+    {
+        std::printf("FAILED: wall test\n");
+        bHasFailed = true;
+    }
+
+    // 2의 거듭제곱이 아닌 크기에서는 Hierarchical-Z의 Level 크기가 홀수가 됨. 화면을 모두 가리는 벽 뒤에서 화면 전체를 덮는 상자는
+    // 가장 작은 Level의 모든 Texel을 읽은 뒤에야 가려졌다고 판단하므로, 그 Level 밖을 읽지 않는지 확인할 수 있음.
+    OcclusionBuffer oddBuffer({.Width = 96, .Height = 48});
+    oddBuffer.Begin(viewProjection);
+    oddBuffer.AddOccluder(DirectX::SimpleMath::Matrix::CreateScale(400.0f, 400.0f, 1.0f) * DirectX::SimpleMath::Matrix::CreateTranslation(0.0f, 2.0f, -20.0f),
+                          cube.Vertices, cube.Indices);
+    oddBuffer.Rasterize(jobSystem);
+    if (oddBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -50.0f}, {200.0f, 200.0f, 1.0f}))
+        || oddBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -40.0f}, boxExtents))
+        || !oddBuffer.IsVisible(DirectX::BoundingBox({0.0f, 2.0f, -10.0f}, boxExtents)))
+    {
+        std::printf("FAILED: non power of two test\n");
+        bHasFailed = true;
+    }
+
+    // SimpleMath의 Projection은 오른손 좌표계이므로 Camera는 -Z를 바라봄. Camera 앞에 벽을 흩어 놓고, Occludee는 그 앞뒤로 넓게 놓음.
+    RandomRange randomRange;
+    std::vector<DirectX::SimpleMath::Matrix> occluderWorlds(OccluderCount);
+    for (DirectX::SimpleMath::Matrix& world : occluderWorlds)
+    {
+        const float scaleX = randomRange(8.0f, 20.0f);
+        const float scaleY = randomRange(4.0f, 12.0f);
+        const float rotationY = randomRange(-0.5f, 0.5f);
+        const float positionX = randomRange(-300.0f, 300.0f);
+        const float positionY = randomRange(0.0f, 4.0f);
+        const float positionZ = randomRange(-400.0f, -30.0f);
+        world = DirectX::SimpleMath::Matrix::CreateScale(scaleX, scaleY, 1.0f)
+            * DirectX::SimpleMath::Matrix::CreateRotationY(rotationY)
+            * DirectX::SimpleMath::Matrix::CreateTranslation(positionX, positionY, positionZ);
+    }
+    CullingBoundsSoA occludeeBounds;
+    for (size_t i = 0; i < OccludeeCount; ++i)
+    {
+        const float centerX = randomRange(-600.0f, 600.0f);
+        const float centerY = randomRange(0.0f, 5.0f);
+        const float centerZ = randomRange(-800.0f, -5.0f);
+        const float extentX = randomRange(0.5f, 2.0f);
+        const float extentY = randomRange(0.5f, 2.0f);
+        const float extentZ = randomRange(0.5f, 2.0f);
+        AddBounds(occludeeBounds, {centerX, centerY, centerZ}, {extentX, extentY, extentZ});
+    }
+    // Frustum 밖의 AABB도 IsVisible이 화면 밖으로 판단하므로 Frustum Culling 없이 모두 검사함.
+    std::vector<uint32_t> candidateIndices(OccludeeCount);
+    std::iota(candidateIndices.begin(), candidateIndices.end(), 0u);
+
+    const auto rasterize = [&](OcclusionBuffer& buffer, JobSystem& rasterizeJobSystem)
+    {
+        buffer.Begin(viewProjection);
+        for (const DirectX::SimpleMath::Matrix& world : occluderWorlds)
+        {
+            buffer.AddOccluder(world, cube.Vertices, cube.Indices);
+        }
+        buffer.Rasterize(rasterizeJobSystem);
+    };
+
+    OcclusionBuffer buffer;
+    const double rasterizeTime = MeasureBestMilliseconds([&] { rasterize(buffer, jobSystem); });
+    std::vector<uint32_t> visibleIndices;
+    const double testTime = MeasureBestMilliseconds([&] { buffer.FilterVisible(jobSystem, occludeeBounds, candidateIndices, visibleIndices); });
+
+    // Worker 수가 달라도 Depth와 결과가 Bit 단위로 같아야 함.
+    JobSystem singleWorkerJobSystem(1);
+    OcclusionBuffer referenceBuffer;
+    rasterize(referenceBuffer, singleWorkerJobSystem);
+    std::vector<uint32_t> referenceIndices;
+    referenceBuffer.FilterVisible(singleWorkerJobSystem, occludeeBounds, candidateIndices, referenceIndices);
+    if (referenceBuffer.GetDepth() != buffer.GetDepth() || referenceIndices != visibleIndices)
+    {
+        std::printf("FAILED: result depends on worker count\n");
+        bHasFailed = true;
+    }
+
+    const OcclusionBuffer::Stats& stats = buffer.GetStats();
+    std::printf("%ux%u depth, %u occluders (%u triangles, %u binned), %u workers\n", buffer.GetWidth(), buffer.GetHeight(), stats.OccluderCount,
+                stats.TriangleCount, stats.BinnedTriangleCount, jobSystem.GetWorkerCount());
+    std::printf("%12s %12s %12s\n", "Stage", "Time(ms)", "Count");
+    std::printf("%12s %12.3f %12u\n", "Rasterize", rasterizeTime, stats.TriangleCount);
+    std::printf("%12s %12.3f %12zu\n", "HiZ Test", testTime, candidateIndices.size());
+    std::printf("%12s %12s %12zu\n", "Visible", "", visibleIndices.size());
+    std::printf("Depth hash: %016llx\n", static_cast<unsigned long long>(HashDepth(buffer.GetDepth())));
+
+    std::puts(bHasFailed ? "FAILED" : "PASSED");
+    return bHasFailed ? 1 : 0;
+}
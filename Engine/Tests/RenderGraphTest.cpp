@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "Graphics/RenderGraph.h"
+
+// 256개의 Pass가 임의로 읽고 쓰는 Graph를 Device 없이 Compile하여 Culling한 Pass와 Transient Texture의 수명을 직접 구한 값과 비교하고,
+// 수명이 겹치는 Texture끼리 Heap에서 겹치지 않는지 검사함. Aliasing 전후의 크기와 처음 Compile, 재사용하는 Compile의 시간을 출력함.
+// 검사에 실패하면 1을 반환함.
+namespace
+{
+    constexpr uint32_t PassCount = 256;
+    constexpr uint32_t TextureCount = 96;
+    constexpr uint32_t ImportedCount = 4;
+    // D3D12의 기본 Resource 정렬인 64KB.
+    constexpr uint64_t PlacementAlignment = 64 * 1024;
+    constexpr uint32_t MeasureCount = 100;
+
+    struct PassPlan
+    {
+        uint32_t FirstAccess = 0;
+        uint32_t AccessCount = 0;
+        bool bHasSideEffects = false;
+    };
+
+    // 한 번 실행하는 데 걸린 가장 짧은 시간을 us 단위로 반환함.
+    template <typename Function>
+    double MeasureBestMicroseconds(Function&& function)
+    {
+        std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+        for (uint32_t i = 0; i < MeasureCount; ++i)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            function();
+            bestTime = std::min(bestTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+        }
+        return std::chrono::duration<double, std::micro>(bestTime).count();
+    }
+
+    // Device가 없으므로 Format의 Pixel 크기로 AllocationInfo를 흉내 냄.
+    Engine::RenderGraphAllocationInfo GetAllocationInfo(const Engine::RenderGraphTextureDesc& desc)
+    {
+        const uint64_t bytesPerPixel = desc.Format == DXGI_FORMAT_R16G16B16A16_FLOAT ? 8 : 4;
+        const uint64_t size = static_cast<uint64_t>(desc.Width) * desc.Height * bytesPerPixel;
+        return {(size + PlacementAlignment - 1) & ~(PlacementAlignment - 1), PlacementAlignment};
+    }
+}
+
+int main()
+{
+    using namespace Engine;
+
+    // 임의의 Pass가 앞에서 쓴 Resource를 읽고 새 Transient Texture나 기존 Resource에 쓰는 Graph를 만듦.
+    // Import한 Resource에 쓰거나 Side Effect가 있는 Pass에서 "가장 최근에 쓴 Pass" 의존을 거꾸로 따라가 닿는 Pass만 살아 있어야 함.
+    constexpr uint32_t widths[] = {256, 512, 1024, 2048};
+    constexpr DXGI_FORMAT colorFormats[] = {DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R16G16B16A16_FLOAT};
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> percentDistribution(0, 99);
+
+    std::vector<RenderGraphTextureDesc> textureDescs(TextureCount);
+    for (RenderGraphTextureDesc& desc : textureDescs)
+    {
+        desc.Width = widths[std::uniform_int_distribution<size_t>(0, std::size(widths) - 1)(random)];
+        desc.Height = desc.Width / 2;
+        if (percentDistribution(random) < 20)
+        {
+            desc.Format = DXGI_FORMAT_D32_FLOAT;
+            desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+        }
+        else
+        {
+            desc.Format = colorFormats[percentDistribution(random) % std::size(colorFormats)];
+            desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+        }
+    }
+
+    // Resource Index는 Import한 것이 먼저이고 그 뒤가 Transient Texture임.
+    constexpr uint32_t resourceCount = ImportedCount + TextureCount;
+    std::vector<RenderGraphAccess> accesses;
+    std::vector<PassPlan> passes(PassCount);
+    std::vector<uint32_t> writtenResources;
+    for (uint32_t i = 0; i < ImportedCount; ++i)
+    {
+        writtenResources.push_back(i);
+    }
+    uint32_t nextTexture = ImportedCount;
+    for (PassPlan& pass : passes)
+    {
+        pass.FirstAccess = static_cast<uint32_t>(accesses.size());
+        pass.bHasSideEffects = percentDistribution(random) < 3;
+        const uint32_t readCount = std::uniform_int_distribution<uint32_t>(0, 3)(random);
+        for (uint32_t i = 0; i < readCount; ++i)
+        {
+            const uint32_t resource = writtenResources[std::uniform_int_distribution<size_t>(0, writtenResources.size() - 1)(random)];
+            accesses.push_back(RenderGraph::Read({resource}));
+        }
+
+        const uint32_t writeCount = std::uniform_int_distribution<uint32_t>(1, 2)(random);
+        for (uint32_t i = 0; i < writeCount; ++i)
+        {
+            const uint32_t percent = percentDistribution(random);
+            uint32_t resource = 0;
+            if (percent < 8)
+            {
+                resource = std::uniform_int_distribution<uint32_t>(0, ImportedCount - 1)(random);
+            }
+            else if (percent < 50 && nextTexture < resourceCount)
+            {
+                resource = nextTexture++;
+                writtenResources.push_back(resource);
+            }
+            else
+            {
+                resource = writtenResources[std::uniform_int_distribution<size_t>(0, writtenResources.size() - 1)(random)];
+            }
+            const bool bIsDepthStencil = resource >= ImportedCount && textureDescs[resource - ImportedCount].Flags == D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+            accesses.push_back(RenderGraph::Write({resource}, bIsDepthStencil ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_RENDER_TARGET));
+        }
+        pass.AccessCount = static_cast<uint32_t>(accesses.size()) - pass.FirstAccess;
+    }
+
+    // Import한 Resource의 Pointer는 Graph의 구조가 아니므로 importSeed가 달라도 Compile을 재사용해야 함.
+    const auto buildGraph = [&](RenderGraph& graph, uintptr_t importSeed)
+    {
+        graph.Reset();
+        for (uint32_t i = 0; i < ImportedCount; ++i)
+        {
+            graph.ImportTexture(reinterpret_cast<ID3D12Resource*>((importSeed + i + 1) * 64));
+        }
+        for (const RenderGraphTextureDesc& desc : textureDescs)
+        {
+            graph.CreateTexture(desc);
+        }
+        for (const PassPlan& pass : passes)
+        {
+            graph.AddPass("Pass", std::span(accesses).subspan(pass.FirstAccess, pass.AccessCount), nullptr, pass.bHasSideEffects);
+        }
+    };
+
+    bool bHasFailed = false;
+    RenderGraph graph;
+    buildGraph(graph, 0);
+    graph.Compile(GetAllocationInfo);
+
+    // 각 Pass가 읽는 Resource를 마지막으로 쓴 Pass에 의존함.
+    std::vector<std::vector<uint32_t>> dependencies(PassCount);
+    std::vector<uint32_t> lastWriters(resourceCount, UINT32_MAX);
+    std::vector<uint32_t> pendingPasses;
+    for (uint32_t passIndex = 0; passIndex < PassCount; ++passIndex)
+    {
+        bool bIsRoot = passes[passIndex].bHasSideEffects;
+        for (const RenderGraphAccess& access : graph.GetPassAccesses(passIndex))
+        {
+            if (!access.bIsWrite && lastWriters[access.Resource.Index] != UINT32_MAX)
+            {
+                dependencies[passIndex].push_back(lastWriters[access.Resource.Index]);
+            }
+        }
+        for (const RenderGraphAccess& access : graph.GetPassAccesses(passIndex))
+        {
+            if (access.bIsWrite)
+            {
+                lastWriters[access.Resource.Index] = passIndex;
+                bIsRoot |= access.Resource.Index < ImportedCount;
+            }
+        }
+        if (bIsRoot)
+        {
+            pendingPasses.push_back(passIndex);
+        }
+    }
+    std::vector<uint8_t> bIsExpectedAlive(PassCount, 0);
+    while (!pendingPasses.empty())
+    {
+        const uint32_t passIndex = pendingPasses.back();
+        pendingPasses.pop_back();
+        if (!bIsExpectedAlive[passIndex])
+        {
+            bIsExpectedAlive[passIndex] = 1;
+            pendingPasses.insert(pendingPasses.end(), dependencies[passIndex].begin(), dependencies[passIndex].end());
+        }
+    }
+    for (uint32_t passIndex = 0; passIndex < PassCount; ++passIndex)
+    {
+        if (graph.IsPassCulled(passIndex) == static_cast<bool>(bIsExpectedAlive[passIndex]))
+        {
+            std::printf("FAILED: pass %u should %s\n", passIndex, bIsExpectedAlive[passIndex] ? "run" : "be culled");
+            bHasFailed = true;
+        }
+    }
+
+    // 살아 있는 Pass의 실행 순서로 각 Transient Texture의 수명을 다시 구해 비교함.
+    std::vector<uint32_t> firstPasses(resourceCount, UINT32_MAX);
+    std::vector<uint32_t> lastPasses(resourceCount, 0);
+    uint32_t position = 0;
+    for (uint32_t passIndex = 0; passIndex < PassCount; ++passIndex)
+    {
+        if (graph.IsPassCulled(passIndex))
+        {
+            continue;
+        }
+        for (const RenderGraphAccess& access : graph.GetPassAccesses(passIndex))
+        {
+            firstPasses[access.Resource.Index] = std::min(firstPasses[access.Resource.Index], position);
+            lastPasses[access.Resource.Index] = position;
+        }
+        ++position;
+    }
+    const std::span<const RenderGraph::TransientTexture> transientTextures = graph.GetTransientTextures();
+    for (uint32_t resource = ImportedCount; resource < resourceCount; ++resource)
+    {
+        const uint32_t transientIndex = graph.GetTransientIndex({resource});
+        if (firstPasses[resource] == UINT32_MAX)
+        {
+            if (transientIndex != RenderGraphResource::InvalidIndex)
+            {
+                std::printf("FAILED: resource %u is only used by culled passes but has a transient texture\n", resource);
+                bHasFailed = true;
+            }
+            continue;
+        }
+        if (transientIndex >= transientTextures.size())
+        {
+            std::printf("FAILED: resource %u is used by a running pass but has no transient texture\n", resource);
+            bHasFailed = true;
+            continue;
+        }
+        const RenderGraph::TransientTexture& texture = transientTextures[transientIndex];
+        if (texture.Resource.Index != resource || texture.FirstPass != firstPasses[resource] || texture.LastPass != lastPasses[resource])
+        {
+            std::printf("FAILED: resource %u lives [%u, %u] but should live [%u, %u]\n", resource, texture.FirstPass, texture.LastPass, firstPasses[resource],
+                        lastPasses[resource]);
+            bHasFailed = true;
+        }
+    }
+
+    // 수명이 겹치는 Texture끼리는 Memory가 겹치면 안 되고, Memory가 겹치는 Texture는 Aliasing Barrier가 필요함.
+    const RenderGraph::Stats stats = graph.GetStats();
+    for (const RenderGraph::TransientTexture& texture : transientTextures)
+    {
+        if (texture.HeapOffset % texture.Alignment != 0 || texture.HeapOffset + texture.SizeInBytes > stats.HeapSize)
+        {
+            std::printf("FAILED: resource %u is misaligned or outside the heap\n", texture.Resource.Index);
+            bHasFailed = true;
+        }
+        bool bIsAliased = false;
+        for (const RenderGraph::TransientTexture& other : transientTextures)
+        {
+            if (&texture == &other)
+            {
+                continue;
+            }
+            const bool bIsLifetimeOverlapped = texture.FirstPass <= other.LastPass && other.FirstPass <= texture.LastPass;
+            const bool bIsMemoryOverlapped = texture.HeapOffset < other.HeapOffset + other.SizeInBytes && other.HeapOffset < texture.HeapOffset + texture.SizeInBytes;
+            if (bIsLifetimeOverlapped && bIsMemoryOverlapped)
+            {
+                std::printf("FAILED: resources %u and %u are alive at the same time and overlap in the heap\n", texture.Resource.Index, other.Resource.Index);
+                bHasFailed = true;
+            }
+            bIsAliased |= bIsMemoryOverlapped;
+        }
+        if (texture.bIsAliased != bIsAliased)
+        {
+            std::printf("FAILED: resource %u should %s an aliasing barrier\n", texture.Resource.Index, bIsAliased ? "need" : "not need");
+            bHasFailed = true;
+        }
+    }
+    if (stats.HeapSize > stats.TransientSize)
+    {
+        std::printf("FAILED: aliased heap is larger than the textures placed one after another\n");
+        bHasFailed = true;
+    }
+
+    // 구조가 같으면 Compile을 건너뛰고, Texture 하나의 크기만 바뀌어도 다시 Compile해야 함.
+    const uint64_t compileVersion = graph.GetCompileVersion();
+    buildGraph(graph, 1'000);
+    graph.Compile(GetAllocationInfo);
+    if (!graph.GetStats().bWasCached || graph.GetCompileVersion() != compileVersion)
+    {
+        std::printf("FAILED: changing only imported pointers recompiled the graph\n");
+        bHasFailed = true;
+    }
+    textureDescs[0].Width *= 2;
+    buildGraph(graph, 0);
+    graph.Compile(GetAllocationInfo);
+    if (graph.GetStats().bWasCached || graph.GetCompileVersion() != compileVersion + 1)
+    {
+        std::printf("FAILED: changing a texture size did not recompile the graph\n");
+        bHasFailed = true;
+    }
+    textureDescs[0].Width /= 2;
+
+    const double coldTime = MeasureBestMicroseconds([&]
+    {
+        RenderGraph coldGraph;
+        buildGraph(coldGraph, 0);
+        coldGraph.Compile(GetAllocationInfo);
+    });
+    const double cachedTime = MeasureBestMicroseconds([&]
+    {
+        buildGraph(graph, 0);
+        graph.Compile(GetAllocationInfo);
+    });
+
+    std::printf("%u passes (%u culled), %zu transient textures\n", stats.PassCount, stats.CulledPassCount, graph.GetTransientTextures().size());
+    std::printf("%20s %20s %18s %18s\n", "Transient Size(MB)", "Aliased Heap(MB)", "Cold Compile(us)", "Cached Compile(us)");
+    std::printf("%20.2f %20.2f %18.2f %18.2f\n", stats.TransientSize / (1024.0 * 1024.0), stats.HeapSize / (1024.0 * 1024.0), coldTime, cachedTime);
+
+    std::puts(bHasFailed ? "FAILED" : "PASSED");
+    return bHasFailed ? 1 : 0;
+}
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "Graphics/ResourceStateTracker.h"
+
+// 64개의 Resource를 100k개의 Pass가 임의의 State로 쓸 때 ResourceStateTracker가 만든 Barrier를 Device 없이 검사함.
+// Transition마다 Barrier를 바로 기록하는 경우와 Barrier 수, ResourceBarrier 호출 수를 비교함. 검사에 실패하면 1을 반환함.
+namespace
+{
+    constexpr uint32_t ResourceCount = 64;
+    constexpr uint32_t MaximumMipCount = 10;
+    constexpr size_t PassCount = 100'000;
+    constexpr uint32_t MeasureCount = 10;
+
+    struct Usage
+    {
+        uint32_t Resource = 0;
+        uint32_t Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        D3D12_RESOURCE_STATES State = D3D12_RESOURCE_STATE_COMMON;
+    };
+
+    struct Pass
+    {
+        size_t FirstUsage = 0;
+        size_t UsageCount = 0;
+        bool bHasDraw = true;
+    };
+
+    // 한 번 실행하는 데 걸린 가장 짧은 시간을 ns 단위로 반환함.
+    template <typename Function>
+    double MeasureBestNanoseconds(Function&& function)
+    {
+        std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+        for (uint32_t i = 0; i < MeasureCount; ++i)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            function();
+            bestTime = std::min(bestTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+        }
+        return static_cast<double>(bestTime.count());
+    }
+}
+
+int main()
+{
+    using namespace Engine;
+
+    // Pass마다 임의의 Resource를 임의의 State로 쓰겠다고 알리고, Draw가 있는 Pass만 Flush함.
+    // Flush한 Barrier를 그림자 State에 적용하며 StateBefore가 맞는지, Flush 뒤의 State가 요청한 State와 같은지 확인함.
+    // 비교 대상은 Transition마다 바로 Flush하는, 즉 Barrier를 하나씩 기록하던 방식임.
+    constexpr D3D12_RESOURCE_STATES states[] = {
+        D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+        D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+        D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COPY_DEST,
+    };
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> mipCountDistribution(1, MaximumMipCount);
+    std::uniform_int_distribution<uint32_t> resourceDistribution(0, ResourceCount - 1);
+    std::uniform_int_distribution<size_t> stateDistribution(0, std::size(states) - 1);
+    std::uniform_int_distribution<uint32_t> usageCountDistribution(1, 4);
+    std::uniform_int_distribution<uint32_t> percentDistribution(0, 99);
+
+    // Tracker는 Pointer를 Key로만 쓰므로 가짜 주소를 사용함.
+    std::vector<ID3D12Resource*> resources(ResourceCount);
+    std::vector<uint32_t> subresourceCounts(ResourceCount);
+    for (uint32_t i = 0; i < ResourceCount; ++i)
+    {
+        resources[i] = reinterpret_cast<ID3D12Resource*>(static_cast<uintptr_t>(i + 1) * 64);
+        subresourceCounts[i] = mipCountDistribution(random);
+    }
+    const auto findResource = [](ID3D12Resource* resource)
+    {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(resource) / 64 - 1);
+    };
+
+    std::vector<Usage> usages;
+    std::vector<Pass> passes(PassCount);
+    for (Pass& pass : passes)
+    {
+        pass.FirstUsage = usages.size();
+        pass.UsageCount = usageCountDistribution(random);
+        pass.bHasDraw = percentDistribution(random) >= 30;
+        for (size_t i = 0; i < pass.UsageCount; ++i)
+        {
+            Usage& usage = usages.emplace_back();
+            usage.Resource = resourceDistribution(random);
+            usage.State = states[stateDistribution(random)];
+            if (subresourceCounts[usage.Resource] > 1 && percentDistribution(random) < 25)
+            {
+                usage.Subresource = std::uniform_int_distribution<uint32_t>(0, subresourceCounts[usage.Resource] - 1)(random);
+            }
+        }
+    }
+
+    const auto registerResources = [&](ResourceStateTracker& tracker)
+    {
+        for (uint32_t i = 0; i < ResourceCount; ++i)
+        {
+            tracker.Register(resources[i], subresourceCounts[i], D3D12_RESOURCE_STATE_COMMON);
+        }
+    };
+
+    // 요청한 State와, Flush한 Barrier만 적용한 그림자 State.
+    std::vector<std::vector<D3D12_RESOURCE_STATES>> requestedStates(ResourceCount);
+    std::vector<std::vector<D3D12_RESOURCE_STATES>> appliedStates(ResourceCount);
+    for (uint32_t i = 0; i < ResourceCount; ++i)
+    {
+        requestedStates[i].assign(subresourceCounts[i], D3D12_RESOURCE_STATE_COMMON);
+        appliedStates[i].assign(subresourceCounts[i], D3D12_RESOURCE_STATE_COMMON);
+    }
+
+    bool bHasFailed = false;
+    ResourceStateTracker batchedTracker;
+    ResourceStateTracker immediateTracker;
+    registerResources(batchedTracker);
+    registerResources(immediateTracker);
+    for (size_t passIndex = 0; passIndex < passes.size() && !bHasFailed; ++passIndex)
+    {
+        const Pass& pass = passes[passIndex];
+        for (size_t i = pass.FirstUsage; i < pass.FirstUsage + pass.UsageCount; ++i)
+        {
+            const Usage& usage = usages[i];
+            batchedTracker.Transition(resources[usage.Resource], usage.State, usage.Subresource);
+            immediateTracker.Transition(resources[usage.Resource], usage.State, usage.Subresource);
+            immediateTracker.Flush();
+
+            std::vector<D3D12_RESOURCE_STATES>& requested = requestedStates[usage.Resource];
+            if (usage.Subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+            {
+                std::fill(requested.begin(), requested.end(), usage.State);
+            }
+            else
+            {
+                requested[usage.Subresource] = usage.State;
+            }
+        }
+        if (!pass.bHasDraw)
+        {
+            continue;
+        }
+
+        for (const D3D12_RESOURCE_BARRIER& barrier : batchedTracker.Flush())
+        {
+            const D3D12_RESOURCE_TRANSITION_BARRIER& transition = barrier.Transition;
+            std::vector<D3D12_RESOURCE_STATES>& applied = appliedStates[findResource(transition.pResource)];
+            if (transition.StateBefore == transition.StateAfter)
+            {
+                std::printf("FAILED: pass %zu flushed a barrier that does not change the state\n", passIndex);
+                bHasFailed = true;
+            }
+            for (uint32_t subresource = 0; subresource < applied.size(); ++subresource)
+            {
+                if (transition.Subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES || transition.Subresource == subresource)
+                {
+                    if (applied[subresource] != transition.StateBefore)
+                    {
+                        std::printf("FAILED: pass %zu flushed a barrier whose StateBefore does not match resource %u subresource %u\n", passIndex,
+                                    findResource(transition.pResource), subresource);
+                        bHasFailed = true;
+                    }
+                    applied[subresource] = transition.StateAfter;
+                }
+            }
+        }
+        if (appliedStates != requestedStates)
+        {
+            std::printf("FAILED: states after pass %zu differ from the requested states\n", passIndex);
+            bHasFailed = true;
+        }
+    }
+
+    // Usage 하나를 Tracker에 알리는 비용. Flush는 Draw가 있는 Pass마다 함.
+    ResourceStateTracker timedTracker;
+    registerResources(timedTracker);
+    const double transitionTime = MeasureBestNanoseconds([&]
+    {
+        for (const Pass& pass : passes)
+        {
+            for (size_t i = pass.FirstUsage; i < pass.FirstUsage + pass.UsageCount; ++i)
+            {
+                timedTracker.Transition(resources[usages[i].Resource], usages[i].State, usages[i].Subresource);
+            }
+            if (pass.bHasDraw)
+            {
+                timedTracker.Flush();
+            }
+        }
+    });
+
+    const ResourceStateTracker::Stats& immediateStats = immediateTracker.GetStats();
+    const ResourceStateTracker::Stats& batchedStats = batchedTracker.GetStats();
+    std::printf("%u resources, %zu passes, %zu transitions, %.2f ns per transition\n", ResourceCount, PassCount, usages.size(),
+                transitionTime / usages.size());
+    std::printf("%10s %12s %22s\n", "Mode", "Barriers", "ResourceBarrier Calls");
+    std::printf("%10s %12u %22u\n", "Immediate", immediateStats.BarrierCount, immediateStats.FlushCount);
+    std::printf("%10s %12u %22u\n", "Batched", batchedStats.BarrierCount, batchedStats.FlushCount);
+
+    std::puts(bHasFailed ? "FAILED" : "PASSED");
+    return bHasFailed ? 1 : 0;
+}
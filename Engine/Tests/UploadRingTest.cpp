@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <random>
+
+#include "Graphics/UploadRing.h"
+
+// 가짜 Fence로 GPU가 몇 Frame 늦게 끝나는 상황을 흉내 내며 UploadRing에 할당하고, 아직 GPU가 읽을 수 있는 구간과 겹치지 않는지 검사함.
+// 256 Byte Constant 하나를 할당하는 시간도 측정함. 검사에 실패하면 1을 반환함.
+namespace
+{
+    constexpr uint64_t RingCapacity = 1024 * 1024;
+    constexpr uint32_t FrameCount = 10'000;
+    constexpr uint32_t GPULatency = 2;
+    constexpr size_t ConstantCount = 1'000'000;
+    constexpr size_t ConstantsPerFrame = 1'000;
+    constexpr uint32_t MeasureCount = 10;
+
+    struct LiveAllocation
+    {
+        uint64_t FenceValue = 0;
+        uint64_t Offset = 0;
+        uint64_t Size = 0;
+    };
+
+    // 한 번 실행하는 데 걸린 가장 짧은 시간을 ns 단위로 반환함.
+    template <typename Function>
+    double MeasureBestNanoseconds(Function&& function)
+    {
+        std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+        for (uint32_t i = 0; i < MeasureCount; ++i)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            function();
+            bestTime = std::min(bestTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+        }
+        return static_cast<double>(bestTime.count());
+    }
+}
+
+int main()
+{
+    using namespace Engine;
+
+    // Renderer처럼 Frame마다 할당하고 Retire하며, 가짜 GPU는 GPULatency Frame 늦게 Fence를 완료함.
+    // 가득 차면 Renderer::AllocateUpload처럼 가장 오래된 Frame을 기다린 것으로 치고 다시 시도함.
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> allocationCountDistribution(1, 48);
+    std::uniform_int_distribution<uint64_t> sizeDistribution(1, 32 * 1024);
+    constexpr uint64_t alignments[] = {4, 16, 256};
+    std::uniform_int_distribution<size_t> alignmentDistribution(0, std::size(alignments) - 1);
+
+    UploadRing ring(RingCapacity);
+    std::deque<LiveAllocation> liveAllocations;
+    uint64_t completedFenceValue = 0;
+    size_t allocationCount = 0;
+    size_t waitCount = 0;
+    size_t overflowCount = 0;
+    bool bHasFailed = false;
+    const auto completeFence = [&](uint64_t fenceValue)
+    {
+        completedFenceValue = std::max(completedFenceValue, fenceValue);
+        ring.Reclaim(completedFenceValue);
+        while (!liveAllocations.empty() && liveAllocations.front().FenceValue <= completedFenceValue)
+        {
+            liveAllocations.pop_front();
+        }
+    };
+
+    for (uint64_t fenceValue = 1; fenceValue <= FrameCount && !bHasFailed; ++fenceValue)
+    {
+        if (fenceValue > GPULatency)
+        {
+            completeFence(fenceValue - GPULatency);
+        }
+
+        const uint32_t frameAllocationCount = allocationCountDistribution(random);
+        for (uint32_t i = 0; i < frameAllocationCount && !bHasFailed; ++i)
+        {
+            const uint64_t size = sizeDistribution(random);
+            const uint64_t alignment = alignments[alignmentDistribution(random)];
+            std::optional<uint64_t> offset = ring.Allocate(size, alignment);
+            while (!offset && ring.HasRetiredRegions())
+            {
+                ++waitCount;
+                completeFence(ring.GetOldestRetiredFenceValue());
+                offset = ring.Allocate(size, alignment);
+            }
+            if (!offset)
+            {
+                ++overflowCount;
+                continue;
+            }
+
+            // 아직 GPU가 읽을 수 있는 구간과 겹치면 안 됨.
+            ++allocationCount;
+            if (*offset % alignment != 0 || *offset + size > ring.GetCapacity())
+            {
+                std::printf("FAILED: allocation at %llu (size %llu, alignment %llu) is misaligned or out of range\n",
+                            static_cast<unsigned long long>(*offset), static_cast<unsigned long long>(size), static_cast<unsigned long long>(alignment));
+                bHasFailed = true;
+            }
+            for (const LiveAllocation& live : liveAllocations)
+            {
+                if (*offset < live.Offset + live.Size && live.Offset < *offset + size)
+                {
+                    std::printf("FAILED: allocation at %llu overlaps a region of frame %llu still in flight\n", static_cast<unsigned long long>(*offset),
+                                static_cast<unsigned long long>(live.FenceValue));
+                    bHasFailed = true;
+                    break;
+                }
+            }
+            liveAllocations.push_back({fenceValue, *offset, size});
+        }
+        ring.Retire(fenceValue);
+    }
+    completeFence(FrameCount);
+    if (ring.GetUsedSize() != 0)
+    {
+        std::printf("FAILED: %llu bytes still in use after every fence completed\n", static_cast<unsigned long long>(ring.GetUsedSize()));
+        bHasFailed = true;
+    }
+
+    // 256 Byte Constant를 할당하는 비용. Frame마다 ConstantsPerFrame개를 할당하고 바로 다음 Frame에 완료된 것으로 침.
+    UploadRing constantRing(RingCapacity);
+    uint64_t constantFenceValue = 0;
+    size_t constantFailureCount = 0;
+    const double constantTime = MeasureBestNanoseconds([&]
+    {
+        for (size_t i = 0; i < ConstantCount; ++i)
+        {
+            constantFailureCount += !constantRing.Allocate(256, 256);
+            if ((i + 1) % ConstantsPerFrame == 0)
+            {
+                constantRing.Retire(++constantFenceValue);
+                constantRing.Reclaim(constantFenceValue - 1);
+            }
+        }
+    });
+    if (constantFailureCount != 0)
+    {
+        std::printf("FAILED: %zu constant allocations did not fit\n", constantFailureCount);
+        bHasFailed = true;
+    }
+
+    std::printf("%llu KB ring, %u frames, GPU latency %u frames\n", static_cast<unsigned long long>(RingCapacity / 1024), FrameCount, GPULatency);
+    std::printf("%12s %10s %10s %22s\n", "Allocations", "Waits", "Overflows", "Constant Alloc(ns)");
+    std::printf("%12zu %10zu %10zu %22.2f\n", allocationCount, waitCount, overflowCount, constantTime / ConstantCount);
+
+    std::puts(bHasFailed ? "FAILED" : "PASSED");
+    return bHasFailed ? 1 : 0;
+}
@@ -0,0 +1,210 @@
+// Scene과 Component의 Header는 Engine의 Precompiled Header가 먼저 Include되어 있다고 가정하므로 같은 Header를 먼저 Include함.
+#include "EnginePCH.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Core/JobSystem.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "ECS/WorldPartition.h"
+
+// 격자 모양의 World를 Cell로 나눈 뒤 정해진 경로로 Camera를 움직이며 WorldPartition::Update를 반복함.
+// Update 시간과 Budget 초과 여부를 출력하고, 멈춘 뒤에는 LoadRadius 안의 Cell이 모두 올라왔는지 검사함. 검사에 실패하면 1을 반환함.
+namespace
+{
+    constexpr int32_t WorldCellCount = 16;
+    constexpr uint32_t EntitiesPerCell = 2'000;
+    // Camera 주변에 필요한 Cell보다 조금 많은 정도로만 Budget을 주어 먼 Cell을 내리는 경로도 지나가게 함.
+    constexpr uint64_t BudgetInCells = 32;
+    constexpr float CameraSpeedPerFrame = 4.0f;
+    constexpr uint32_t MaxSettleFrameCount = 10'000;
+
+    // 절반은 Root, 나머지는 바로 앞 Root의 자식인 Entity를 Cell마다 채움.
+    void PopulateGridWorld(Engine::Scene& scene, float cellSize)
+    {
+        using namespace Engine;
+
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> offsetDistribution(0.0f, cellSize);
+        entt::registry& registry = scene.GetRegistry();
+        for (int32_t cellZ = 0; cellZ < WorldCellCount; ++cellZ)
+        {
+            for (int32_t cellX = 0; cellX < WorldCellCount; ++cellX)
+            {
+                entt::entity root = entt::null;
+                for (uint32_t i = 0; i < EntitiesPerCell; ++i)
+                {
+                    const entt::entity entity = registry.create();
+                    registry.emplace<DisplayNameComponent>(entity, std::format("Cell_{}_{}_{}", cellX, cellZ, i));
+                    if (i % 2 == 0)
+                    {
+                        const DirectX::SimpleMath::Vector3 position{static_cast<float>(cellX) * cellSize + offsetDistribution(random), 0.0f,
+                                                                    static_cast<float>(cellZ) * cellSize + offsetDistribution(random)};
+                        registry.emplace<TransformComponent>(entity, TransformComponent{.Position = position});
+                        root = entity;
+                    }
+                    else
+                    {
+                        registry.emplace<TransformComponent>(entity, TransformComponent{.Position = {0.0f, 1.0f, 0.0f}});
+                        scene.SetParent(entity, root);
+                    }
+                    if (i % 16 == 0)
+                    {
+                        registry.emplace<LightComponent>(entity);
+                    }
+                }
+            }
+        }
+    }
+
+    // World의 대각선을 따라 갔다가 가장자리를 돌아 처음 자리로 돌아오는 경로.
+    std::vector<DirectX::SimpleMath::Vector3> MakeCameraPath(float cellSize)
+    {
+        const float worldSize = static_cast<float>(WorldCellCount) * cellSize;
+        const DirectX::SimpleMath::Vector3 corners[] = {
+            {cellSize * 0.5f, 0.0f, cellSize * 0.5f},
+            {worldSize - cellSize * 0.5f, 0.0f, worldSize - cellSize * 0.5f},
+            {worldSize - cellSize * 0.5f, 0.0f, cellSize * 0.5f},
+            {cellSize * 0.5f, 0.0f, cellSize * 0.5f},
+        };
+
+        std::vector<DirectX::SimpleMath::Vector3> path;
+        for (size_t i = 0; i + 1 < std::size(corners); ++i)
+        {
+            const float length = DirectX::SimpleMath::Vector3::Distance(corners[i], corners[i + 1]);
+            const auto stepCount = static_cast<uint32_t>(length / CameraSpeedPerFrame);
+            for (uint32_t step = 0; step < stepCount; ++step)
+            {
+                path.push_back(DirectX::SimpleMath::Vector3::Lerp(corners[i], corners[i + 1], static_cast<float>(step) / static_cast<float>(stepCount)));
+            }
+        }
+        path.push_back(corners[std::size(corners) - 1]);
+        return path;
+    }
+}
+
+int main()
+{
+    using namespace Engine;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "WorldPartitionTest";
+    WorldPartition::Settings settings{};
+    JobSystem jobSystem(std::max(4u, std::thread::hardware_concurrency()));
+
+    Scene scene;
+    PopulateGridWorld(scene, settings.CellSize);
+    std::vector<entt::entity> partitionedEntities;
+    if (!WorldPartition::Build(scene, directory, settings.CellSize, {}, partitionedEntities))
+    {
+        std::printf("FAILED: could not build %s\n", directory.string().c_str());
+        return 1;
+    }
+    scene.DestroyEntities(partitionedEntities);
+
+    uint64_t totalBytes = 0;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+    {
+        totalBytes += entry.file_size(error);
+    }
+    const uint64_t cellCount = static_cast<uint64_t>(WorldCellCount) * WorldCellCount;
+    settings.MemoryBudgetInBytes = totalBytes / cellCount * BudgetInCells;
+
+    double totalUpdateMilliseconds = 0.0;
+    double maxUpdateMilliseconds = 0.0;
+    uint32_t peakResidentCellCount = 0;
+    uint64_t peakCommittedBytes = 0;
+    uint32_t budgetViolationCount = 0;
+    uint32_t settleFrameCount = 0;
+    bool bHasFailed = false;
+    {
+        WorldPartition worldPartition(scene, jobSystem, directory, settings);
+        const auto update = [&](const DirectX::SimpleMath::Vector3& cameraPosition)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            worldPartition.Update(cameraPosition);
+            const double updateMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            totalUpdateMilliseconds += updateMilliseconds;
+            maxUpdateMilliseconds = std::max(maxUpdateMilliseconds, updateMilliseconds);
+
+            const WorldPartition::Stats& stats = worldPartition.GetStats();
+            peakResidentCellCount = std::max(peakResidentCellCount, stats.ResidentCellCount);
+            peakCommittedBytes = std::max(peakCommittedBytes, stats.CommittedBytes);
+            budgetViolationCount += stats.CommittedBytes > settings.MemoryBudgetInBytes;
+        };
+
+        const std::vector<DirectX::SimpleMath::Vector3> cameraPath = MakeCameraPath(settings.CellSize);
+        for (const DirectX::SimpleMath::Vector3& cameraPosition : cameraPath)
+        {
+            update(cameraPosition);
+        }
+
+        // Background Job이 끝날 때까지 마지막 위치에서 Update를 반복함.
+        const DirectX::SimpleMath::Vector3 finalPosition = cameraPath.back();
+        for (; settleFrameCount < MaxSettleFrameCount; ++settleFrameCount)
+        {
+            update(finalPosition);
+            const WorldPartition::Stats& stats = worldPartition.GetStats();
+            if (stats.LoadingCellCount == 0 && stats.ActivatingCellCount == 0 && stats.UnloadingCellCount == 0)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (settleFrameCount == MaxSettleFrameCount)
+        {
+            std::printf("FAILED: streaming did not settle within %u frames\n", MaxSettleFrameCount);
+            bHasFailed = true;
+        }
+
+        const auto finalCellX = static_cast<int32_t>(std::floor(finalPosition.x / settings.CellSize));
+        const auto finalCellZ = static_cast<int32_t>(std::floor(finalPosition.z / settings.CellSize));
+        const auto reach = static_cast<int32_t>(std::ceil(settings.LoadRadius / settings.CellSize));
+        for (int32_t cellZ = finalCellZ - reach; cellZ <= finalCellZ + reach; ++cellZ)
+        {
+            for (int32_t cellX = finalCellX - reach; cellX <= finalCellX + reach; ++cellX)
+            {
+                if (cellX < 0 || cellZ < 0 || cellX >= WorldCellCount || cellZ >= WorldCellCount)
+                {
+                    continue;
+                }
+
+                const float minX = static_cast<float>(cellX) * settings.CellSize;
+                const float minZ = static_cast<float>(cellZ) * settings.CellSize;
+                const float dx = std::max({minX - finalPosition.x, 0.0f, finalPosition.x - (minX + settings.CellSize)});
+                const float dz = std::max({minZ - finalPosition.z, 0.0f, finalPosition.z - (minZ + settings.CellSize)});
+                if (std::sqrt(dx * dx + dz * dz) <= settings.LoadRadius && worldPartition.GetCellState(cellX, cellZ) != WorldPartition::CellState::Resident)
+                {
+                    std::printf("FAILED: cell (%d, %d) is not resident\n", cellX, cellZ);
+                    bHasFailed = true;
+                }
+            }
+        }
+        if (budgetViolationCount > 0)
+        {
+            std::printf("FAILED: committed memory went over budget in %u frames\n", budgetViolationCount);
+            bHasFailed = true;
+        }
+
+        const size_t frameCount = cameraPath.size() + settleFrameCount + 1;
+        std::printf("%llu cells, %zu entities, %.2fMB on disk, budget %.2fMB, %u frames to settle\n", static_cast<unsigned long long>(cellCount),
+                    partitionedEntities.size(), static_cast<double>(totalBytes) / (1024.0 * 1024.0),
+                    static_cast<double>(settings.MemoryBudgetInBytes) / (1024.0 * 1024.0), settleFrameCount);
+        std::printf("%8s %12s %12s %14s %18s %12s\n", "Frames", "Avg(ms)", "Max(ms)", "PeakResident", "PeakCommitted(MB)", "OverBudget");
+        std::printf("%8zu %12.3f %12.3f %14u %18.2f %12u\n", frameCount, totalUpdateMilliseconds / static_cast<double>(frameCount), maxUpdateMilliseconds,
+                    peakResidentCellCount, static_cast<double>(peakCommittedBytes) / (1024.0 * 1024.0), budgetViolationCount);
+    }
+
+    std::filesystem::remove_all(directory, error);
+    std::puts(bHasFailed ? "FAILED" : "PASSED");
+    return bHasFailed ? 1 : 0;
+}
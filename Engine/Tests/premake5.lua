@@ -0,0 +1,259 @@
+-- Engine Library와 Windows SDK 없이 OcclusionBuffer만 Build하여 결과를 검사하고 시간을 측정함.
+-- Linux에서는 SimpleMath가 쓰는 DirectXMath와 DirectX-Headers(wsl/winadapter.h)가 System Include 경로에 있어야 함.
+project "OcclusionBufferTest"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   staticruntime "off"
+   conformancemode (true)
+   justmycode "Off"
+
+   targetdir ("Binaries/" .. OutputPath)
+   objdir ("Intermediate/" .. OutputPath)
+
+   files
+   {
+      "OcclusionBufferTest.cpp",
+      "../Source/Core/JobSystem.cpp",
+      "../Source/Graphics/OcclusionBuffer.cpp",
+   }
+
+   includedirs
+   {
+      "../Source",
+      "%{IncludeDirectories.DirectXTK}",
+   }
+
+   defines
+   {
+      "NOMINMAX",
+   }
+
+   filter "system:linux"
+      externalincludedirs
+      {
+         "/usr/include/directxmath",
+         "/usr/include/wsl/stubs",
+         "/usr/include/wsl",
+      }
+      forceincludes { "winadapter.h" }
+      links { "pthread" }
+
+   filter "configurations:Debug"
+      runtime "Debug"
+      symbols "On"
+
+   filter { "configurations:Debug", "system:not windows" }
+      defines { "_DEBUG" }
+
+   filter "configurations:Release"
+      runtime "Release"
+      optimize "On"
+      symbols "Off"
+
+-- UploadRing의 Offset 계산만 가짜 Fence로 검사하므로 Test와 UploadRing.cpp만 Build함.
+project "UploadRingTest"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   staticruntime "off"
+   conformancemode (true)
+   justmycode "Off"
+
+   targetdir ("Binaries/" .. OutputPath)
+   objdir ("Intermediate/" .. OutputPath)
+
+   files
+   {
+      "UploadRingTest.cpp",
+      "../Source/Graphics/UploadRing.cpp",
+   }
+
+   includedirs
+   {
+      "../Source",
+   }
+
+   defines
+   {
+      "NOMINMAX",
+   }
+
+   filter "configurations:Debug"
+      runtime "Debug"
+      symbols "On"
+
+   filter { "configurations:Debug", "system:not windows" }
+      defines { "_DEBUG" }
+
+   filter "configurations:Release"
+      runtime "Release"
+      optimize "On"
+      symbols "Off"
+
+-- ResourceStateTracker는 Resource Pointer를 Key로만 쓰므로 Device 없이 가짜 Pointer로 검사함. d3d12.h의 Type만 필요함.
+project "ResourceStateTrackerTest"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   staticruntime "off"
+   conformancemode (true)
+   justmycode "Off"
+
+   targetdir ("Binaries/" .. OutputPath)
+   objdir ("Intermediate/" .. OutputPath)
+
+   files
+   {
+      "ResourceStateTrackerTest.cpp",
+      "../Source/Graphics/ResourceStateTracker.cpp",
+   }
+
+   includedirs
+   {
+      "../Source",
+   }
+
+   defines
+   {
+      "NOMINMAX",
+   }
+
+   filter "system:linux"
+      externalincludedirs
+      {
+         "/usr/include/directx",
+         "/usr/include/wsl/stubs",
+         "/usr/include/wsl",
+      }
+      forceincludes { "winadapter.h" }
+
+   filter "configurations:Debug"
+      runtime "Debug"
+      symbols "On"
+
+   filter { "configurations:Debug", "system:not windows" }
+      defines { "_DEBUG" }
+
+   filter "configurations:Release"
+      runtime "Release"
+      optimize "On"
+      symbols "Off"
+
+-- RenderGraph의 Compile은 Device 없이 실행되므로 가짜 AllocationInfo로 검사함. spdlog는 Header만으로 씀.
+project "RenderGraphTest"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   staticruntime "off"
+   conformancemode (true)
+   justmycode "Off"
+
+   targetdir ("Binaries/" .. OutputPath)
+   objdir ("Intermediate/" .. OutputPath)
+
+   files
+   {
+      "RenderGraphTest.cpp",
+      "../Source/Graphics/RenderGraph.cpp",
+      "../Source/Graphics/ResourceStateTracker.cpp",
+   }
+
+   includedirs
+   {
+      "../Source",
+      "%{IncludeDirectories.spdlog}",
+   }
+
+   defines
+   {
+      "NOMINMAX",
+   }
+
+   filter "system:linux"
+      externalincludedirs
+      {
+         "/usr/include/directx",
+         "/usr/include/wsl/stubs",
+         "/usr/include/wsl",
+      }
+      forceincludes { "winadapter.h" }
+
+   filter "configurations:Debug"
+      runtime "Debug"
+      symbols "On"
+
+   filter { "configurations:Debug", "system:not windows" }
+      defines { "_DEBUG" }
+
+   filter "configurations:Release"
+      runtime "Release"
+      optimize "On"
+      symbols "Off"
+
+-- WorldPartition은 Scene과 SceneSnapshot, AssetManager를 거치므로 Source를 따로 Build하지 않고 Editor처럼 Engine Library를 Link함.
+-- 그래서 Engine을 Build할 수 있는 Windows에서만 실행할 수 있음.
+project "WorldPartitionTest"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   staticruntime "off"
+   conformancemode (true)
+   justmycode "Off"
+
+   targetdir ("Binaries/" .. OutputPath)
+   objdir ("Intermediate/" .. OutputPath)
+
+   files
+   {
+      "WorldPartitionTest.cpp",
+   }
+
+   includedirs
+   {
+      "../Source",
+      "%{IncludeDirectories.glfw}",
+      "%{IncludeDirectories.entt}",
+      "%{IncludeDirectories.spdlog}",
+      "%{IncludeDirectories.DirectXTK}",
+   }
+
+   links
+   {
+      "Engine",
+      "DirectXTK",
+   }
+
+   defines
+   {
+      "NOMINMAX",
+      "SPDLOG_USE_STD_FORMAT",
+      "SPDLOG_COMPILED_LIB",
+   }
+
+   filter "configurations:Debug"
+      runtime "Debug"
+      symbols "On"
+      links
+      {
+         "%{Libraries.assimpd}",
+         "%{Libraries.spdlogd}",
+      }
+      postbuildcommands
+      {
+         '{COPY} "%{Libraries.assimpd}.dll" "%{cfg.targetdir}"',
+      }
+
+   filter "configurations:Release"
+      runtime "Release"
+      optimize "On"
+      symbols "Off"
+      links
+      {
+         "%{Libraries.assimp}",
+         "%{Libraries.spdlog}",
+      }
+      postbuildcommands
+      {
+         '{COPY} "%{Libraries.assimp}.dll" "%{cfg.targetdir}"',
+      }
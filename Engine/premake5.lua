@@ -41,6 +41,10 @@ project "Engine"
       "SPDLOG_COMPILED_LIB",
    }
 
+   -- Engine/Tests에서 Engine 없이 Build하는 Source는 EnginePCH.h를 Include하지 않음.
+   filter "files:Source/Core/JobSystem.cpp or Source/Graphics/OcclusionBuffer.cpp or Source/Graphics/UploadRing.cpp or Source/Graphics/ResourceStateTracker.cpp or Source/Graphics/RenderGraph.cpp"
+      flags { "NoPCH" }
+
    filter "configurations:Debug"
       runtime "Debug"
       symbols "On"
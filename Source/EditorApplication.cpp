@@ -8,10 +8,17 @@
 #include "imgui_internal.h"
 #include "backends/imgui_impl_dx12.h"
 #include "backends/imgui_impl_glfw.h"
+#include "Core/Benchmark.h"
 #include "Core/Core.h"
 #include "ECS/Components.h"
 #include "ImGuizmo/ImGuizmo.h"
 
+namespace
+{
+    constexpr const char* SceneFilePath = "Content/Default.scene";
+    constexpr const char* WorldPartitionDirectory = "Content/World";
+}
+
 EditorApplication::~EditorApplication()
 {
     ImGui_ImplDX12_Shutdown();
@@ -41,10 +48,11 @@ void EditorApplication::Initialize()
 
 
     // TODO:
+    // Font Texture의 SRV 자리
+    Engine::DescriptorHeap& descriptorHeap = m_Renderer.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    m_FontDescriptor = descriptorHeap.Allocate();
     ImGui_ImplDX12_Init(Engine::Core::GetRenderContext().GetDevice().Get(), m_Renderer.m_FrameCount,
-                        DXGI_FORMAT_R8G8B8A8_UNORM, m_Renderer.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV).Get(),
-                        m_Renderer.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)->GetCPUDescriptorHandleForHeapStart(),
-                        m_Renderer.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)->GetGPUDescriptorHandleForHeapStart());
+                        DXGI_FORMAT_R8G8B8A8_UNORM, descriptorHeap.Get(), m_FontDescriptor.CPU, m_FontDescriptor.GPU);
 
     ImGui::StyleColorsDark();
     ImGuiStyle& style = ImGui::GetStyle();
@@ -93,8 +101,10 @@ void EditorApplication::HandleCameraMovement()
 
 
     m_Velocity *= 0.96f;
-    auto& cameraTransform = m_Renderer.m_Registry.get<Engine::TransformComponent>(m_Renderer.m_CameraEntity);
-    cameraTransform.Position += m_Velocity * static_cast<float>(m_Timer.GetDeltaSeconds());
+    m_Renderer.GetRegister().patch<Engine::TransformComponent>(m_Renderer.m_CameraEntity, [this](Engine::TransformComponent& cameraTransform)
+    {
+        cameraTransform.Position += m_Velocity * static_cast<float>(m_Timer.GetDeltaSeconds());
+    });
 }
 
 void EditorApplication::Update()
@@ -135,8 +145,10 @@ void EditorApplication::OnCursorPosEvent(double xPos, double yPos)
     yaw += deltaX * 15.0f * static_cast<float>(m_Timer.GetDeltaSeconds());
     pitch += deltaY * 15.0f * static_cast<float>(m_Timer.GetDeltaSeconds());
 
-    auto& cameraTransform = m_Renderer.m_Registry.get<Engine::TransformComponent>(m_Renderer.m_CameraEntity);
-    cameraTransform.Rotation = DirectX::SimpleMath::Vector3{pitch, yaw, 0.0f};
+    m_Renderer.GetRegister().patch<Engine::TransformComponent>(m_Renderer.m_CameraEntity, [](Engine::TransformComponent& cameraTransform)
+    {
+        cameraTransform.Rotation = DirectX::SimpleMath::Vector3{pitch, yaw, 0.0f};
+    });
 
 
     lastX = xPos;
@@ -171,12 +183,69 @@ void EditorApplication::RenderUI()
     {
         if (ImGui::BeginMenu("File"))
         {
+            if (ImGui::MenuItem("Save Scene"))
+            {
+                m_Renderer.SaveScene(SceneFilePath);
+            }
+            if (ImGui::MenuItem("Load Scene"))
+            {
+                m_Renderer.LoadScene(SceneFilePath);
+            }
+            if (ImGui::MenuItem("Build World Partition"))
+            {
+                m_Renderer.BuildWorldPartition(WorldPartitionDirectory);
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem("Exit"))
             {
                 glfwSetWindowShouldClose(m_Window, true);
             }
             ImGui::EndMenu();
         }
+        if (ImGui::BeginMenu("Tools"))
+        {
+            if (ImGui::MenuItem("Run Transform Benchmark"))
+            {
+                Engine::Benchmark::RunTransformBenchmark();
+            }
+            if (ImGui::MenuItem("Run Entity Spawn Benchmark"))
+            {
+                Engine::Benchmark::RunEntitySpawnBenchmark();
+            }
+            if (ImGui::MenuItem("Run Prefab Benchmark"))
+            {
+                Engine::Benchmark::RunPrefabBenchmark();
+            }
+            if (ImGui::MenuItem("Run Scene BVH Benchmark"))
+            {
+                Engine::Benchmark::RunSceneBVHBenchmark();
+            }
+            if (ImGui::MenuItem("Run Frustum Culling Benchmark"))
+            {
+                Engine::Benchmark::RunFrustumCullingBenchmark();
+            }
+            if (ImGui::MenuItem("Run Occlusion Culling Benchmark"))
+            {
+                Engine::Benchmark::RunOcclusionCullingBenchmark();
+            }
+            if (ImGui::MenuItem("Run Clustered Lighting Benchmark"))
+            {
+                Engine::Benchmark::RunClusteredLightingBenchmark();
+            }
+            if (ImGui::MenuItem("Run Render Queue Benchmark"))
+            {
+                Engine::Benchmark::RunRenderQueueBenchmark();
+            }
+            if (ImGui::MenuItem("Run Staging Upload Benchmark"))
+            {
+                Engine::Benchmark::RunStagingUploadBenchmark();
+            }
+            if (ImGui::MenuItem("Run Descriptor Allocator Benchmark"))
+            {
+                Engine::Benchmark::RunDescriptorAllocatorBenchmark();
+            }
+            ImGui::EndMenu();
+        }
         ImGui::EndMainMenuBar();
     }
 
@@ -199,9 +268,8 @@ void EditorApplication::RenderUI()
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
     ImGuiWindowFlags windowFlags = ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse;
     ImGui::Begin("Viewport", nullptr, windowFlags);
-    auto descHeap = m_Renderer.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    CD3DX12_GPU_DESCRIPTOR_HANDLE gpuHandle(descHeap->GetGPUDescriptorHandleForHeapStart(), m_Renderer.GetCurrentBackBufferIndex() + 1, Engine::Core::GetRenderContext().GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
-    ImGui::Image((void*)gpuHandle.ptr, ImGui::GetWindowSize());
+    const Engine::DescriptorHandle& sceneColorDescriptor = m_Renderer.GetSceneColorDescriptor();
+    ImGui::Image((void*)sceneColorDescriptor.GPU.ptr, ImGui::GetWindowSize());
     m_Renderer.m_AspectRatio = ImGui::GetWindowSize().x / ImGui::GetWindowSize().y;
 
     if (ImGui::IsMouseClicked(1) && ImGui::IsWindowHovered())
@@ -254,29 +322,51 @@ void EditorApplication::RenderUI()
 
     if (ImGui::TreeNodeEx("Scene", treeNodeFlags | ImGuiTreeNodeFlags_DefaultOpen))
     {
-        auto view = registry.view<Engine::DisplayNameComponent>();
-        for (const auto [entity, displayName] : view.each())
+        // Scene Node에 놓으면 Root Entity가 됨.
+        if (ImGui::BeginDragDropTarget())
         {
-            ImGui::PushID(entt::to_integral(entity));
-            bool bOpened = ImGui::TreeNodeEx(displayName.Name.c_str(),
-                                             selectedEntity == entity ? treeNodeFlags | ImGuiTreeNodeFlags_Selected : treeNodeFlags);
-
-            if (ImGui::IsItemClicked())
+            if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ENTITY"))
             {
-                selectedEntity = entity;
+                m_Renderer.m_Scene->SetParent(*static_cast<const entt::entity*>(payload->Data), entt::null);
             }
-            if (bOpened)
+            ImGui::EndDragDropTarget();
+        }
+
+        // 이름을 Prefab과 공유하는 Instance는 DisplayNameComponent가 없음.
+        const auto drawRootNode = [&](entt::entity entity)
+        {
+            const auto* relationship = registry.try_get<Engine::RelationshipComponent>(entity);
+            if (!relationship || relationship->Parent == entt::null)
             {
-                // TODO : 자식 Entity
-                ImGui::TreePop();
+                DrawEntityNode(registry, entity, selectedEntity);
             }
-            ImGui::PopID();
+        };
+        for (const auto entity : registry.view<Engine::DisplayNameComponent>())
+        {
+            drawRootNode(entity);
+        }
+        for (const auto entity : registry.view<Engine::PrefabInstanceComponent>(entt::exclude<Engine::DisplayNameComponent>))
+        {
+            drawRootNode(entity);
         }
 
         ImGui::TreePop();
     }
     ImGui::End();
 
+    ImGui::Begin("Systems");
+    for (const auto& systemStats : m_Renderer.GetScene().GetSystemStats())
+    {
+        ImGui::Text("%-24s %8.3f ms  Thread %u", systemStats.Name.c_str(), std::chrono::duration<double, std::milli>(systemStats.Duration).count(), systemStats.ThreadIndex);
+    }
+    const Engine::Renderer::SceneRecordingStats& recordingStats = m_Renderer.GetSceneRecordingStats();
+    ImGui::Text("%-24s %8.3f ms  %u Draws, %u Command Lists", "SceneRecording", std::chrono::duration<double, std::milli>(recordingStats.Duration).count(),
+                recordingStats.DrawCount, recordingStats.CommandListCount);
+    const Engine::UploadManager::Stats& uploadStats = m_Renderer.GetUploadStats();
+    ImGui::Text("%-24s %8.1f MB  %u Uploads, %u Submits, %u Waits", "Upload", static_cast<double>(uploadStats.UploadedBytes) / (1024.0 * 1024.0),
+                uploadStats.UploadCount, uploadStats.SubmitCount, uploadStats.WaitCount);
+    ImGui::End();
+
     ImGui::Begin("Inspector");
     if (ImGui::IsMouseClicked(1) && ImGui::IsWindowHovered())
     {
@@ -284,19 +374,23 @@ void EditorApplication::RenderUI()
     }
 
     ImGui::PushID(entt::to_integral(selectedEntity));
-    if (registry.all_of<Engine::DisplayNameComponent>(selectedEntity))
+    if (registry.any_of<Engine::DisplayNameComponent, Engine::PrefabInstanceComponent>(selectedEntity))
     {
         if (ImGui::CollapsingHeader("DisplayName", ImGuiTreeNodeFlags_DefaultOpen))
         {
             ImGui::Spacing();
-            auto& displayName = registry.get<Engine::DisplayNameComponent>(selectedEntity);
-            displayName.Name.resize(32);
+            // Prefab Instance는 이름을 수정할 때만 자신의 DisplayNameComponent를 가짐.
+            char name[32]{};
+            m_Renderer.GetScene().GetDisplayName(selectedEntity).copy(name, sizeof(name) - 1);
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 2.0f));
             ImGui::Indent();
             ImGui::Text("DisplayName");
             ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
             ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
-            ImGui::InputText("##Name", displayName.Name.data(), displayName.Name.size());
+            if (ImGui::InputText("##Name", name, sizeof(name)))
+            {
+                m_Renderer.GetScene().OverrideDisplayName(selectedEntity).Name = name;
+            }
             ImGui::PopItemWidth();
             ImGui::Unindent();
             ImGui::PopStyleVar();
@@ -315,21 +409,26 @@ void EditorApplication::RenderUI()
             ImGui::Text("Position");
             ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
             ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
-            ImGui::DragFloat3("##P", &transform.Position.x);
+            bool bIsTransformChanged = ImGui::DragFloat3("##P", &transform.Position.x);
             ImGui::PopItemWidth();
 
             ImGui::Text("Rotation");
             ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
             ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
-            ImGui::DragFloat3("##R", &transform.Rotation.x);
+            bIsTransformChanged |= ImGui::DragFloat3("##R", &transform.Rotation.x);
             ImGui::PopItemWidth();
 
             ImGui::Text("Scale");
             ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
             ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
-            ImGui::DragFloat3("##S", &transform.Scale.x);
+            bIsTransformChanged |= ImGui::DragFloat3("##S", &transform.Scale.x);
             ImGui::PopItemWidth();
 
+            if (bIsTransformChanged)
+            {
+                registry.patch<Engine::TransformComponent>(selectedEntity);
+            }
+
             ImGui::Unindent();
             ImGui::PopStyleVar();
             ImGui::Spacing();
@@ -351,6 +450,70 @@ void EditorApplication::RenderUI()
             ImGui::ColorEdit3("##C", &light.LightColor.x);
             ImGui::PopItemWidth();
 
+            ImGui::Text("Type");
+            ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+            ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
+            constexpr const char* lightTypeNames[] = {"Directional", "Point", "Spot"};
+            int lightType = static_cast<int>(light.Type);
+            if (ImGui::Combo("##T", &lightType, lightTypeNames, IM_ARRAYSIZE(lightTypeNames)))
+            {
+                light.Type = static_cast<Engine::LightType>(lightType);
+            }
+            ImGui::PopItemWidth();
+
+            ImGui::Text("Intensity");
+            ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+            ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
+            ImGui::DragFloat("##I", &light.Intensity, 0.05f, 0.0f, 1000.0f);
+            ImGui::PopItemWidth();
+
+            if (light.Type != Engine::LightType::Directional)
+            {
+                ImGui::Text("Range");
+                ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+                ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
+                ImGui::DragFloat("##Ra", &light.Range, 0.1f, 0.1f, 1000.0f);
+                ImGui::PopItemWidth();
+            }
+
+            if (light.Type == Engine::LightType::Spot)
+            {
+                ImGui::Text("Cone Angle");
+                ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+                ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
+                ImGui::DragFloatRange2("##A", &light.InnerConeAngle, &light.OuterConeAngle, 0.5f, 0.0f, 89.0f);
+                ImGui::PopItemWidth();
+            }
+
+            ImGui::Unindent();
+            ImGui::PopStyleVar();
+            ImGui::Spacing();
+        }
+    }
+
+    if (registry.all_of<Engine::MeshRenderComponent>(selectedEntity))
+    {
+        if (ImGui::CollapsingHeader("Mesh Render", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            ImGui::Spacing();
+
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 2.0f));
+            ImGui::Indent();
+            ImGui::Text("Occluder");
+            ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+            bool bIsOccluder = registry.all_of<Engine::OccluderComponent>(selectedEntity);
+            if (ImGui::Checkbox("##O", &bIsOccluder))
+            {
+                if (bIsOccluder)
+                {
+                    registry.emplace<Engine::OccluderComponent>(selectedEntity);
+                }
+                else
+                {
+                    registry.remove<Engine::OccluderComponent>(selectedEntity);
+                }
+            }
+
             ImGui::Unindent();
             ImGui::PopStyleVar();
             ImGui::Spacing();
@@ -363,3 +526,53 @@ void EditorApplication::RenderUI()
     ImGui::End();
     ImGui::Render();
 }
+
+void EditorApplication::DrawEntityNode(entt::registry& registry, entt::entity entity, entt::entity& selectedEntity)
+{
+    const ImGuiTreeNodeFlags treeNodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+    const auto* relationship = registry.try_get<Engine::RelationshipComponent>(entity);
+    const bool bHasChild = relationship && relationship->FirstChild != entt::null;
+
+    ImGui::PushID(entt::to_integral(entity));
+    ImGuiTreeNodeFlags flags = selectedEntity == entity ? treeNodeFlags | ImGuiTreeNodeFlags_Selected : treeNodeFlags;
+    flags |= bHasChild ? 0 : ImGuiTreeNodeFlags_Leaf;
+    const std::string& name = m_Renderer.GetScene().GetDisplayName(entity);
+    const bool bOpened = ImGui::TreeNodeEx(name.c_str(), flags);
+
+    if (ImGui::IsItemClicked())
+    {
+        selectedEntity = entity;
+    }
+
+    // 다른 Entity 위에 놓으면 그 Entity의 자식이 됨.
+    if (ImGui::BeginDragDropSource())
+    {
+        ImGui::SetDragDropPayload("ENTITY", &entity, sizeof(entity));
+        ImGui::Text("%s", name.c_str());
+        ImGui::EndDragDropSource();
+    }
+    if (ImGui::BeginDragDropTarget())
+    {
+        if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ENTITY"))
+        {
+            m_Renderer.m_Scene->SetParent(*static_cast<const entt::entity*>(payload->Data), entity);
+        }
+        ImGui::EndDragDropTarget();
+    }
+
+    if (bOpened)
+    {
+        if (bHasChild)
+        {
+            for (entt::entity child = relationship->FirstChild; child != entt::null; child = registry.get<Engine::RelationshipComponent>(child).NextSibling)
+            {
+                if (registry.any_of<Engine::DisplayNameComponent, Engine::PrefabInstanceComponent>(child))
+                {
+                    DrawEntityNode(registry, child, selectedEntity);
+                }
+            }
+        }
+        ImGui::TreePop();
+    }
+    ImGui::PopID();
+}
@@ -23,10 +23,12 @@ public:
 
 private:
     void RenderUI();
+    void DrawEntityNode(entt::registry& registry, entt::entity entity, entt::entity& selectedEntity);
 
 
 private:
     Microsoft::WRL::ComPtr<ID3D12Resource> m_RTVResource = nullptr;
+    Engine::DescriptorHandle m_FontDescriptor;
     bool m_bIsViewportFocused = false;
 
 
@@ -80,6 +80,9 @@ project "Editor"
    
 
 include "Engine"
+group "Tests"
+   include "Engine/Tests"
+group ""
 group "ThirdParties"
    include "ThirdParties/imgui"
 group ""